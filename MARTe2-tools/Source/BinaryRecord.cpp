@@ -0,0 +1,191 @@
+/**
+ * @file BinaryRecord.cpp
+ * @brief Source file for the BinaryRecord functions and the class ByteReader
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the BinaryRecord functions and of all the methods for
+ * the class ByteReader (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "BinaryRecord.h"
+#include "Matrix.h"
+#include "StringHelper.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ByteReader::ByteReader(const char8 * const bufferIn, const uint64 sizeIn, const uint64 offsetIn) {
+    buffer = bufferIn;
+    size = sizeIn;
+    offset = offsetIn;
+}
+
+bool ByteReader::ReadBytes(void * const data, const uint64 numberOfBytes) {
+    bool ok = (numberOfBytes <= GetRemainingSize());
+    if ((ok) && (numberOfBytes > 0u)) {
+        ok = MemoryOperationsHelper::Copy(data, &buffer[offset], static_cast<uint32>(numberOfBytes));
+    }
+    if (ok) {
+        offset += numberOfBytes;
+    }
+    return ok;
+}
+
+bool ByteReader::ReadString(StreamString &str) {
+    uint32 length = 0u;
+    bool ok = ReadValue(length);
+    if (ok) {
+        ok = ((offset + length) <= size);
+    }
+    if (ok) {
+        str = "";
+        uint32 writeSize = length;
+        ok = str.Write(&buffer[offset], writeSize);
+        offset += length;
+    }
+    return ok;
+}
+
+bool ByteReader::SkipString() {
+    uint32 length = 0u;
+    bool ok = ReadValue(length);
+    if (ok) {
+        ok = ((offset + length) <= size);
+    }
+    if (ok) {
+        offset += length;
+    }
+    return ok;
+}
+
+uint64 ByteReader::GetOffset() const {
+    return offset;
+}
+
+bool ByteReader::SetOffset(const uint64 offsetIn) {
+    bool ok = (offsetIn <= size);
+    if (ok) {
+        offset = offsetIn;
+    }
+    return ok;
+}
+
+uint64 ByteReader::GetRemainingSize() const {
+    return (offset < size) ? (size - offset) : 0u;
+}
+
+namespace BinaryRecord {
+
+void AppendString(StreamString &stream, const char8 * const str) {
+    uint32 size = StringHelper::Length(str);
+    AppendValue(stream, size);
+    (void) stream.Write(str, size);
+}
+
+bool AppendTextLeaf(ConfigurationDatabase &cdb, const char8 * const name, StreamString &stream) {
+    AnyType leaf = cdb.GetType(name);
+    uint8 numberOfDimensions = leaf.GetNumberOfDimensions();
+    uint32 numberOfColumns = (numberOfDimensions > 0u) ? leaf.GetNumberOfElements(0u) : 1u;
+    uint32 numberOfRows = (numberOfDimensions > 1u) ? leaf.GetNumberOfElements(1u) : 1u;
+    uint32 numberOfElements = numberOfColumns * numberOfRows;
+    StreamString *values = new StreamString[(numberOfElements > 0u) ? numberOfElements : 1u];
+    bool ok = true;
+    if (numberOfDimensions == 0u) {
+        ok = cdb.Read(name, values[0]);
+    }
+    else if (numberOfDimensions == 1u) {
+        Vector<StreamString> vec(values, numberOfColumns);
+        ok = cdb.Read(name, vec);
+    }
+    else {
+        Matrix<StreamString> mat(values, numberOfRows, numberOfColumns);
+        ok = cdb.Read(name, mat);
+    }
+    if (ok) {
+        AppendValue(stream, numberOfDimensions);
+        AppendValue(stream, numberOfRows);
+        AppendValue(stream, numberOfColumns);
+        uint32 e;
+        for (e = 0u; e < numberOfElements; e++) {
+            AppendString(stream, values[e].Buffer());
+        }
+    }
+    delete [] values;
+    return ok;
+}
+
+bool ReadTextLeaf(ByteReader &reader, const char8 * const name, ConfigurationDatabase &cdb) {
+    uint8 numberOfDimensions = 0u;
+    uint32 numberOfRows = 0u;
+    uint32 numberOfColumns = 0u;
+    bool ok = reader.ReadValue(numberOfDimensions);
+    if (ok) {
+        ok = reader.ReadValue(numberOfRows);
+    }
+    if (ok) {
+        ok = reader.ReadValue(numberOfColumns);
+    }
+    uint64 numberOfElements = static_cast<uint64>(numberOfRows) * static_cast<uint64>(numberOfColumns);
+    if (ok) {
+        //A scalar has exactly one element and a vector one row
+        ok = ((numberOfDimensions == 0u) && (numberOfElements == 1u)) || ((numberOfDimensions == 1u) && (numberOfRows == 1u)) || (numberOfDimensions == 2u);
+    }
+    if (ok) {
+        //Each element takes at least 4 bytes, which also bounds the number of elements before allocating them
+        ok = (numberOfElements <= (reader.GetRemainingSize() / 4u));
+    }
+    if (ok) {
+        StreamString *values = new StreamString[(numberOfElements > 0u) ? static_cast<uint32>(numberOfElements) : 1u];
+        uint32 e;
+        for (e = 0u; (e < numberOfElements) && (ok); e++) {
+            ok = reader.ReadString(values[e]);
+        }
+        if (ok) {
+            if (numberOfDimensions == 0u) {
+                ok = cdb.Write(name, values[0]);
+            }
+            else if (numberOfDimensions == 1u) {
+                Vector<StreamString> vec(values, numberOfColumns);
+                ok = cdb.Write(name, vec);
+            }
+            else {
+                Matrix<StreamString> mat(values, numberOfRows, numberOfColumns);
+                ok = cdb.Write(name, mat);
+            }
+        }
+        delete [] values;
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,202 @@
+/**
+ * @file BinaryRecord.h
+ * @brief Header file for the BinaryRecord functions and the class ByteReader
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the BinaryRecord functions and of the class ByteReader,
+ * with all of its public, protected and private members. It also includes the definition of the template functions and methods.
+ */
+
+#ifndef BINARYRECORD_H_
+#define BINARYRECORD_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Bounds checked reader of the values written with the BinaryRecord functions.
+ */
+class ByteReader {
+public:
+    /**
+     * @brief Constructor. Reads the \a sizeIn bytes of \a bufferIn, starting at \a offsetIn.
+     */
+    ByteReader(const char8 * const bufferIn, const uint64 sizeIn, const uint64 offsetIn = 0u);
+
+    /**
+     * @brief Reads the native representation of \a value.
+     * @return false if there are not enough bytes left.
+     */
+    template<typename T>
+    inline bool ReadValue(T &value);
+
+    /**
+     * @brief Reads \a numberOfBytes raw bytes into \a data.
+     * @return false if there are not enough bytes left.
+     */
+    bool ReadBytes(void * const data, const uint64 numberOfBytes);
+
+    /**
+     * @brief Reads a string written with BinaryRecord::AppendString.
+     * @return false if there are not enough bytes left.
+     */
+    bool ReadString(StreamString &str);
+
+    /**
+     * @brief Skips a string written with BinaryRecord::AppendString.
+     * @return false if there are not enough bytes left.
+     */
+    bool SkipString();
+
+    /**
+     * @brief Gets the position of the next read.
+     */
+    uint64 GetOffset() const;
+
+    /**
+     * @brief Sets the position of the next read.
+     * @return false if \a offsetIn is beyond the end of the buffer.
+     */
+    bool SetOffset(const uint64 offsetIn);
+
+    /**
+     * @brief Gets the number of bytes left to read.
+     */
+    uint64 GetRemainingSize() const;
+
+private:
+    const char8 *buffer;
+    uint64 size;
+    uint64 offset;
+};
+
+/**
+ * @brief Helpers shared by the binary formats of the tools (archives, indexes and the include disk cache): values in their native
+ * representation, strings prefixed by their size and leaves as their elements printed as strings.
+ */
+namespace BinaryRecord {
+
+/**
+ * @brief Appends the native representation of \a value to \a stream.
+ */
+template<typename T>
+inline void AppendValue(StreamString &stream, const T value);
+
+/**
+ * @brief Appends the size of \a str followed by its characters (without terminator) to \a stream.
+ */
+void AppendString(StreamString &stream, const char8 * const str);
+
+/**
+ * @brief Appends the leaf \a name of the current node of \a cdb to \a stream: its number of dimensions, rows and columns followed by
+ * each element as a string.
+ * @return false if the leaf could not be read.
+ */
+bool AppendTextLeaf(ConfigurationDatabase &cdb, const char8 * const name, StreamString &stream);
+
+/**
+ * @brief Reads a leaf written with AppendTextLeaf into the leaf \a name of the current node of \a cdb.
+ * @details The shape is validated (a scalar has one element, a vector one row) and the number of elements is bounded by the remaining
+ * bytes before they are allocated.
+ * @return false if the leaf is truncated or corrupted.
+ */
+bool ReadTextLeaf(ByteReader &reader, const char8 * const name, ConfigurationDatabase &cdb);
+
+/**
+ * @brief Stable bottom-up merge sort of \a values using the strict weak ordering \a less.
+ */
+template<typename T, class Less>
+inline void MergeSort(T * const values, const uint32 size, const Less &less);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+template<typename T>
+bool ByteReader::ReadValue(T &value) {
+    bool ok = ((offset + sizeof(T)) <= size);
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(&value, &buffer[offset], static_cast<uint32>(sizeof(T)));
+        offset += sizeof(T);
+    }
+    return ok;
+}
+
+namespace BinaryRecord {
+
+template<typename T>
+void AppendValue(StreamString &stream, const T value) {
+    uint32 size = static_cast<uint32>(sizeof(T));
+    (void) stream.Write(reinterpret_cast<const char8 *>(&value), size);
+}
+
+template<typename T, class Less>
+void MergeSort(T * const values, const uint32 size, const Less &less) {
+    if (size > 1u) {
+        T *tmp = new T[size];
+        uint32 width;
+        for (width = 1u; width < size; width *= 2u) {
+            uint32 first;
+            for (first = 0u; first < size; first += (2u * width)) {
+                uint32 middle = ((size - first) > width) ? (first + width) : size;
+                uint32 end = ((size - middle) > width) ? (middle + width) : size;
+                uint32 a = first;
+                uint32 b = middle;
+                uint32 k;
+                for (k = first; k < end; k++) {
+                    if ((a < middle) && ((b >= end) || (!less(values[b], values[a])))) {
+                        tmp[k] = values[a];
+                        a++;
+                    }
+                    else {
+                        tmp[k] = values[b];
+                        b++;
+                    }
+                }
+            }
+            uint32 i;
+            for (i = 0u; i < size; i++) {
+                values[i] = tmp[i];
+            }
+        }
+        delete [] tmp;
+    }
+}
+
+}
+
+}
+
+#endif /* BINARYRECORD_H_ */
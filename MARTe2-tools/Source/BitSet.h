@@ -0,0 +1,291 @@
+/**
+ * @file BitSet.h
+ * @brief Header file for class BitSet
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class BitSet
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef BITSET_H_
+#define BITSET_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Fixed size set of bits, stored in 64 bit words so that the set operations are word-parallel.
+ * @details The set operations require both sets to have the same size.
+ */
+class BitSet {
+public:
+    /**
+     * @brief Constructor. Creates an empty set with \a numberOfBitsIn bits.
+     */
+    inline BitSet(const uint32 numberOfBitsIn = 0u);
+
+    /**
+     * @brief Copy constructor.
+     */
+    inline BitSet(const BitSet &other);
+
+    /**
+     * @brief Destructor.
+     */
+    inline ~BitSet();
+
+    /**
+     * @brief Copy operator.
+     */
+    inline BitSet &operator=(const BitSet &other);
+
+    /**
+     * @brief Resizes the set to \a numberOfBitsIn bits. All the bits are cleared.
+     */
+    inline void SetSize(const uint32 numberOfBitsIn);
+
+    /**
+     * @brief Gets the number of bits.
+     */
+    inline uint32 GetSize() const;
+
+    /**
+     * @brief Sets the bit \a bit.
+     */
+    inline void Set(const uint32 bit);
+
+    /**
+     * @brief Returns true if the bit \a bit is set.
+     */
+    inline bool Test(const uint32 bit) const;
+
+    /**
+     * @brief Clears all the bits.
+     */
+    inline void Reset();
+
+    /**
+     * @brief this = this | other.
+     */
+    inline void Or(const BitSet &other);
+
+    /**
+     * @brief this = this & other.
+     */
+    inline void And(const BitSet &other);
+
+    /**
+     * @brief this = this & ~other.
+     */
+    inline void AndNot(const BitSet &other);
+
+    /**
+     * @brief this = ~this.
+     */
+    inline void Invert();
+
+    /**
+     * @brief Returns true if at least one bit is set.
+     */
+    inline bool Any() const;
+
+    /**
+     * @brief Gets the number of bits set.
+     */
+    inline uint32 Count() const;
+
+    /**
+     * @brief Finds the first bit set at or after \a bit.
+     * @param[in,out] bit the first bit to test. Updated with the bit found.
+     * @return false if there are no more bits set.
+     */
+    inline bool Next(uint32 &bit) const;
+
+private:
+    /**
+     * @brief Clears the bits of the last word which are beyond numberOfBits.
+     */
+    inline void ClearTail();
+
+    uint64 *words;
+    uint32 numberOfWords;
+    uint32 numberOfBits;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+BitSet::BitSet(const uint32 numberOfBitsIn) {
+    words = NULL_PTR(uint64 *);
+    numberOfWords = 0u;
+    numberOfBits = 0u;
+    SetSize(numberOfBitsIn);
+}
+
+BitSet::BitSet(const BitSet &other) {
+    words = NULL_PTR(uint64 *);
+    numberOfWords = 0u;
+    numberOfBits = 0u;
+    *this = other;
+}
+
+BitSet::~BitSet() {
+    delete [] words;
+}
+
+BitSet &BitSet::operator=(const BitSet &other) {
+    if (this != &other) {
+        SetSize(other.numberOfBits);
+        uint32 w;
+        for (w = 0u; w < numberOfWords; w++) {
+            words[w] = other.words[w];
+        }
+    }
+    return *this;
+}
+
+void BitSet::SetSize(const uint32 numberOfBitsIn) {
+    uint32 newNumberOfWords = (numberOfBitsIn + 63u) / 64u;
+    if (newNumberOfWords != numberOfWords) {
+        delete [] words;
+        words = NULL_PTR(uint64 *);
+        if (newNumberOfWords > 0u) {
+            words = new uint64[newNumberOfWords];
+        }
+        numberOfWords = newNumberOfWords;
+    }
+    numberOfBits = numberOfBitsIn;
+    Reset();
+}
+
+uint32 BitSet::GetSize() const {
+    return numberOfBits;
+}
+
+void BitSet::Set(const uint32 bit) {
+    if (bit < numberOfBits) {
+        words[bit / 64u] |= (1ULL << (bit % 64u));
+    }
+}
+
+bool BitSet::Test(const uint32 bit) const {
+    bool isSet = false;
+    if (bit < numberOfBits) {
+        isSet = ((words[bit / 64u] & (1ULL << (bit % 64u))) != 0ULL);
+    }
+    return isSet;
+}
+
+void BitSet::Reset() {
+    uint32 w;
+    for (w = 0u; w < numberOfWords; w++) {
+        words[w] = 0ULL;
+    }
+}
+
+void BitSet::Or(const BitSet &other) {
+    uint32 w;
+    for (w = 0u; (w < numberOfWords) && (w < other.numberOfWords); w++) {
+        words[w] |= other.words[w];
+    }
+}
+
+void BitSet::And(const BitSet &other) {
+    uint32 w;
+    for (w = 0u; w < numberOfWords; w++) {
+        words[w] &= (w < other.numberOfWords) ? other.words[w] : 0ULL;
+    }
+}
+
+void BitSet::AndNot(const BitSet &other) {
+    uint32 w;
+    for (w = 0u; (w < numberOfWords) && (w < other.numberOfWords); w++) {
+        words[w] &= ~other.words[w];
+    }
+}
+
+void BitSet::Invert() {
+    uint32 w;
+    for (w = 0u; w < numberOfWords; w++) {
+        words[w] = ~words[w];
+    }
+    ClearTail();
+}
+
+bool BitSet::Any() const {
+    bool any = false;
+    uint32 w;
+    for (w = 0u; (w < numberOfWords) && (!any); w++) {
+        any = (words[w] != 0ULL);
+    }
+    return any;
+}
+
+uint32 BitSet::Count() const {
+    uint32 count = 0u;
+    uint32 w;
+    for (w = 0u; w < numberOfWords; w++) {
+        count += static_cast<uint32>(__builtin_popcountll(words[w]));
+    }
+    return count;
+}
+
+bool BitSet::Next(uint32 &bit) const {
+    bool found = false;
+    uint32 w = bit / 64u;
+    if (bit < numberOfBits) {
+        //Ignore the bits before bit in its word
+        uint64 word = words[w] & (~0ULL << (bit % 64u));
+        while ((!found) && (w < numberOfWords)) {
+            found = (word != 0ULL);
+            if (found) {
+                bit = (w * 64u) + static_cast<uint32>(__builtin_ctzll(word));
+            }
+            else {
+                w++;
+                word = (w < numberOfWords) ? words[w] : 0ULL;
+            }
+        }
+    }
+    return found;
+}
+
+void BitSet::ClearTail() {
+    uint32 tailBits = numberOfBits % 64u;
+    if (tailBits > 0u) {
+        words[numberOfWords - 1u] &= ((1ULL << tailBits) - 1ULL);
+    }
+}
+
+}
+
+#endif /* BITSET_H_ */
@@ -0,0 +1,801 @@
+/**
+ * @file CfgArchive.cpp
+ * @brief Source file for main file CfgArchive
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class Playground (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/**
+ * Packs many configuration files into a single archive where each unique subtree is only stored once
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include "AdvancedErrorManagement.h"
+#include "BinaryRecord.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationDatabase.h"
+#include "Diagnostics.h"
+#include "Directory.h"
+#include "File.h"
+#include "HashFunction.h"
+#include "JsonPrinter.h"
+#include "MemoryOperationsHelper.h"
+#include "ParallelJobRunner.h"
+#include "StandardPrinter.h"
+#include "StreamString.h"
+#include "StreamStructuredData.h"
+#include "StreamStructuredDataI.h"
+#include "StringHelper.h"
+#include "XMLPrinter.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+static bool ParseArgument(uint32 nargs, char8 **args, StreamString flag, StreamString &arg) {
+    bool found = false;
+    for (uint32 i=1u; (i<(nargs - 1u) && (!found)); i++) {
+        found = (flag == args[i]);
+        if (found) {
+            arg = args[i + 1];
+        }
+    }
+    if (!found) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Input parameter %s not found\n", flag.Buffer());
+    }
+    return found;
+}
+
+/**
+ * The archive starts with the magic and version, followed by the number of subtrees and of files and by the offsets (in bytes, from
+ * the start of the archive) of the subtree records, of the subtree offsets table and of the file index.
+ */
+static const char8 * const ARCHIVE_MAGIC = "MCFGARC";
+static const uint32 ARCHIVE_MAGIC_SIZE = 8u;
+static const uint32 ARCHIVE_VERSION = 1u;
+static const uint32 ARCHIVE_HEADER_SIZE = 44u;
+
+/**
+ * Kinds of children in a subtree record.
+ */
+static const uint8 ARCHIVE_LEAF = 0u;
+static const uint8 ARCHIVE_NODE = 1u;
+
+/**
+ * Largest size of a record and of each write into the archive file, whose sizes are uint32.
+ */
+static const uint64 ARCHIVE_MAX_CHUNK_SIZE = 0x40000000u;
+
+/**
+ * One entry of the file index.
+ */
+struct ArchiveIndexEntry {
+    const char8 *name;
+    uint32 root;
+};
+
+/**
+ * @brief Orders the ArchiveIndexEntry by name.
+ */
+struct ArchiveIndexEntryLess {
+    bool operator()(const ArchiveIndexEntry &a, const ArchiveIndexEntry &b) const {
+        return (StringHelper::Compare(a.name, b.name) < 0);
+    }
+};
+
+/**
+ * @brief Writes the \a size bytes of \a data into \a file, in chunks of at most ARCHIVE_MAX_CHUNK_SIZE bytes.
+ */
+static bool WriteChunks(File &file, const char8 * const data, const uint64 size) {
+    bool ok = true;
+    uint64 written = 0u;
+    while ((written < size) && (ok)) {
+        uint64 remaining = size - written;
+        uint32 chunkSize = static_cast<uint32>((remaining < ARCHIVE_MAX_CHUNK_SIZE) ? remaining : ARCHIVE_MAX_CHUNK_SIZE);
+        ok = file.Write(&data[written], chunkSize);
+        written += chunkSize;
+    }
+    return ok;
+}
+
+/**
+ * @brief Builds a content-addressed archive: each node of each configuration is serialised (with its children nodes replaced by the
+ * identifiers of their records) and only stored if no identical record was already stored.
+ * @details As the children are always stored before their parent, two identical subtrees always have identical records, so that
+ * the hash of a record identifies the whole subtree (i.e. it is a Merkle tree).
+ */
+class ConfigurationArchiveWriter {
+public:
+    ConfigurationArchiveWriter() {
+        numberOfSubtrees = 0u;
+        subtreesCapacity = 0u;
+        offsets = NULL_PTR(uint64 *);
+        hashes = NULL_PTR(uint64 *);
+        tableSize = 0u;
+        table = NULL_PTR(uint32 *);
+        numberOfFiles = 0u;
+        filesCapacity = 0u;
+        fileNames = NULL_PTR(StreamString *);
+        fileRoots = NULL_PTR(uint32 *);
+        numberOfNodes = 0u;
+        Grow();
+    }
+
+    ~ConfigurationArchiveWriter() {
+        delete [] offsets;
+        delete [] hashes;
+        delete [] table;
+        if (fileNames != NULL_PTR(StreamString *)) {
+            delete [] fileNames;
+        }
+        if (fileRoots != NULL_PTR(uint32 *)) {
+            delete [] fileRoots;
+        }
+    }
+
+    /**
+     * @brief Adds the configuration \a cdb (from its root) with the name \a name. Repeated names are rejected by Write.
+     */
+    bool AddFile(const char8 * const name, ConfigurationDatabase &cdb) {
+        uint32 i;
+        uint32 root = 0u;
+        bool ok = cdb.MoveToRoot();
+        if (ok) {
+            ok = StoreNode(cdb, root);
+        }
+        if (ok) {
+            if (numberOfFiles == filesCapacity) {
+                uint32 newCapacity = (filesCapacity == 0u) ? 64u : (filesCapacity * 2u);
+                StreamString *newNames = new StreamString[newCapacity];
+                uint32 *newRoots = new uint32[newCapacity];
+                for (i=0u; i<numberOfFiles; i++) {
+                    newNames[i] = fileNames[i];
+                    newRoots[i] = fileRoots[i];
+                }
+                if (fileNames != NULL_PTR(StreamString *)) {
+                    delete [] fileNames;
+                }
+                if (fileRoots != NULL_PTR(uint32 *)) {
+                    delete [] fileRoots;
+                }
+                fileNames = newNames;
+                fileRoots = newRoots;
+                filesCapacity = newCapacity;
+            }
+            fileNames[numberOfFiles] = name;
+            fileRoots[numberOfFiles] = root;
+            numberOfFiles++;
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Writes the archive into \a archiveFilename (which is replaced). The file index is sorted by name.
+     * @return false if a file name was added more than once or if the archive could not be written.
+     */
+    bool Write(const char8 * const archiveFilename) {
+        ArchiveIndexEntry *sorted = new ArchiveIndexEntry[(numberOfFiles > 0u) ? numberOfFiles : 1u];
+        uint32 i;
+        for (i=0u; i<numberOfFiles; i++) {
+            sorted[i].name = fileNames[i].Buffer();
+            sorted[i].root = fileRoots[i];
+        }
+        BinaryRecord::MergeSort(sorted, numberOfFiles, ArchiveIndexEntryLess());
+        bool ok = true;
+        for (i=1u; (i<numberOfFiles) && (ok); i++) {
+            ok = (StringHelper::Compare(sorted[i - 1u].name, sorted[i].name) != 0);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "File %s was added more than once\n", sorted[i].name);
+            }
+        }
+        StreamString header;
+        char8 magic[ARCHIVE_MAGIC_SIZE];
+        (void) MemoryOperationsHelper::Set(&magic[0], '\0', ARCHIVE_MAGIC_SIZE);
+        (void) StringHelper::Copy(&magic[0], ARCHIVE_MAGIC);
+        uint32 magicSize = ARCHIVE_MAGIC_SIZE;
+        (void) header.Write(&magic[0], magicSize);
+        uint64 offsetsOffset = ARCHIVE_HEADER_SIZE + data.Size();
+        uint64 indexOffset = offsetsOffset + (static_cast<uint64>(numberOfSubtrees) * sizeof(uint64));
+        BinaryRecord::AppendValue(header, ARCHIVE_VERSION);
+        BinaryRecord::AppendValue(header, numberOfSubtrees);
+        BinaryRecord::AppendValue(header, numberOfFiles);
+        BinaryRecord::AppendValue(header, static_cast<uint64>(ARCHIVE_HEADER_SIZE));
+        BinaryRecord::AppendValue(header, offsetsOffset);
+        BinaryRecord::AppendValue(header, indexOffset);
+        StreamString index;
+        for (i=0u; i<numberOfSubtrees; i++) {
+            BinaryRecord::AppendValue(index, offsets[i]);
+        }
+        for (i=0u; i<numberOfFiles; i++) {
+            BinaryRecord::AppendValue(index, sorted[i].root);
+            BinaryRecord::AppendString(index, sorted[i].name);
+        }
+        delete [] sorted;
+
+        File outputFile;
+        if (ok) {
+            Directory d(archiveFilename);
+            d.Delete();
+            ok = outputFile.Open(archiveFilename, BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", archiveFilename);
+            }
+        }
+        if (ok) {
+            ok = WriteChunks(outputFile, header.Buffer(), header.Size());
+        }
+        if (ok) {
+            ok = WriteChunks(outputFile, data.Buffer(), data.Size());
+        }
+        if (ok) {
+            ok = WriteChunks(outputFile, index.Buffer(), index.Size());
+        }
+        if (ok) {
+            ok = outputFile.Flush();
+        }
+        if (outputFile.IsOpen()) {
+            (void) outputFile.Close();
+        }
+        return ok;
+    }
+
+    uint32 GetNumberOfFiles() const {
+        return numberOfFiles;
+    }
+
+    uint32 GetNumberOfSubtrees() const {
+        return numberOfSubtrees;
+    }
+
+    uint64 GetNumberOfNodes() const {
+        return numberOfNodes;
+    }
+
+    uint64 GetDataSize() const {
+        return data.Size();
+    }
+
+private:
+    /**
+     * @brief Stores the current node of \a cdb (and all its subtree) and returns its record identifier.
+     */
+    bool StoreNode(ConfigurationDatabase &cdb, uint32 &id) {
+        numberOfNodes++;
+        StreamString record;
+        uint32 numberOfChildren = cdb.GetNumberOfChildren();
+        BinaryRecord::AppendValue(record, numberOfChildren);
+        bool ok = true;
+        uint32 i;
+        for (i=0u; (i<numberOfChildren) && (ok); i++) {
+            const char8 *childName = cdb.GetChildName(i);
+            if (cdb.MoveToChild(i)) {
+                uint32 childId = 0u;
+                ok = StoreNode(cdb, childId);
+                if (ok) {
+                    ok = cdb.MoveToAncestor(1u);
+                }
+                BinaryRecord::AppendValue(record, ARCHIVE_NODE);
+                BinaryRecord::AppendString(record, childName);
+                BinaryRecord::AppendValue(record, childId);
+            }
+            else {
+                BinaryRecord::AppendValue(record, ARCHIVE_LEAF);
+                BinaryRecord::AppendString(record, childName);
+                ok = BinaryRecord::AppendTextLeaf(cdb, childName, record);
+                if (!ok) {
+                    REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to read the leaf %s\n", childName);
+                }
+            }
+        }
+        if (ok) {
+            //The records are hashed, compared and written with uint32 sizes
+            ok = (record.Size() <= ARCHIVE_MAX_CHUNK_SIZE);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Node %s is too large to be archived\n", cdb.GetName());
+            }
+        }
+        if (ok) {
+            id = FindOrInsert(record);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Gets the identifier of the stored record equal to \a record, storing it if it does not exist yet.
+     */
+    uint32 FindOrInsert(const StreamString &record) {
+        uint64 hash = HashFunction::Fnv1a(record.Buffer(), static_cast<uint32>(record.Size()));
+        uint32 slot = static_cast<uint32>(hash) & (tableSize - 1u);
+        uint32 id = numberOfSubtrees;
+        bool found = false;
+        while ((table[slot] != EMPTY_SLOT) && (!found)) {
+            uint32 candidate = table[slot];
+            if (hashes[candidate] == hash) {
+                uint64 candidateEnd = ((candidate + 1u) < numberOfSubtrees) ? offsets[candidate + 1u] : data.Size();
+                //Confirm, so that hash collisions cannot corrupt the archive
+                if ((candidateEnd - offsets[candidate]) == record.Size()) {
+                    found = (MemoryOperationsHelper::Compare(&(data.Buffer()[offsets[candidate]]), record.Buffer(), static_cast<uint32>(record.Size())) == 0);
+                }
+            }
+            if (found) {
+                id = candidate;
+            }
+            else {
+                slot = (slot + 1u) & (tableSize - 1u);
+            }
+        }
+        if (!found) {
+            if (numberOfSubtrees == subtreesCapacity) {
+                Grow();
+                //The table was rebuilt
+                slot = static_cast<uint32>(hash) & (tableSize - 1u);
+                while (table[slot] != EMPTY_SLOT) {
+                    slot = (slot + 1u) & (tableSize - 1u);
+                }
+            }
+            id = numberOfSubtrees;
+            offsets[id] = data.Size();
+            hashes[id] = hash;
+            table[slot] = id;
+            uint32 size = static_cast<uint32>(record.Size());
+            (void) data.Write(record.Buffer(), size);
+            numberOfSubtrees++;
+        }
+        return id;
+    }
+
+    /**
+     * @brief Doubles the capacity of the records and rebuilds the hash table (which is kept at most half full).
+     */
+    void Grow() {
+        uint32 newCapacity = (subtreesCapacity == 0u) ? 1024u : (subtreesCapacity * 2u);
+        uint64 *newOffsets = new uint64[newCapacity];
+        uint64 *newHashes = new uint64[newCapacity];
+        uint32 i;
+        for (i=0u; i<numberOfSubtrees; i++) {
+            newOffsets[i] = offsets[i];
+            newHashes[i] = hashes[i];
+        }
+        if (offsets != NULL_PTR(uint64 *)) {
+            delete [] offsets;
+        }
+        if (hashes != NULL_PTR(uint64 *)) {
+            delete [] hashes;
+        }
+        offsets = newOffsets;
+        hashes = newHashes;
+        subtreesCapacity = newCapacity;
+        if (table != NULL_PTR(uint32 *)) {
+            delete [] table;
+        }
+        tableSize = newCapacity * 2u;
+        table = new uint32[tableSize];
+        for (i=0u; i<tableSize; i++) {
+            table[i] = EMPTY_SLOT;
+        }
+        for (i=0u; i<numberOfSubtrees; i++) {
+            uint32 slot = static_cast<uint32>(hashes[i]) & (tableSize - 1u);
+            while (table[slot] != EMPTY_SLOT) {
+                slot = (slot + 1u) & (tableSize - 1u);
+            }
+            table[slot] = i;
+        }
+    }
+
+    static const uint32 EMPTY_SLOT = 0xFFFFFFFFu;
+
+    /**
+     * All the unique records, their offsets (in data) and hashes.
+     */
+    StreamString data;
+    uint64 *offsets;
+    uint64 *hashes;
+    uint32 numberOfSubtrees;
+    uint32 subtreesCapacity;
+
+    /**
+     * Open addressing table, indexed by record hash, with the record identifiers.
+     */
+    uint32 *table;
+    uint32 tableSize;
+
+    StreamString *fileNames;
+    uint32 *fileRoots;
+    uint32 numberOfFiles;
+    uint32 filesCapacity;
+    uint64 numberOfNodes;
+};
+
+/**
+ * @brief Reads configurations from an archive written by the ConfigurationArchiveWriter.
+ * @details Only the file index is decoded when the archive is opened. Extracting a file only decodes the records reachable from its root.
+ */
+class ConfigurationArchiveReader {
+public:
+    ConfigurationArchiveReader() {
+        numberOfSubtrees = 0u;
+        numberOfFiles = 0u;
+        dataOffset = 0u;
+        offsetsOffset = 0u;
+        fileNames = NULL_PTR(StreamString *);
+        fileRoots = NULL_PTR(uint32 *);
+    }
+
+    ~ConfigurationArchiveReader() {
+        if (fileNames != NULL_PTR(StreamString *)) {
+            delete [] fileNames;
+        }
+        if (fileRoots != NULL_PTR(uint32 *)) {
+            delete [] fileRoots;
+        }
+    }
+
+    /**
+     * @brief Loads the archive \a archiveFilename and decodes its file index.
+     */
+    bool Open(const char8 * const archiveFilename) {
+        bool ok = ConfigurationCache::ReadFile(archiveFilename, content);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to read %s\n", archiveFilename);
+        }
+        if (ok) {
+            ok = (content.Size() >= ARCHIVE_HEADER_SIZE);
+        }
+        if (ok) {
+            ok = (StringHelper::CompareN(content.Buffer(), ARCHIVE_MAGIC, ARCHIVE_MAGIC_SIZE) == 0);
+        }
+        ByteReader reader(content.Buffer(), content.Size(), ARCHIVE_MAGIC_SIZE);
+        uint32 version = 0u;
+        uint64 indexOffset = 0u;
+        if (ok) {
+            ok = reader.ReadValue(version);
+        }
+        if (ok) {
+            ok = (version == ARCHIVE_VERSION);
+        }
+        if (ok) {
+            ok = reader.ReadValue(numberOfSubtrees);
+        }
+        if (ok) {
+            ok = reader.ReadValue(numberOfFiles);
+        }
+        if (ok) {
+            ok = reader.ReadValue(dataOffset);
+        }
+        if (ok) {
+            ok = reader.ReadValue(offsetsOffset);
+        }
+        if (ok) {
+            ok = reader.ReadValue(indexOffset);
+        }
+        if (ok) {
+            ok = ((offsetsOffset + (static_cast<uint64>(numberOfSubtrees) * sizeof(uint64))) <= content.Size());
+        }
+        if (ok) {
+            ok = reader.SetOffset(indexOffset);
+        }
+        if (ok) {
+            //Each entry takes at least 8 bytes, which bounds the allocation
+            ok = (numberOfFiles <= (reader.GetRemainingSize() / 8u));
+        }
+        if (ok) {
+            fileNames = new StreamString[numberOfFiles];
+            fileRoots = new uint32[numberOfFiles];
+            uint32 i;
+            for (i=0u; (i<numberOfFiles) && (ok); i++) {
+                ok = reader.ReadValue(fileRoots[i]);
+                if (ok) {
+                    ok = reader.ReadString(fileNames[i]);
+                }
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s is not a valid archive\n", archiveFilename);
+        }
+        return ok;
+    }
+
+    uint32 GetNumberOfFiles() const {
+        return numberOfFiles;
+    }
+
+    uint32 GetNumberOfSubtrees() const {
+        return numberOfSubtrees;
+    }
+
+    const char8 *GetFileName(const uint32 idx) const {
+        return fileNames[idx].Buffer();
+    }
+
+    /**
+     * @brief Decodes the file \a name (binary search in the sorted index) into \a cdb.
+     */
+    bool Extract(const char8 * const name, ConfigurationDatabase &cdb) {
+        uint32 first = 0u;
+        uint32 last = numberOfFiles;
+        bool found = false;
+        uint32 idx = 0u;
+        while ((first < last) && (!found)) {
+            idx = first + ((last - first) / 2u);
+            int32 cmp = StringHelper::Compare(fileNames[idx].Buffer(), name);
+            found = (cmp == 0);
+            if (cmp < 0) {
+                first = idx + 1u;
+            }
+            else if (cmp > 0) {
+                last = idx;
+            }
+            else {
+                //Found
+            }
+        }
+        bool ok = found;
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "File %s is not in the archive\n", name);
+        }
+        if (ok) {
+            ok = cdb.MoveToRoot();
+        }
+        if (ok) {
+            ok = Decode(fileRoots[idx], cdb);
+        }
+        if (ok) {
+            ok = cdb.MoveToRoot();
+        }
+        return ok;
+    }
+
+private:
+    /**
+     * @brief Decodes the record \a id into the current node of \a cdb. The children records always have a lower identifier than their parents.
+     */
+    bool Decode(const uint32 id, ConfigurationDatabase &cdb) {
+        bool ok = (id < numberOfSubtrees);
+        ByteReader reader(content.Buffer(), content.Size(), offsetsOffset + (static_cast<uint64>(id) * sizeof(uint64)));
+        uint64 recordOffset = 0u;
+        if (ok) {
+            ok = reader.ReadValue(recordOffset);
+        }
+        if (ok) {
+            ok = reader.SetOffset(dataOffset + recordOffset);
+        }
+        uint32 numberOfChildren = 0u;
+        if (ok) {
+            ok = reader.ReadValue(numberOfChildren);
+        }
+        uint32 i;
+        for (i=0u; (i<numberOfChildren) && (ok); i++) {
+            uint8 kind = ARCHIVE_LEAF;
+            StreamString name;
+            ok = reader.ReadValue(kind);
+            if (ok) {
+                ok = reader.ReadString(name);
+            }
+            if ((ok) && (kind == ARCHIVE_NODE)) {
+                uint32 childId = 0u;
+                ok = reader.ReadValue(childId);
+                if (ok) {
+                    ok = (childId < id);
+                }
+                if (ok) {
+                    ok = cdb.CreateRelative(name.Buffer());
+                }
+                if (ok) {
+                    ok = Decode(childId, cdb);
+                }
+                if (ok) {
+                    ok = cdb.MoveToAncestor(1u);
+                }
+            }
+            else if (ok) {
+                ok = BinaryRecord::ReadTextLeaf(reader, name.Buffer(), cdb);
+            }
+            else {
+                //Failed
+            }
+        }
+        return ok;
+    }
+
+    StreamString content;
+    uint32 numberOfSubtrees;
+    uint32 numberOfFiles;
+    uint64 dataOffset;
+    uint64 offsetsOffset;
+    StreamString *fileNames;
+    uint32 *fileRoots;
+};
+
+/**
+ * One configuration file to be added to the archive.
+ */
+struct PackInput {
+    StreamString filename;
+    StreamString format;
+    ConfigurationDatabase cdb;
+};
+
+/**
+ * @brief Parses the PackInput with index \a jobIndex (of the array \a context).
+ */
+static bool ParseInputJob(void * const context, const uint32 jobIndex) {
+    PackInput *input = &(static_cast<PackInput *>(context)[jobIndex]);
+    Diagnostics::SetContext(input->filename.Buffer());
+    StreamString content;
+    bool ok = ConfigurationCache::ReadFile(input->filename.Buffer(), content);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", input->filename.Buffer());
+    }
+    if (ok) {
+        StreamString parserError;
+        ok = ConfigurationCache::Parse(content, input->format.Buffer(), input->cdb, parserError, 1u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to parse %s: %s\n", input->filename.Buffer(), parserError.Buffer());
+        }
+    }
+    Diagnostics::SetContext(NULL_PTR(const char8 *));
+    return ok;
+}
+
+/**
+ * @brief Packs the \a numberOfFiles configuration files \a filenames into \a archiveFilename.
+ * @details The files are parsed concurrently, in batches (so that only a batch of parsed configurations is in memory at any time), and added to the archive in order.
+ */
+static bool Pack(const char8 * const archiveFilename, const char8 * const inputFormat, char8 ** const filenames, const uint32 numberOfFiles) {
+    ConfigurationArchiveWriter writer;
+    ParallelJobRunner runner;
+    const uint32 batchSize = runner.GetNumberOfThreads() * 4u;
+    bool ok = true;
+    uint32 first;
+    for (first=0u; (first<numberOfFiles) && (ok); first += batchSize) {
+        uint32 size = ((numberOfFiles - first) < batchSize) ? (numberOfFiles - first) : batchSize;
+        PackInput *inputs = new PackInput[size];
+        uint32 i;
+        for (i=0u; i<size; i++) {
+            inputs[i].filename = filenames[first + i];
+            inputs[i].format = inputFormat;
+        }
+        ok = runner.Run(&ParseInputJob, inputs, size);
+        for (i=0u; (i<size) && (ok); i++) {
+            ok = writer.AddFile(inputs[i].filename.Buffer(), inputs[i].cdb);
+        }
+        delete [] inputs;
+    }
+    if (ok) {
+        ok = writer.Write(archiveFilename);
+    }
+    if (ok) {
+        printf("%u files, %llu nodes, %u unique subtrees, %llu bytes of subtree records\n", writer.GetNumberOfFiles(), writer.GetNumberOfNodes(), writer.GetNumberOfSubtrees(), writer.GetDataSize());
+    }
+    return ok;
+}
+
+/**
+ * @brief Prints \a cdb into the file \a outputFilename (which is replaced) using the \a outputFormat (json, xml or cdb).
+ */
+static bool PrintConfigurationToFile(ConfigurationDatabase &cdb, const StreamString &outputFilename, const StreamString &outputFormat) {
+    Directory d(outputFilename.Buffer());
+    d.Delete();
+    File outputFile;
+    bool ok = outputFile.Open(outputFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", outputFilename.Buffer());
+    }
+    StreamStructuredDataI *sdata = NULL_PTR(StreamStructuredDataI *);
+    if (ok) {
+        if (outputFormat == "xml") {
+            sdata = new StreamStructuredData<XMLPrinter>(outputFile);
+        }
+        else if (outputFormat == "json") {
+            sdata = new StreamStructuredData<JsonPrinter>(outputFile);
+            dynamic_cast<StreamStructuredData<JsonPrinter> *>(sdata)->GetPrinter()->PrintBegin();
+        }
+        else if (outputFormat == "cdb") {
+            sdata = new StreamStructuredData<StandardPrinter>(outputFile);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown output format specified");
+            ok = false;
+        }
+    }
+    if (ok) {
+        ok = cdb.Copy(*sdata);
+    }
+    if ((ok) && (outputFormat == "json")) {
+        dynamic_cast<StreamStructuredData<JsonPrinter> *>(sdata)->GetPrinter()->PrintEnd();
+    }
+    if (ok) {
+        ok = outputFile.Flush();
+    }
+    if (outputFile.IsOpen()) {
+        (void) outputFile.Close();
+    }
+    if (sdata != NULL_PTR(StreamStructuredDataI *)) {
+        delete sdata;
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+int main(int argc, char **argv) {
+    Diagnostics::Install();
+    const char8 *args = "-c ARCHIVE -if json|xml|cdb INPUT_FILE... | -l ARCHIVE | -x ARCHIVE -n FILE_NAME -o OUTPUT_FILE -of json|xml|cdb";
+    StreamString mode;
+    if (argc > 2) {
+        mode = argv[1];
+    }
+    bool ok = true;
+    if ((mode == "-c") && (argc > 5)) {
+        ok = (StreamString("-if") == argv[3]);
+        if (ok) {
+            ok = Pack(argv[2], argv[4], &argv[5], static_cast<uint32>(argc - 5));
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
+        }
+    }
+    else if ((mode == "-l") && (argc == 3)) {
+        ConfigurationArchiveReader reader;
+        ok = reader.Open(argv[2]);
+        uint32 i;
+        for (i=0u; (i<reader.GetNumberOfFiles()) && (ok); i++) {
+            printf("%s\n", reader.GetFileName(i));
+        }
+    }
+    else if ((mode == "-x") && (argc == 9)) {
+        StreamString fileName;
+        StreamString outputFilename;
+        StreamString outputFormat;
+        ok = ParseArgument(argc, argv, "-n", fileName);
+        if (ok) {
+            ok = ParseArgument(argc, argv, "-o", outputFilename);
+        }
+        if (ok) {
+            ok = ParseArgument(argc, argv, "-of", outputFormat);
+        }
+        ConfigurationArchiveReader reader;
+        if (ok) {
+            ok = reader.Open(argv[2]);
+        }
+        ConfigurationDatabase cdb;
+        if (ok) {
+            ok = reader.Extract(fileName.Buffer(), cdb);
+        }
+        if (ok) {
+            ok = PrintConfigurationToFile(cdb, outputFilename, outputFormat);
+        }
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
+        ok = false;
+    }
+    int32 ret = ok ? 0 : -1;
+    return ret;
+}
+
@@ -0,0 +1,599 @@
+/**
+ * @file CfgDiff.cpp
+ * @brief Source file for main file CfgDiff
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class Playground (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/**
+ * Structural differences between two configuration files (in any of the supported formats)
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationDatabase.h"
+#include "ConfigurationHashTree.h"
+#include "Diagnostics.h"
+#include "Directory.h"
+#include "File.h"
+#include "ParallelJobRunner.h"
+#include "StaticList.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+static bool ParseArgument(uint32 nargs, char8 **args, StreamString flag, StreamString &arg, bool required = true) {
+    bool found = false;
+    for (uint32 i=1u; (i<(nargs - 1u) && (!found)); i++) {
+        found = (flag == args[i]);
+        if (found) {
+            arg = args[i + 1];
+        }
+    }
+    if ((!found) && (required)) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Input parameter %s not found\n", flag.Buffer());
+    }
+    return found;
+}
+
+/**
+ * One of the two configurations being compared.
+ */
+struct DiffInput {
+    StreamString filename;
+    StreamString format;
+    ConfigurationDatabase cdb;
+    ConfigurationHashTree tree;
+};
+
+/**
+ * @brief Parses the DiffInput with index \a jobIndex (of the array \a context) and builds its hash tree.
+ */
+static bool LoadInputJob(void * const context, const uint32 jobIndex) {
+    DiffInput *input = &(static_cast<DiffInput *>(context)[jobIndex]);
+    Diagnostics::SetContext(input->filename.Buffer());
+    StreamString content;
+    bool ok = ConfigurationCache::ReadFile(input->filename.Buffer(), content);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", input->filename.Buffer());
+    }
+    if (ok) {
+        StreamString parserError;
+        ok = ConfigurationCache::Parse(content, input->format.Buffer(), input->cdb, parserError);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to parse %s: %s\n", input->filename.Buffer(), parserError.Buffer());
+        }
+    }
+    if (ok) {
+        ok = input->tree.Build(input->cdb);
+    }
+    Diagnostics::SetContext(NULL_PTR(const char8 *));
+    return ok;
+}
+
+/**
+ * The kinds of differences.
+ */
+static const uint32 DIFF_ADDED = 0u;
+static const uint32 DIFF_REMOVED = 1u;
+static const uint32 DIFF_CHANGED = 2u;
+static const uint32 DIFF_MOVED = 3u;
+static const uint32 DIFF_UNCHANGED = 4u;
+
+/**
+ * One difference. idxA (idxB) is the node in the first (second) tree, or the number of nodes of that tree if not applicable.
+ */
+struct DiffEntry {
+    uint32 kind;
+    uint32 idxA;
+    uint32 idxB;
+};
+
+/**
+ * @brief Gets the node of \a tree with the same path of the node \a idxOther of \a other. Returns tree.GetNumberOfNodes() if it does not exist.
+ */
+static uint32 LocateInOther(const ConfigurationHashTree &tree, const ConfigurationHashTree &other, const uint32 idxOther) {
+    uint32 idx = tree.GetNumberOfNodes();
+    if (idxOther == 0u) {
+        idx = 0u;
+    }
+    else {
+        uint32 parent = LocateInOther(tree, other, other.GetParent(idxOther));
+        if (parent < tree.GetNumberOfNodes()) {
+            idx = tree.FindChild(parent, other.GetName(idxOther));
+        }
+    }
+    return idx;
+}
+
+/**
+ * @brief Computes the structural differences between two ConfigurationHashTree.
+ * @details The children of two nodes with the same path are matched by name (so that the order of the nodes is not relevant).
+ * Subtrees with the same hash are skipped without being visited. A removed subtree whose content is identical to an added subtree
+ * (e.g. because it was renamed or moved to another node) is reported as moved.
+ */
+class ConfigurationDiff {
+public:
+    ConfigurationDiff(const ConfigurationHashTree &treeAIn, const ConfigurationHashTree &treeBIn) :
+            treeA(treeAIn),
+            treeB(treeBIn) {
+    }
+
+    /**
+     * @brief Computes all the differences.
+     */
+    void Compute() {
+        Compare(0u, 0u);
+        MatchMoved();
+    }
+
+    uint32 GetNumberOfDifferences() const {
+        return differences.GetSize();
+    }
+
+    /**
+     * @brief Prints all the differences to stdout, one per line, prefixed with + (added), - (removed), ~ (changed) or > (moved).
+     */
+    void Print() const {
+        uint32 i;
+        for (i=0u; i<differences.GetSize(); i++) {
+            DiffEntry entry = differences[i];
+            StreamString pathA;
+            StreamString pathB;
+            if (entry.idxA < treeA.GetNumberOfNodes()) {
+                treeA.GetPath(entry.idxA, pathA);
+            }
+            if (entry.idxB < treeB.GetNumberOfNodes()) {
+                treeB.GetPath(entry.idxB, pathB);
+            }
+            if (entry.kind == DIFF_ADDED) {
+                printf("+ %s\n", pathB.Buffer());
+            }
+            else if (entry.kind == DIFF_REMOVED) {
+                printf("- %s\n", pathA.Buffer());
+            }
+            else if (entry.kind == DIFF_MOVED) {
+                printf("> %s -> %s\n", pathA.Buffer(), pathB.Buffer());
+            }
+            else if ((treeA.IsLeaf(entry.idxA)) && (treeB.IsLeaf(entry.idxB))) {
+                printf("~ %s: %s -> %s\n", pathB.Buffer(), treeA.GetValue(entry.idxA), treeB.GetValue(entry.idxB));
+            }
+            else {
+                printf("~ %s: %s -> %s\n", pathB.Buffer(), treeA.IsLeaf(entry.idxA) ? "leaf" : "node", treeB.IsLeaf(entry.idxB) ? "leaf" : "node");
+            }
+        }
+    }
+
+private:
+    static void Add(StaticList<DiffEntry> &list, const uint32 kind, const uint32 idxA, const uint32 idxB) {
+        DiffEntry entry;
+        entry.kind = kind;
+        entry.idxA = idxA;
+        entry.idxB = idxB;
+        (void) list.Add(entry);
+    }
+
+    /**
+     * @brief Looks for the child named \a name of \a idx, trying first the child at the same \a position.
+     */
+    static uint32 FindChild(const ConfigurationHashTree &tree, const uint32 idx, const char8 * const name, const uint32 position) {
+        uint32 found = tree.GetNumberOfNodes();
+        if (position < tree.GetNumberOfChildren(idx)) {
+            uint32 candidate = tree.GetFirstChild(idx) + position;
+            if (StreamString(tree.GetName(candidate)) == name) {
+                found = candidate;
+            }
+        }
+        if (found == tree.GetNumberOfNodes()) {
+            found = tree.FindChild(idx, name);
+        }
+        return found;
+    }
+
+    void Compare(const uint32 idxA, const uint32 idxB) {
+        //Identical subtrees are skipped in O(1)
+        if (treeA.GetHash(idxA) != treeB.GetHash(idxB)) {
+            uint32 i;
+            for (i=0u; i<treeA.GetNumberOfChildren(idxA); i++) {
+                uint32 childA = treeA.GetFirstChild(idxA) + i;
+                uint32 childB = FindChild(treeB, idxB, treeA.GetName(childA), i);
+                if (childB == treeB.GetNumberOfNodes()) {
+                    Add(candidates, DIFF_REMOVED, childA, treeB.GetNumberOfNodes());
+                }
+                else if ((treeA.IsLeaf(childA)) || (treeB.IsLeaf(childB))) {
+                    if ((treeA.IsLeaf(childA) != treeB.IsLeaf(childB)) || (treeA.GetHash(childA) != treeB.GetHash(childB))) {
+                        Add(candidates, DIFF_CHANGED, childA, childB);
+                    }
+                }
+                else {
+                    Compare(childA, childB);
+                }
+            }
+            for (i=0u; i<treeB.GetNumberOfChildren(idxB); i++) {
+                uint32 childB = treeB.GetFirstChild(idxB) + i;
+                if (FindChild(treeA, idxA, treeB.GetName(childB), i) == treeA.GetNumberOfNodes()) {
+                    Add(candidates, DIFF_ADDED, treeA.GetNumberOfNodes(), childB);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Replaces each pair of removed and added subtrees (not leaves) with the same hash by a single moved entry.
+     */
+    void MatchMoved() {
+        uint32 numberOfCandidates = candidates.GetSize();
+        //Open addressing table with the added subtrees, indexed by hash
+        uint32 tableSize = 16u;
+        while (tableSize < (numberOfCandidates * 2u)) {
+            tableSize *= 2u;
+        }
+        uint32 *table = new uint32[tableSize];
+        uint32 i;
+        for (i=0u; i<tableSize; i++) {
+            table[i] = numberOfCandidates;
+        }
+        for (i=0u; i<numberOfCandidates; i++) {
+            DiffEntry entry = candidates[i];
+            if ((entry.kind == DIFF_ADDED) && (!treeB.IsLeaf(entry.idxB))) {
+                uint32 slot = static_cast<uint32>(treeB.GetHash(entry.idxB)) & (tableSize - 1u);
+                while (table[slot] != numberOfCandidates) {
+                    slot = (slot + 1u) & (tableSize - 1u);
+                }
+                table[slot] = i;
+            }
+        }
+        bool *matched = new bool[numberOfCandidates];
+        uint32 *movedTo = new uint32[numberOfCandidates];
+        for (i=0u; i<numberOfCandidates; i++) {
+            matched[i] = false;
+            movedTo[i] = numberOfCandidates;
+        }
+        for (i=0u; i<numberOfCandidates; i++) {
+            DiffEntry entry = candidates[i];
+            if ((entry.kind == DIFF_REMOVED) && (!treeA.IsLeaf(entry.idxA))) {
+                uint64 hash = treeA.GetHash(entry.idxA);
+                uint32 slot = static_cast<uint32>(hash) & (tableSize - 1u);
+                while ((table[slot] != numberOfCandidates) && (movedTo[i] == numberOfCandidates)) {
+                    uint32 candidate = table[slot];
+                    if ((!matched[candidate]) && (treeB.GetHash(candidates[candidate].idxB) == hash)) {
+                        matched[candidate] = true;
+                        movedTo[i] = candidate;
+                    }
+                    slot = (slot + 1u) & (tableSize - 1u);
+                }
+            }
+        }
+        for (i=0u; i<numberOfCandidates; i++) {
+            DiffEntry entry = candidates[i];
+            if (movedTo[i] < numberOfCandidates) {
+                Add(differences, DIFF_MOVED, entry.idxA, candidates[movedTo[i]].idxB);
+            }
+            else if (!matched[i]) {
+                Add(differences, entry.kind, entry.idxA, entry.idxB);
+            }
+            else {
+                //The target of a moved subtree
+            }
+        }
+        delete [] movedTo;
+        delete [] matched;
+        delete [] table;
+    }
+
+    const ConfigurationHashTree &treeA;
+    const ConfigurationHashTree &treeB;
+
+    /**
+     * The differences before the moved subtrees are matched.
+     */
+    StaticList<DiffEntry> candidates;
+
+    /**
+     * The final differences.
+     */
+    StaticList<DiffEntry> differences;
+};
+
+/**
+ * @brief Gets the fill colour which highlights the given kind of difference.
+ */
+static const char8 *GetDiffColor(const uint32 kind) {
+    const char8 *color = "white";
+    if (kind == DIFF_ADDED) {
+        color = "palegreen";
+    }
+    else if (kind == DIFF_REMOVED) {
+        color = "lightcoral";
+    }
+    else if (kind == DIFF_CHANGED) {
+        color = "orange";
+    }
+    else {
+        //Unchanged
+    }
+    return color;
+}
+
+/**
+ * @brief Gets the kind of difference of the node \a idx of \a tree when compared with \a other.
+ * @param[in] removedSide true if \a tree is the first configuration (so that missing nodes in the other are removed and not added).
+ */
+static uint32 GetNodeDiff(const ConfigurationHashTree &tree, const ConfigurationHashTree &other, const uint32 idx, const bool removedSide) {
+    uint32 kind = DIFF_UNCHANGED;
+    uint32 otherIdx = LocateInOther(other, tree, idx);
+    if (otherIdx == other.GetNumberOfNodes()) {
+        kind = removedSide ? DIFF_REMOVED : DIFF_ADDED;
+    }
+    else if (other.GetHash(otherIdx) != tree.GetHash(idx)) {
+        kind = DIFF_CHANGED;
+    }
+    else {
+        //Unchanged
+    }
+    return kind;
+}
+
+/**
+ * @brief Gets the name of the node \a idx without the + or $ prefix.
+ */
+static const char8 *GetNodeName(const ConfigurationHashTree &tree, const uint32 idx) {
+    const char8 *name = tree.GetName(idx);
+    if ((name[0] == '+') || (name[0] == '$')) {
+        name = &name[1];
+    }
+    return name;
+}
+
+/**
+ * @brief Writes the edges between the function \a idx and the data sources of its InputSignals and OutputSignals.
+ */
+static void WriteFunctionEdges(StreamString &edges, const ConfigurationHashTree &tree, const uint32 idx, const char8 * const functionId, const char8 * const defaultDataSource, const char8 * const edgeStyle) {
+    StreamString connected = "|";
+    uint32 d;
+    for (d=0u; d<2u; d++) {
+        bool input = (d == 0u);
+        uint32 signals = tree.FindChild(idx, input ? "InputSignals" : "OutputSignals");
+        if (signals < tree.GetNumberOfNodes()) {
+            uint32 s;
+            for (s=0u; s<tree.GetNumberOfChildren(signals); s++) {
+                uint32 signal = tree.GetFirstChild(signals) + s;
+                if (!tree.IsLeaf(signal)) {
+                    const char8 *dataSource = tree.GetLeafValue(signal, "DataSource");
+                    if (dataSource == NULL_PTR(const char8 *)) {
+                        dataSource = defaultDataSource;
+                    }
+                    if (dataSource != NULL_PTR(const char8 *)) {
+                        StreamString token;
+                        token.Printf("%s%s|", input ? "<" : ">", dataSource);
+                        if (connected.Locate(token) < 0) {
+                            connected += token.Buffer();
+                            if (input) {
+                                edges.Printf("\"D_%s\" -> \"F_%s\" [style=%s]\n", dataSource, functionId, edgeStyle);
+                            }
+                            else {
+                                edges.Printf("\"F_%s\" -> \"D_%s\" [style=%s]\n", functionId, dataSource, edgeStyle);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Writes the functions below \a idx (recursing into ReferenceContainer nodes), highlighted by their kind of difference.
+ * @param[in] removedSide true if \a tree is the first configuration, in which case only the removed functions are written.
+ */
+static void WriteFunctions(File &outputFile, StreamString &edges, const ConfigurationHashTree &tree, const ConfigurationHashTree &other, const uint32 idx, const bool removedSide, const char8 * const defaultDataSource, StreamString prefix) {
+    uint32 f;
+    for (f=0u; f<tree.GetNumberOfChildren(idx); f++) {
+        uint32 function = tree.GetFirstChild(idx) + f;
+        if (!tree.IsLeaf(function)) {
+            const char8 *className = tree.GetLeafValue(function, "Class");
+            if (className == NULL_PTR(const char8 *)) {
+                className = "";
+            }
+            StreamString qualifiedName = prefix;
+            qualifiedName.Printf("%s", GetNodeName(tree, function));
+            if (StreamString(className) == "ReferenceContainer") {
+                StreamString childPrefix = qualifiedName;
+                childPrefix.Printf("%s", ".");
+                WriteFunctions(outputFile, edges, tree, other, function, removedSide, defaultDataSource, childPrefix);
+            }
+            else {
+                uint32 kind = GetNodeDiff(tree, other, function, removedSide);
+                if ((!removedSide) || (kind == DIFF_REMOVED)) {
+                    outputFile.Printf("\"F_%s\" [label=\"{%s|%s}\", fillcolor=\"%s\"%s]\n", qualifiedName.Buffer(), qualifiedName.Buffer(), className, GetDiffColor(kind), removedSide ? ", style=\"filled,dashed\"" : "");
+                    WriteFunctionEdges(edges, tree, function, qualifiedName.Buffer(), defaultDataSource, removedSide ? "dashed" : "solid");
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Writes the data sources below \a idx, highlighted by their kind of difference.
+ * @param[in] removedSide true if \a tree is the first configuration, in which case only the removed data sources are written.
+ */
+static void WriteDataSources(File &outputFile, const ConfigurationHashTree &tree, const ConfigurationHashTree &other, const uint32 idx, const bool removedSide) {
+    uint32 d;
+    for (d=0u; d<tree.GetNumberOfChildren(idx); d++) {
+        uint32 dataSource = tree.GetFirstChild(idx) + d;
+        if (!tree.IsLeaf(dataSource)) {
+            const char8 *className = tree.GetLeafValue(dataSource, "Class");
+            if (className == NULL_PTR(const char8 *)) {
+                className = "";
+            }
+            uint32 kind = GetNodeDiff(tree, other, dataSource, removedSide);
+            if ((!removedSide) || (kind == DIFF_REMOVED)) {
+                outputFile.Printf("\"D_%s\" [label=\"{%s|%s}\", fillcolor=\"%s\"%s]\n", GetNodeName(tree, dataSource), GetNodeName(tree, dataSource), className, GetDiffColor(kind), removedSide ? ", style=\"filled,dashed\"" : "");
+            }
+        }
+    }
+}
+
+/**
+ * @brief Exports the GAMs and DataSources of the RealTimeApplication \a appB (of the second configuration) in the graph file \a outputFilename,
+ * highlighting the ones that were added (green), changed (orange) and removed (red, dashed) with respect to the first configuration.
+ */
+static bool ExportHighlightedRTAppGraph(StreamString outputFilename, const ConfigurationHashTree &treeA, const ConfigurationHashTree &treeB, const uint32 appB) {
+    uint32 appA = LocateInOther(treeA, treeB, appB);
+    //Delete any existent output file
+    Directory d(outputFilename.Buffer());
+    d.Delete();
+    File outputFile;
+    bool ok = outputFile.Open(outputFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", outputFilename.Buffer());
+    }
+    if (ok) {
+        outputFile.Printf("%s", "digraph G {\n");
+        outputFile.Printf("%s", "rankdir=LR\n");
+        outputFile.Printf("%s", "concentrate=true\n");
+        outputFile.Printf("%s", "node [shape=record, style=filled, fillcolor=white, color=black]\n");
+        StreamString edges;
+        uint32 dataB = treeB.FindChild(appB, "+Data");
+        const char8 *defaultDataSource = NULL_PTR(const char8 *);
+        if (dataB < treeB.GetNumberOfNodes()) {
+            defaultDataSource = treeB.GetLeafValue(dataB, "DefaultDataSource");
+            WriteDataSources(outputFile, treeB, treeA, dataB, false);
+        }
+        uint32 functionsB = treeB.FindChild(appB, "+Functions");
+        if (functionsB < treeB.GetNumberOfNodes()) {
+            WriteFunctions(outputFile, edges, treeB, treeA, functionsB, false, defaultDataSource, "");
+        }
+        if (appA < treeA.GetNumberOfNodes()) {
+            uint32 dataA = treeA.FindChild(appA, "+Data");
+            const char8 *defaultDataSourceA = NULL_PTR(const char8 *);
+            if (dataA < treeA.GetNumberOfNodes()) {
+                defaultDataSourceA = treeA.GetLeafValue(dataA, "DefaultDataSource");
+                WriteDataSources(outputFile, treeA, treeB, dataA, true);
+            }
+            uint32 functionsA = treeA.FindChild(appA, "+Functions");
+            if (functionsA < treeA.GetNumberOfNodes()) {
+                WriteFunctions(outputFile, edges, treeA, treeB, functionsA, true, defaultDataSourceA, "");
+            }
+        }
+        outputFile.Printf("%s", edges.Buffer());
+        outputFile.Printf("%s", "}\n");
+        outputFile.Flush();
+        outputFile.Close();
+    }
+    return ok;
+}
+
+/**
+ * @brief Exports one highlighted RTApp graph for each RealTimeApplication of the second configuration.
+ * @details The graph is named %sRTApp.gv (outputFilenamePrefix) or, if there is more than one application, %s%s_RTApp.gv (outputFilenamePrefix, application name).
+ */
+static bool ExportHighlightedRTAppGraphs(StreamString outputFilenamePrefix, const ConfigurationHashTree &treeA, const ConfigurationHashTree &treeB) {
+    uint32 numberOfApplications = 0u;
+    uint32 a;
+    for (a=0u; a<treeB.GetNumberOfChildren(0u); a++) {
+        const char8 *className = treeB.GetLeafValue(treeB.GetFirstChild(0u) + a, "Class");
+        if (className != NULL_PTR(const char8 *)) {
+            if (StreamString(className) == "RealTimeApplication") {
+                numberOfApplications++;
+            }
+        }
+    }
+    bool ok = (numberOfApplications > 0u);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not find the RealTimeApplication\n");
+    }
+    for (a=0u; (a<treeB.GetNumberOfChildren(0u)) && (ok); a++) {
+        uint32 app = treeB.GetFirstChild(0u) + a;
+        const char8 *className = treeB.GetLeafValue(app, "Class");
+        if (className != NULL_PTR(const char8 *)) {
+            if (StreamString(className) == "RealTimeApplication") {
+                StreamString outputFilename = outputFilenamePrefix;
+                if (numberOfApplications > 1u) {
+                    outputFilename.Printf("%s_", GetNodeName(treeB, app));
+                }
+                outputFilename.Printf("%s", "RTApp.gv");
+                ok = ExportHighlightedRTAppGraph(outputFilename, treeA, treeB, app);
+            }
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+int main(int argc, char **argv) {
+    Diagnostics::Install();
+    const char8 *args = "-a INPUT_FILE_A -af json|xml|cdb -b INPUT_FILE_B -bf json|xml|cdb [-o OUTPUT_FILE_PREFIX]";
+    if ((argc != 9) && (argc != 11)) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
+        return -1;
+    }
+    DiffInput inputs[2];
+    StreamString outputFilenamePrefix;
+    bool ok = ParseArgument(argc, argv, "-a", inputs[0].filename);
+    if (ok) {
+        ok = ParseArgument(argc, argv, "-af", inputs[0].format);
+    }
+    if (ok) {
+        ok = ParseArgument(argc, argv, "-b", inputs[1].filename);
+    }
+    if (ok) {
+        ok = ParseArgument(argc, argv, "-bf", inputs[1].format);
+    }
+    bool exportGraph = ParseArgument(argc, argv, "-o", outputFilenamePrefix, false);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
+        return -1;
+    }
+    if (ok) {
+        //Both files are parsed and hashed concurrently
+        ParallelJobRunner runner;
+        ok = runner.Run(&LoadInputJob, &inputs[0], 2u);
+    }
+    uint32 numberOfDifferences = 0u;
+    if (ok) {
+        ConfigurationDiff diff(inputs[0].tree, inputs[1].tree);
+        diff.Compute();
+        diff.Print();
+        numberOfDifferences = diff.GetNumberOfDifferences();
+    }
+    if ((ok) && (exportGraph)) {
+        ok = ExportHighlightedRTAppGraphs(outputFilenamePrefix, inputs[0].tree, inputs[1].tree);
+    }
+    //As diff: 0 if the configurations are equal, 1 if they are different
+    int32 ret = -1;
+    if (ok) {
+        ret = (numberOfDifferences > 0u) ? 1 : 0;
+    }
+    return ret;
+}
+
@@ -0,0 +1,1046 @@
+/**
+ * @file CfgLint.cpp
+ * @brief Source file for main file CfgLint
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class Playground (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/**
+ * Static validation of the RealTimeApplication (and StateMachine) configurations of a corpus of configuration files
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include "AdvancedErrorManagement.h"
+#include "BitSet.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationDatabase.h"
+#include "Diagnostics.h"
+#include "ParallelJobRunner.h"
+#include "StaticList.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * Index used when a function or DataSource could not be resolved.
+ */
+static const uint32 LINT_NONE = 0xFFFFFFFFu;
+
+/**
+ * @brief Returns \a name without its leading + or $ (if any).
+ */
+static const char8 *StripPrefix(const char8 * const name) {
+    const char8 *stripped = name;
+    if ((name[0] == '+') || (name[0] == '$')) {
+        stripped = &name[1];
+    }
+    return stripped;
+}
+
+/**
+ * @brief Returns \a parent.childName.
+ */
+static StreamString ChildPath(const StreamString &parent, const char8 * const childName) {
+    StreamString path;
+    if (parent.Size() > 0u) {
+        (void) path.Printf("%s.%s", parent.Buffer(), childName);
+    }
+    else {
+        path = childName;
+    }
+    return path;
+}
+
+/**
+ * A signal of a function (InputSignals/OutputSignals) or the declaration of a signal in a DataSource (Signals).
+ */
+struct LintSignal {
+    StreamString path;
+    StreamString name;
+    /**
+     * The DataSource, after applying the DefaultDataSource.
+     */
+    StreamString dataSource;
+    /**
+     * The name of the signal in the DataSource (the Alias, if set).
+     */
+    StreamString dataSourceSignal;
+    /**
+     * Empty if not set.
+     */
+    StreamString type;
+    /**
+     * Zero if not set.
+     */
+    uint32 numberOfElements;
+    /**
+     * Index of the function, or LINT_NONE for the declarations in a DataSource.
+     */
+    uint32 function;
+    bool isOutput;
+};
+
+/**
+ * A function (GAM) of a RealTimeApplication, with its name qualified by the ReferenceContainers which hold it.
+ */
+struct LintFunction {
+    StreamString path;
+    StreamString name;
+    StreamString className;
+};
+
+/**
+ * A DataSource of a RealTimeApplication and all the signals which refer to it.
+ */
+struct LintDataSource {
+    StreamString path;
+    StreamString name;
+    StreamString className;
+    StaticList<LintSignal *> usages;
+};
+
+/**
+ * A RealTimeThread and the entries of its Functions.
+ */
+struct LintThread {
+    StreamString path;
+    StreamString name;
+    uint32 state;
+    uint32 numberOfEntries;
+    StreamString *entries;
+};
+
+/**
+ * A RealTimeState and the functions executed by all of its threads.
+ */
+struct LintState {
+    StreamString path;
+    StreamString name;
+    BitSet functions;
+};
+
+/**
+ * @brief The model of a RealTimeApplication which is checked by the rules.
+ */
+class LintApplication {
+public:
+    LintApplication() {
+    }
+
+    ~LintApplication() {
+        uint32 i;
+        for (i = 0u; i < signals.GetSize(); i++) {
+            delete signals[i];
+        }
+        for (i = 0u; i < functions.GetSize(); i++) {
+            delete functions[i];
+        }
+        for (i = 0u; i < dataSources.GetSize(); i++) {
+            delete dataSources[i];
+        }
+        for (i = 0u; i < threads.GetSize(); i++) {
+            delete [] threads[i]->entries;
+            delete threads[i];
+        }
+        for (i = 0u; i < states.GetSize(); i++) {
+            delete states[i];
+        }
+    }
+
+    /**
+     * @brief Builds the model from \a cdb, which must point at the RealTimeApplication node with path \a pathIn.
+     */
+    bool Build(ConfigurationDatabase cdb, const StreamString &pathIn) {
+        path = pathIn;
+        name = StripPrefix(cdb.GetName());
+        ConfigurationDatabase cdbApp = cdb;
+        StreamString defaultDataSource;
+        bool ok = true;
+        //The DataSources are needed first, so that the signals can be linked to them
+        if (cdb.MoveRelative("+Data")) {
+            if (!cdb.Read("DefaultDataSource", defaultDataSource)) {
+                defaultDataSource = "";
+            }
+            StreamString dataPath = ChildPath(path, "+Data");
+            uint32 c;
+            uint32 numberOfChildren = cdb.GetNumberOfChildren();
+            for (c = 0u; (c < numberOfChildren) && (ok); c++) {
+                StreamString childName = cdb.GetChildName(c);
+                if (cdb.MoveRelative(childName.Buffer())) {
+                    LintDataSource *dataSource = new LintDataSource;
+                    dataSource->path = ChildPath(dataPath, childName.Buffer());
+                    dataSource->name = StripPrefix(childName.Buffer());
+                    if (!cdb.Read("Class", dataSource->className)) {
+                        dataSource->className = "";
+                    }
+                    ok = dataSources.Add(dataSource);
+                    if ((ok) && (cdb.MoveRelative("Signals"))) {
+                        ok = AddSignals(cdb, ChildPath(dataSource->path, "Signals"), LINT_NONE, false, dataSource->name);
+                        (void) cdb.MoveToAncestor(1u);
+                    }
+                    (void) cdb.MoveToAncestor(1u);
+                }
+            }
+        }
+        cdb = cdbApp;
+        if ((ok) && (cdb.MoveRelative("+Functions"))) {
+            ok = AddFunctions(cdb, ChildPath(path, "+Functions"), "", defaultDataSource);
+        }
+        cdb = cdbApp;
+        if ((ok) && (cdb.MoveRelative("+States"))) {
+            ok = AddStates(cdb, ChildPath(path, "+States"));
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Gets the index of the DataSource named \a dataSourceName, or LINT_NONE if it does not exist.
+     */
+    uint32 FindDataSource(const StreamString &dataSourceName) const {
+        uint32 found = LINT_NONE;
+        uint32 d;
+        for (d = 0u; (d < dataSources.GetSize()) && (found == LINT_NONE); d++) {
+            if (dataSources[d]->name == dataSourceName) {
+                found = d;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Sets in \a resolved the functions executed by the thread entry \a entry: the function with that qualified name or all
+     * the functions of the ReferenceContainer with that qualified name.
+     * @return true if at least one function was found.
+     */
+    bool ResolveFunctions(const StreamString &entry, BitSet &resolved) const {
+        resolved.SetSize(functions.GetSize());
+        const uint32 entrySize = static_cast<uint32>(entry.Size());
+        uint32 f;
+        for (f = 0u; f < functions.GetSize(); f++) {
+            const StreamString &functionName = functions[f]->name;
+            bool match = (functionName == entry);
+            if ((!match) && (functionName.Size() > entrySize)) {
+                match = (StringHelper::CompareN(functionName.Buffer(), entry.Buffer(), entrySize) == 0) && (functionName.Buffer()[entrySize] == '.');
+            }
+            if (match) {
+                resolved.Set(f);
+            }
+        }
+        return resolved.Any();
+    }
+
+    StreamString path;
+    StreamString name;
+    StaticList<LintSignal *> signals;
+    StaticList<LintFunction *> functions;
+    StaticList<LintDataSource *> dataSources;
+    StaticList<LintThread *> threads;
+    StaticList<LintState *> states;
+
+private:
+    /**
+     * @brief Adds all the signals of the InputSignals, OutputSignals or Signals node pointed by \a cdb.
+     * @param[in] defaultDataSource the DataSource of the signals which do not set one.
+     */
+    bool AddSignals(ConfigurationDatabase &cdb, const StreamString &signalsPath, const uint32 function, const bool isOutput, const StreamString &defaultDataSource) {
+        bool ok = true;
+        uint32 c;
+        uint32 numberOfChildren = cdb.GetNumberOfChildren();
+        for (c = 0u; (c < numberOfChildren) && (ok); c++) {
+            StreamString signalName = cdb.GetChildName(c);
+            if (cdb.MoveRelative(signalName.Buffer())) {
+                LintSignal *signal = new LintSignal;
+                signal->path = ChildPath(signalsPath, signalName.Buffer());
+                signal->name = signalName;
+                signal->function = function;
+                signal->isOutput = isOutput;
+                if (!cdb.Read("DataSource", signal->dataSource)) {
+                    signal->dataSource = defaultDataSource;
+                }
+                if (!cdb.Read("Alias", signal->dataSourceSignal)) {
+                    signal->dataSourceSignal = signalName;
+                }
+                if (!cdb.Read("Type", signal->type)) {
+                    signal->type = "";
+                }
+                if (!cdb.Read("NumberOfElements", signal->numberOfElements)) {
+                    signal->numberOfElements = 0u;
+                }
+                ok = signals.Add(signal);
+                uint32 d = FindDataSource(signal->dataSource);
+                if ((ok) && (d != LINT_NONE)) {
+                    ok = dataSources[d]->usages.Add(signal);
+                }
+                (void) cdb.MoveToAncestor(1u);
+            }
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Adds all the functions of the +Functions node (or of a ReferenceContainer inside it) pointed by \a cdb.
+     */
+    bool AddFunctions(ConfigurationDatabase &cdb, const StreamString &functionsPath, const StreamString &qualifiedPrefix, const StreamString &defaultDataSource) {
+        bool ok = true;
+        uint32 c;
+        uint32 numberOfChildren = cdb.GetNumberOfChildren();
+        for (c = 0u; (c < numberOfChildren) && (ok); c++) {
+            StreamString childName = cdb.GetChildName(c);
+            if (cdb.MoveRelative(childName.Buffer())) {
+                StreamString functionPath = ChildPath(functionsPath, childName.Buffer());
+                StreamString qualifiedName = ChildPath(qualifiedPrefix, StripPrefix(childName.Buffer()));
+                StreamString className;
+                if (!cdb.Read("Class", className)) {
+                    className = "";
+                }
+                if (className == "ReferenceContainer") {
+                    ok = AddFunctions(cdb, functionPath, qualifiedName, defaultDataSource);
+                }
+                else {
+                    LintFunction *function = new LintFunction;
+                    function->path = functionPath;
+                    function->name = qualifiedName;
+                    function->className = className;
+                    uint32 functionIndex = functions.GetSize();
+                    ok = functions.Add(function);
+                    if ((ok) && (cdb.MoveRelative("InputSignals"))) {
+                        ok = AddSignals(cdb, ChildPath(functionPath, "InputSignals"), functionIndex, false, defaultDataSource);
+                        (void) cdb.MoveToAncestor(1u);
+                    }
+                    if ((ok) && (cdb.MoveRelative("OutputSignals"))) {
+                        ok = AddSignals(cdb, ChildPath(functionPath, "OutputSignals"), functionIndex, true, defaultDataSource);
+                        (void) cdb.MoveToAncestor(1u);
+                    }
+                }
+                (void) cdb.MoveToAncestor(1u);
+            }
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Adds all the states (and their threads) of the +States node pointed by \a cdb.
+     */
+    bool AddStates(ConfigurationDatabase &cdb, const StreamString &statesPath) {
+        bool ok = true;
+        uint32 s;
+        uint32 numberOfStates = cdb.GetNumberOfChildren();
+        for (s = 0u; (s < numberOfStates) && (ok); s++) {
+            StreamString stateName = cdb.GetChildName(s);
+            if (cdb.MoveRelative(stateName.Buffer())) {
+                LintState *state = new LintState;
+                state->path = ChildPath(statesPath, stateName.Buffer());
+                state->name = StripPrefix(stateName.Buffer());
+                state->functions.SetSize(functions.GetSize());
+                uint32 stateIndex = states.GetSize();
+                ok = states.Add(state);
+                if ((ok) && (cdb.MoveRelative("+Threads"))) {
+                    StreamString threadsPath = ChildPath(state->path, "+Threads");
+                    uint32 t;
+                    uint32 numberOfThreads = cdb.GetNumberOfChildren();
+                    for (t = 0u; (t < numberOfThreads) && (ok); t++) {
+                        StreamString threadName = cdb.GetChildName(t);
+                        if (cdb.MoveRelative(threadName.Buffer())) {
+                            LintThread *threadI = new LintThread;
+                            threadI->path = ChildPath(threadsPath, threadName.Buffer());
+                            threadI->name = StripPrefix(threadName.Buffer());
+                            threadI->state = stateIndex;
+                            threadI->numberOfEntries = 0u;
+                            threadI->entries = NULL_PTR(StreamString *);
+                            AnyType functionsType = cdb.GetType("Functions");
+                            if ((!functionsType.IsVoid()) && (functionsType.GetNumberOfDimensions() <= 1u)) {
+                                threadI->numberOfEntries = (functionsType.GetNumberOfDimensions() == 1u) ? functionsType.GetNumberOfElements(0u) : 1u;
+                                threadI->entries = new StreamString[threadI->numberOfEntries];
+                                if (functionsType.GetNumberOfDimensions() == 1u) {
+                                    Vector<StreamString> entries(threadI->entries, threadI->numberOfEntries);
+                                    ok = cdb.Read("Functions", entries);
+                                }
+                                else {
+                                    ok = cdb.Read("Functions", threadI->entries[0]);
+                                }
+                            }
+                            uint32 e;
+                            for (e = 0u; (ok) && (e < threadI->numberOfEntries); e++) {
+                                BitSet resolved;
+                                if (ResolveFunctions(threadI->entries[e], resolved)) {
+                                    state->functions.Or(resolved);
+                                }
+                            }
+                            if (ok) {
+                                ok = threads.Add(threadI);
+                            }
+                            if (!ok) {
+                                delete [] threadI->entries;
+                                delete threadI;
+                            }
+                            (void) cdb.MoveToAncestor(1u);
+                        }
+                    }
+                    (void) cdb.MoveToAncestor(1u);
+                }
+                (void) cdb.MoveToAncestor(1u);
+            }
+        }
+        return ok;
+    }
+};
+
+/**
+ * A StateMachine event and the states it may lead to.
+ */
+struct LintTransition {
+    StreamString path;
+    StreamString nextState;
+    StreamString nextStateError;
+};
+
+/**
+ * @brief The model of a StateMachine which is checked by the rules.
+ */
+class LintStateMachine {
+public:
+    LintStateMachine() {
+    }
+
+    ~LintStateMachine() {
+        uint32 i;
+        for (i = 0u; i < stateNames.GetSize(); i++) {
+            delete stateNames[i];
+        }
+        for (i = 0u; i < transitions.GetSize(); i++) {
+            delete transitions[i];
+        }
+    }
+
+    /**
+     * @brief Builds the model from \a cdb, which must point at the StateMachine node with path \a pathIn.
+     */
+    bool Build(ConfigurationDatabase cdb, const StreamString &pathIn) {
+        path = pathIn;
+        bool ok = true;
+        uint32 s;
+        uint32 numberOfStates = cdb.GetNumberOfChildren();
+        for (s = 0u; (s < numberOfStates) && (ok); s++) {
+            StreamString stateName = cdb.GetChildName(s);
+            if (cdb.MoveRelative(stateName.Buffer())) {
+                StreamString statePath = ChildPath(path, stateName.Buffer());
+                ok = stateNames.Add(new StreamString(StripPrefix(stateName.Buffer())));
+                uint32 e;
+                uint32 numberOfEvents = cdb.GetNumberOfChildren();
+                for (e = 0u; (e < numberOfEvents) && (ok); e++) {
+                    StreamString eventName = cdb.GetChildName(e);
+                    if (cdb.MoveRelative(eventName.Buffer())) {
+                        StreamString nextState;
+                        if (cdb.Read("NextState", nextState)) {
+                            LintTransition *transition = new LintTransition;
+                            transition->path = ChildPath(statePath, eventName.Buffer());
+                            transition->nextState = nextState;
+                            if (!cdb.Read("NextStateError", transition->nextStateError)) {
+                                transition->nextStateError = "";
+                            }
+                            ok = transitions.Add(transition);
+                        }
+                        (void) cdb.MoveToAncestor(1u);
+                    }
+                }
+                (void) cdb.MoveToAncestor(1u);
+            }
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Returns true if the state \a stateName exists.
+     */
+    bool HasState(const StreamString &stateName) const {
+        bool found = false;
+        uint32 s;
+        for (s = 0u; (s < stateNames.GetSize()) && (!found); s++) {
+            found = (*stateNames[s] == stateName);
+        }
+        return found;
+    }
+
+    StreamString path;
+    StaticList<StreamString *> stateNames;
+    StaticList<LintTransition *> transitions;
+};
+
+/**
+ * @brief The RealTimeApplications and StateMachines of one configuration file.
+ */
+struct LintModel {
+    StreamString filename;
+    StreamString format;
+    /**
+     * Set if the file could not be read or parsed (in which case no rule is executed).
+     */
+    StreamString loadError;
+    StaticList<LintApplication *> applications;
+    StaticList<LintStateMachine *> stateMachines;
+
+    ~LintModel() {
+        uint32 i;
+        for (i = 0u; i < applications.GetSize(); i++) {
+            delete applications[i];
+        }
+        for (i = 0u; i < stateMachines.GetSize(); i++) {
+            delete stateMachines[i];
+        }
+    }
+};
+
+/**
+ * One finding of a rule.
+ */
+struct LintDiagnostic {
+    StreamString path;
+    StreamString message;
+};
+
+/**
+ * @brief The findings of one rule over one LintModel.
+ */
+class LintReport {
+public:
+    LintReport() {
+    }
+
+    ~LintReport() {
+        uint32 i;
+        for (i = 0u; i < diagnostics.GetSize(); i++) {
+            delete diagnostics[i];
+        }
+    }
+
+    /**
+     * @brief Adds a finding on the node \a path. The \a message is formatted as in StreamString::Printf with up to four string arguments.
+     */
+    void Add(const StreamString &path, const char8 * const message, const char8 * const arg1 = "", const char8 * const arg2 = "", const char8 * const arg3 = "", const char8 * const arg4 = "") {
+        LintDiagnostic *diagnostic = new LintDiagnostic;
+        diagnostic->path = path;
+        (void) diagnostic->message.Printf(message, arg1, arg2, arg3, arg4);
+        if (!diagnostics.Add(diagnostic)) {
+            delete diagnostic;
+        }
+    }
+
+    StaticList<LintDiagnostic *> diagnostics;
+};
+
+/**
+ * @brief Checks a LintModel and adds the findings to the LintReport.
+ */
+typedef void (*LintRuleFunction)(const LintModel &model, LintReport &report);
+
+/**
+ * @brief Signals whose DataSource is not defined in +Data.
+ */
+static void CheckDanglingDataSources(const LintModel &model, LintReport &report) {
+    uint32 a;
+    for (a = 0u; a < model.applications.GetSize(); a++) {
+        const LintApplication *application = model.applications[a];
+        uint32 i;
+        for (i = 0u; i < application->signals.GetSize(); i++) {
+            const LintSignal *signal = application->signals[i];
+            if (signal->function != LINT_NONE) {
+                if (signal->dataSource.Size() == 0u) {
+                    report.Add(signal->path, "Signal %s has no DataSource and there is no DefaultDataSource", signal->name.Buffer());
+                }
+                else if (application->FindDataSource(signal->dataSource) == LINT_NONE) {
+                    report.Add(signal->path, "DataSource %s of signal %s is not defined in +Data", signal->dataSource.Buffer(), signal->name.Buffer());
+                }
+                else {
+                    //Valid
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Thread Functions which are not defined in +Functions.
+ */
+static void CheckDanglingFunctions(const LintModel &model, LintReport &report) {
+    uint32 a;
+    for (a = 0u; a < model.applications.GetSize(); a++) {
+        const LintApplication *application = model.applications[a];
+        uint32 t;
+        for (t = 0u; t < application->threads.GetSize(); t++) {
+            const LintThread *threadI = application->threads[t];
+            uint32 e;
+            for (e = 0u; e < threadI->numberOfEntries; e++) {
+                BitSet resolved;
+                if (!application->ResolveFunctions(threadI->entries[e], resolved)) {
+                    report.Add(threadI->path, "Function %s of thread %s is not defined in +Functions", threadI->entries[e].Buffer(), threadI->name.Buffer());
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Signals of the same DataSource signal which declare a different Type or NumberOfElements.
+ * @details Each signal is compared with the first usage (in the DataSource declaration or in a function) which sets the Type (or the NumberOfElements).
+ */
+static void CheckSignalMismatches(const LintModel &model, LintReport &report) {
+    uint32 a;
+    for (a = 0u; a < model.applications.GetSize(); a++) {
+        const LintApplication *application = model.applications[a];
+        uint32 d;
+        for (d = 0u; d < application->dataSources.GetSize(); d++) {
+            const LintDataSource *dataSource = application->dataSources[d];
+            uint32 i;
+            for (i = 0u; i < dataSource->usages.GetSize(); i++) {
+                const LintSignal *signal = dataSource->usages[i];
+                const LintSignal *typeReference = NULL_PTR(const LintSignal *);
+                const LintSignal *elementsReference = NULL_PTR(const LintSignal *);
+                uint32 j;
+                for (j = 0u; j < i; j++) {
+                    const LintSignal *other = dataSource->usages[j];
+                    if (other->dataSourceSignal == signal->dataSourceSignal) {
+                        if ((typeReference == NULL_PTR(const LintSignal *)) && (other->type.Size() > 0u)) {
+                            typeReference = other;
+                        }
+                        if ((elementsReference == NULL_PTR(const LintSignal *)) && (other->numberOfElements > 0u)) {
+                            elementsReference = other;
+                        }
+                    }
+                }
+                if ((typeReference != NULL_PTR(const LintSignal *)) && (signal->type.Size() > 0u) && (signal->type != typeReference->type)) {
+                    report.Add(signal->path, "Type %s does not match the Type %s of %s", signal->type.Buffer(), typeReference->type.Buffer(), typeReference->path.Buffer());
+                }
+                if ((elementsReference != NULL_PTR(const LintSignal *)) && (signal->numberOfElements > 0u) && (signal->numberOfElements != elementsReference->numberOfElements)) {
+                    StreamString elements;
+                    StreamString referenceElements;
+                    (void) elements.Printf("%u", signal->numberOfElements);
+                    (void) referenceElements.Printf("%u", elementsReference->numberOfElements);
+                    report.Add(signal->path, "NumberOfElements %s does not match the NumberOfElements %s of %s", elements.Buffer(), referenceElements.Buffer(), elementsReference->path.Buffer());
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief DataSource signals which are written by more than one function in the same state.
+ */
+static void CheckMultipleProducers(const LintModel &model, LintReport &report) {
+    uint32 a;
+    for (a = 0u; a < model.applications.GetSize(); a++) {
+        const LintApplication *application = model.applications[a];
+        uint32 s;
+        for (s = 0u; s < application->states.GetSize(); s++) {
+            const LintState *state = application->states[s];
+            uint32 d;
+            for (d = 0u; d < application->dataSources.GetSize(); d++) {
+                const LintDataSource *dataSource = application->dataSources[d];
+                uint32 i;
+                for (i = 0u; i < dataSource->usages.GetSize(); i++) {
+                    const LintSignal *signal = dataSource->usages[i];
+                    if ((signal->isOutput) && (state->functions.Test(signal->function))) {
+                        const LintSignal *producer = NULL_PTR(const LintSignal *);
+                        uint32 j;
+                        for (j = 0u; (j < i) && (producer == NULL_PTR(const LintSignal *)); j++) {
+                            const LintSignal *other = dataSource->usages[j];
+                            if ((other->isOutput) && (other->function != signal->function) && (state->functions.Test(other->function)) && (other->dataSourceSignal == signal->dataSourceSignal)) {
+                                producer = other;
+                            }
+                        }
+                        if (producer != NULL_PTR(const LintSignal *)) {
+                            report.Add(signal->path, "Signal %s.%s is also written by %s in state %s", dataSource->name.Buffer(), signal->dataSourceSignal.Buffer(), application->functions[producer->function]->name.Buffer(), state->name.Buffer());
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Functions which are not executed by any thread.
+ */
+static void CheckUnusedFunctions(const LintModel &model, LintReport &report) {
+    uint32 a;
+    for (a = 0u; a < model.applications.GetSize(); a++) {
+        const LintApplication *application = model.applications[a];
+        BitSet used(application->functions.GetSize());
+        uint32 s;
+        for (s = 0u; s < application->states.GetSize(); s++) {
+            used.Or(application->states[s]->functions);
+        }
+        uint32 f;
+        for (f = 0u; f < application->functions.GetSize(); f++) {
+            if (!used.Test(f)) {
+                report.Add(application->functions[f]->path, "Function %s is not executed by any thread", application->functions[f]->name.Buffer());
+            }
+        }
+    }
+}
+
+/**
+ * @brief DataSources which are not used by any function signal. The TimingDataSource is implicitly used by the application.
+ */
+static void CheckUnusedDataSources(const LintModel &model, LintReport &report) {
+    uint32 a;
+    for (a = 0u; a < model.applications.GetSize(); a++) {
+        const LintApplication *application = model.applications[a];
+        uint32 d;
+        for (d = 0u; d < application->dataSources.GetSize(); d++) {
+            const LintDataSource *dataSource = application->dataSources[d];
+            bool used = (dataSource->className == "TimingDataSource");
+            uint32 i;
+            for (i = 0u; (i < dataSource->usages.GetSize()) && (!used); i++) {
+                used = (dataSource->usages[i]->function != LINT_NONE);
+            }
+            if (!used) {
+                report.Add(dataSource->path, "DataSource %s is not used by any function", dataSource->name.Buffer());
+            }
+        }
+    }
+}
+
+/**
+ * @brief StateMachine NextState and NextStateError which are not states of the StateMachine.
+ */
+static void CheckNextStates(const LintModel &model, LintReport &report) {
+    uint32 m;
+    for (m = 0u; m < model.stateMachines.GetSize(); m++) {
+        const LintStateMachine *stateMachine = model.stateMachines[m];
+        uint32 t;
+        for (t = 0u; t < stateMachine->transitions.GetSize(); t++) {
+            const LintTransition *transition = stateMachine->transitions[t];
+            if (!stateMachine->HasState(transition->nextState)) {
+                report.Add(transition->path, "NextState %s is not a state of the StateMachine", transition->nextState.Buffer());
+            }
+            if ((transition->nextStateError.Size() > 0u) && (!stateMachine->HasState(transition->nextStateError))) {
+                report.Add(transition->path, "NextStateError %s is not a state of the StateMachine", transition->nextStateError.Buffer());
+            }
+        }
+    }
+}
+
+/**
+ * A lint rule. New rules are added to LINT_RULES.
+ */
+struct LintRule {
+    const char8 *name;
+    /**
+     * error or warning. Any error makes CfgLint exit with 1.
+     */
+    const char8 *severity;
+    const char8 *description;
+    LintRuleFunction function;
+};
+
+static const LintRule LINT_RULES[] = {
+    { "dangling-datasource", "error", "Signals whose DataSource is not defined in +Data", &CheckDanglingDataSources },
+    { "dangling-function", "error", "Thread Functions which are not defined in +Functions", &CheckDanglingFunctions },
+    { "signal-mismatch", "error", "Producer/consumer Type or NumberOfElements mismatches", &CheckSignalMismatches },
+    { "multiple-producers", "error", "Signals written by more than one function in the same state", &CheckMultipleProducers },
+    { "unused-function", "warning", "Functions which are not executed by any thread", &CheckUnusedFunctions },
+    { "unused-datasource", "warning", "DataSources which are not used by any function", &CheckUnusedDataSources },
+    { "next-state", "error", "StateMachine NextState (and NextStateError) which do not exist", &CheckNextStates }
+};
+
+static const uint32 NUMBER_OF_LINT_RULES = static_cast<uint32>(sizeof(LINT_RULES) / sizeof(LintRule));
+
+/**
+ * @brief Reads, parses and builds the LintModel with index \a jobIndex (of the array \a context).
+ * @details A file which cannot be loaded is reported as a finding (loadError) and does not stop the other files.
+ */
+static bool LoadModelJob(void * const context, const uint32 jobIndex) {
+    LintModel *model = &(static_cast<LintModel *>(context)[jobIndex]);
+    Diagnostics::SetContext(model->filename.Buffer());
+    StreamString content;
+    ConfigurationDatabase cdb;
+    bool ok = ConfigurationCache::ReadFile(model->filename.Buffer(), content);
+    if (!ok) {
+        model->loadError = "Failed to read the file";
+    }
+    if (ok) {
+        StreamString parserError;
+        //The files are already parsed in parallel
+        ok = ConfigurationCache::Parse(content, model->format.Buffer(), cdb, parserError, 1u);
+        if (!ok) {
+            (void) model->loadError.Printf("Failed to parse: %s", parserError.Buffer());
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    uint32 i;
+    uint32 numberOfNodesAfterRoot = cdb.GetNumberOfChildren();
+    for (i = 0u; (i < numberOfNodesAfterRoot) && (ok); i++) {
+        StreamString nodeName = cdb.GetChildName(i);
+        if (cdb.MoveRelative(nodeName.Buffer())) {
+            Diagnostics::SetContext(model->filename.Buffer(), nodeName.Buffer());
+            StreamString className;
+            if (!cdb.Read("Class", className)) {
+                className = "";
+            }
+            if (className == "RealTimeApplication") {
+                LintApplication *application = new LintApplication;
+                ok = application->Build(cdb, nodeName);
+                if (ok) {
+                    ok = model->applications.Add(application);
+                }
+                else {
+                    delete application;
+                }
+            }
+            else if (className == "StateMachine") {
+                LintStateMachine *stateMachine = new LintStateMachine;
+                ok = stateMachine->Build(cdb, nodeName);
+                if (ok) {
+                    ok = model->stateMachines.Add(stateMachine);
+                }
+                else {
+                    delete stateMachine;
+                }
+            }
+            else {
+                //Not checked
+            }
+            if (!ok) {
+                (void) model->loadError.Printf("Failed to build the model of %s", nodeName.Buffer());
+            }
+            (void) cdb.MoveToAncestor(1u);
+        }
+    }
+    Diagnostics::SetContext(NULL_PTR(const char8 *));
+    return true;
+}
+
+/**
+ * The execution of one rule over one LintModel.
+ */
+struct LintJob {
+    const LintModel *model;
+    uint32 rule;
+    LintReport report;
+};
+
+/**
+ * @brief Executes the LintJob with index \a jobIndex (of the array \a context).
+ */
+static bool RunRuleJob(void * const context, const uint32 jobIndex) {
+    LintJob *job = &(static_cast<LintJob *>(context)[jobIndex]);
+    LINT_RULES[job->rule].function(*job->model, job->report);
+    return true;
+}
+
+/**
+ * @brief Prints \a value as a quoted json string.
+ */
+static void PrintJsonString(const char8 * const value) {
+    (void) putchar('"');
+    uint32 i;
+    for (i = 0u; value[i] != '\0'; i++) {
+        char8 c = value[i];
+        if ((c == '"') || (c == '\\')) {
+            printf("\\%c", c);
+        }
+        else if (static_cast<uint8>(c) < 0x20u) {
+            printf("\\u%04x", static_cast<uint32>(static_cast<uint8>(c)));
+        }
+        else {
+            (void) putchar(c);
+        }
+    }
+    (void) putchar('"');
+}
+
+/**
+ * @brief Prints one finding, either as text (FILE: SEVERITY: PATH: MESSAGE [RULE]) or as one json object per line.
+ */
+static void PrintDiagnostic(const bool json, const StreamString &filename, const char8 * const severity, const char8 * const rule, const StreamString &path, const StreamString &message) {
+    if (json) {
+        printf("%s", "{\"file\":");
+        PrintJsonString(filename.Buffer());
+        printf("%s", ",\"severity\":");
+        PrintJsonString(severity);
+        printf("%s", ",\"rule\":");
+        PrintJsonString(rule);
+        printf("%s", ",\"path\":");
+        PrintJsonString(path.Buffer());
+        printf("%s", ",\"message\":");
+        PrintJsonString(message.Buffer());
+        printf("%s", "}\n");
+    }
+    else {
+        printf("%s: %s: %s: %s [%s]\n", filename.Buffer(), severity, path.Buffer(), message.Buffer(), rule);
+    }
+}
+
+/**
+ * @brief Enables the rules listed (comma separated) in \a ruleNames.
+ */
+static bool SelectRules(const StreamString &ruleNames, bool * const enabled) {
+    uint32 r;
+    for (r = 0u; r < NUMBER_OF_LINT_RULES; r++) {
+        enabled[r] = false;
+    }
+    StreamString names = ruleNames;
+    bool ok = names.Seek(0LLU);
+    StreamString ruleName;
+    char8 terminator;
+    while ((ok) && (names.GetToken(ruleName, ",", terminator))) {
+        bool found = false;
+        for (r = 0u; (r < NUMBER_OF_LINT_RULES) && (!found); r++) {
+            found = (ruleName == LINT_RULES[r].name);
+            if (found) {
+                enabled[r] = true;
+            }
+        }
+        ok = found;
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown rule %s\n", ruleName.Buffer());
+        }
+        ruleName = "";
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+int main(int argc, char **argv) {
+    Diagnostics::Install();
+    const char8 *args = "-if json|xml|cdb [-rules RULE,...] [--json] INPUT_FILE... | -l";
+    if ((argc == 2) && (StreamString("-l") == argv[1])) {
+        uint32 r;
+        for (r = 0u; r < NUMBER_OF_LINT_RULES; r++) {
+            printf("%-20s %-8s %s\n", LINT_RULES[r].name, LINT_RULES[r].severity, LINT_RULES[r].description);
+        }
+        return 0;
+    }
+    StreamString inputFormat;
+    bool json = false;
+    bool enabled[NUMBER_OF_LINT_RULES];
+    uint32 r;
+    for (r = 0u; r < NUMBER_OF_LINT_RULES; r++) {
+        enabled[r] = true;
+    }
+    bool ok = true;
+    int32 i = 1;
+    bool options = true;
+    while ((options) && (i < argc) && (ok)) {
+        StreamString arg = argv[i];
+        if (arg == "--json") {
+            json = true;
+            i++;
+        }
+        else if ((arg == "-if") && ((i + 1) < argc)) {
+            inputFormat = argv[i + 1];
+            i += 2;
+        }
+        else if ((arg == "-rules") && ((i + 1) < argc)) {
+            ok = SelectRules(argv[i + 1], &enabled[0]);
+            i += 2;
+        }
+        else {
+            options = false;
+        }
+    }
+    if (ok) {
+        ok = (inputFormat.Size() > 0u) && (i < argc);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
+        return -1;
+    }
+    const uint32 numberOfModels = static_cast<uint32>(argc - i);
+    LintModel *models = new LintModel[numberOfModels];
+    uint32 m;
+    for (m = 0u; m < numberOfModels; m++) {
+        models[m].filename = argv[i + static_cast<int32>(m)];
+        models[m].format = inputFormat;
+    }
+    ParallelJobRunner runner;
+    ok = runner.Run(&LoadModelJob, models, numberOfModels);
+    //One job for each enabled rule of each model
+    uint32 numberOfEnabledRules = 0u;
+    for (r = 0u; r < NUMBER_OF_LINT_RULES; r++) {
+        if (enabled[r]) {
+            numberOfEnabledRules++;
+        }
+    }
+    uint32 numberOfJobs = numberOfModels * numberOfEnabledRules;
+    LintJob *jobs = new LintJob[numberOfJobs];
+    uint32 j = 0u;
+    for (m = 0u; m < numberOfModels; m++) {
+        for (r = 0u; r < NUMBER_OF_LINT_RULES; r++) {
+            if (enabled[r]) {
+                jobs[j].model = &models[m];
+                jobs[j].rule = r;
+                j++;
+            }
+        }
+    }
+    if (ok) {
+        ok = runner.Run(&RunRuleJob, jobs, numberOfJobs);
+    }
+    uint32 numberOfErrors = 0u;
+    uint32 numberOfWarnings = 0u;
+    j = 0u;
+    for (m = 0u; (m < numberOfModels) && (ok); m++) {
+        if (models[m].loadError.Size() > 0u) {
+            PrintDiagnostic(json, models[m].filename, "error", "load", "", models[m].loadError);
+            numberOfErrors++;
+        }
+        for (r = 0u; r < numberOfEnabledRules; r++) {
+            const LintRule &rule = LINT_RULES[jobs[j].rule];
+            const bool isError = (StringHelper::Compare(rule.severity, "error") == 0);
+            //The rules are not executed over a model which failed to load
+            const uint32 numberOfDiagnostics = (models[m].loadError.Size() > 0u) ? 0u : jobs[j].report.diagnostics.GetSize();
+            uint32 d;
+            for (d = 0u; d < numberOfDiagnostics; d++) {
+                const LintDiagnostic *diagnostic = jobs[j].report.diagnostics[d];
+                PrintDiagnostic(json, models[m].filename, rule.severity, rule.name, diagnostic->path, diagnostic->message);
+                if (isError) {
+                    numberOfErrors++;
+                }
+                else {
+                    numberOfWarnings++;
+                }
+            }
+            j++;
+        }
+    }
+    if ((ok) && (!json)) {
+        printf("%u file(s), %u error(s), %u warning(s)\n", numberOfModels, numberOfErrors, numberOfWarnings);
+    }
+    delete [] jobs;
+    delete [] models;
+    int32 ret = ok ? ((numberOfErrors > 0u) ? 1 : 0) : -1;
+    return ret;
+}
@@ -0,0 +1,1158 @@
+/**
+ * @file CfgQuery.cpp
+ * @brief Source file for main file CfgQuery
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class Playground (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/**
+ * Persistent inverted index of a corpus of configuration files
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BinaryRecord.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationDatabase.h"
+#include "Diagnostics.h"
+#include "Directory.h"
+#include "File.h"
+#include "HashFunction.h"
+#include "MemoryOperationsHelper.h"
+#include "ParallelJobRunner.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * The index starts with the magic and version, followed by the number of files and of terms and by the offsets (in bytes, from
+ * the start of the index) of the file offsets table, of the term records and of the term offsets table. The file records start
+ * right after the header.
+ */
+static const char8 * const INDEX_MAGIC = "MCFGIDX";
+static const uint32 INDEX_MAGIC_SIZE = 8u;
+static const uint32 INDEX_VERSION = 1u;
+static const uint32 INDEX_HEADER_SIZE = 44u;
+
+/**
+ * Prefixes of the indexed terms.
+ */
+static const char8 * const TERM_PATH = "path:";
+static const char8 * const TERM_KEY_VALUE = "kv:";
+static const char8 * const TERM_INPUT = "in:";
+static const char8 * const TERM_OUTPUT = "out:";
+
+struct UInt64Less {
+    bool operator()(const uint64 a, const uint64 b) const {
+        return (a < b);
+    }
+};
+
+/**
+ * @brief Sorts \a values and removes the repeated ones. Returns the new number of values.
+ */
+static uint32 SortUnique(uint64 * const values, const uint32 size) {
+    BinaryRecord::MergeSort(values, size, UInt64Less());
+    uint32 unique = 0u;
+    uint32 i;
+    for (i = 0u; i < size; i++) {
+        if ((unique == 0u) || (values[unique - 1u] != values[i])) {
+            values[unique] = values[i];
+            unique++;
+        }
+    }
+    return unique;
+}
+
+/**
+ * @brief Returns true if \a str matches \a pattern, where * matches any sequence of characters.
+ */
+static bool GlobMatch(const char8 *pattern, const char8 *str) {
+    const char8 *star = NULL_PTR(const char8 *);
+    const char8 *retry = NULL_PTR(const char8 *);
+    bool ok = true;
+    while ((*str != '\0') && (ok)) {
+        if (*pattern == '*') {
+            star = pattern;
+            pattern++;
+            retry = str;
+        }
+        else if (*pattern == *str) {
+            pattern++;
+            str++;
+        }
+        else if (star != NULL_PTR(const char8 *)) {
+            pattern = &star[1];
+            retry++;
+            str = retry;
+        }
+        else {
+            ok = false;
+        }
+    }
+    while ((ok) && (*pattern == '*')) {
+        pattern++;
+    }
+    return (ok) && (*pattern == '\0');
+}
+
+/**
+ * @brief Collects the nodes and terms of one configuration file.
+ * @details The record of a file holds its name, the hash of its content, the path of each node (the node identifier is its
+ * index, in depth-first order) and each (term, node identifier) pair.
+ */
+class FileIndexBuilder {
+public:
+    FileIndexBuilder() {
+        numberOfNodes = 0u;
+        numberOfTerms = 0u;
+    }
+
+    uint32 AddNode(const StreamString &path) {
+        BinaryRecord::AppendString(paths, path.Buffer());
+        numberOfNodes++;
+        return (numberOfNodes - 1u);
+    }
+
+    void AddTerm(const StreamString &term, const uint32 nodeId) {
+        BinaryRecord::AppendString(terms, term.Buffer());
+        BinaryRecord::AppendValue(terms, nodeId);
+        numberOfTerms++;
+    }
+
+    void Encode(const char8 * const name, const uint64 hash, StreamString &record) const {
+        record = "";
+        BinaryRecord::AppendString(record, name);
+        BinaryRecord::AppendValue(record, hash);
+        BinaryRecord::AppendValue(record, numberOfNodes);
+        BinaryRecord::AppendValue(record, numberOfTerms);
+        uint32 size = static_cast<uint32>(paths.Size());
+        (void) record.Write(paths.Buffer(), size);
+        size = static_cast<uint32>(terms.Size());
+        (void) record.Write(terms.Buffer(), size);
+    }
+
+private:
+    StreamString paths;
+    StreamString terms;
+    uint32 numberOfNodes;
+    uint32 numberOfTerms;
+};
+
+/**
+ * @brief Adds the signal to DataSource edges of the signals node (InputSignals or OutputSignals) at the current position of \a cdb
+ * to the function \a functionId.
+ * @details The signal name is its Alias (if set), i.e. the name of the signal in the DataSource.
+ */
+static bool IndexSignals(ConfigurationDatabase &cdb, const char8 * const termPrefix, const uint32 functionId, FileIndexBuilder &builder) {
+    bool ok = true;
+    uint32 numberOfSignals = cdb.GetNumberOfChildren();
+    uint32 i;
+    for (i = 0u; (i < numberOfSignals) && (ok); i++) {
+        const char8 * const signalName = cdb.GetChildName(i);
+        if (cdb.MoveToChild(i)) {
+            StreamString alias = signalName;
+            StreamString dataSource;
+            (void) cdb.Read("Alias", alias);
+            if (cdb.Read("DataSource", dataSource)) {
+                StreamString term;
+                (void) term.Printf("%s%s@%s", termPrefix, alias.Buffer(), dataSource.Buffer());
+                builder.AddTerm(term, functionId);
+            }
+            ok = cdb.MoveToAncestor(1u);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Indexes the node at the current position of \a cdb, with name \a nodeName and path \a path, and all its subtree.
+ */
+static bool IndexNode(ConfigurationDatabase &cdb, const char8 * const nodeName, const StreamString &path, const uint32 parentId, FileIndexBuilder &builder) {
+    uint32 nodeId = builder.AddNode(path);
+    StreamString term;
+    (void) term.Printf("%s%s", TERM_PATH, path.Buffer());
+    builder.AddTerm(term, nodeId);
+    bool ok = true;
+    if (StringHelper::Compare(nodeName, "InputSignals") == 0) {
+        ok = IndexSignals(cdb, TERM_INPUT, parentId, builder);
+    }
+    else if (StringHelper::Compare(nodeName, "OutputSignals") == 0) {
+        ok = IndexSignals(cdb, TERM_OUTPUT, parentId, builder);
+    }
+    else {
+        //Not a signals node
+    }
+    uint32 numberOfChildren = cdb.GetNumberOfChildren();
+    uint32 i;
+    for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+        const char8 * const childName = cdb.GetChildName(i);
+        if (cdb.MoveToChild(i)) {
+            StreamString childPath;
+            if (path.Size() > 0u) {
+                (void) childPath.Printf("%s.%s", path.Buffer(), childName);
+            }
+            else {
+                childPath = childName;
+            }
+            ok = IndexNode(cdb, childName, childPath, nodeId, builder);
+            if (ok) {
+                ok = cdb.MoveToAncestor(1u);
+            }
+        }
+        else {
+            //Same representation as the one used to hash the leaves
+            StreamString value;
+            (void) value.Printf("%!", cdb.GetType(childName));
+            term = "";
+            (void) term.Printf("%s%s=%s", TERM_KEY_VALUE, childName, value.Buffer());
+            builder.AddTerm(term, nodeId);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Read-only view of an index file.
+ */
+class ConfigurationIndex {
+public:
+    ConfigurationIndex() {
+        numberOfFiles = 0u;
+        numberOfTerms = 0u;
+        fileOffsetsOffset = 0u;
+        termsOffset = 0u;
+        termOffsetsOffset = 0u;
+    }
+
+    /**
+     * @brief Loads the index \a indexFilename and validates its header.
+     */
+    bool Open(const char8 * const indexFilename) {
+        bool ok = ConfigurationCache::ReadFile(indexFilename, content);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to read %s\n", indexFilename);
+        }
+        if (ok) {
+            ok = (content.Size() >= INDEX_HEADER_SIZE);
+        }
+        if (ok) {
+            ok = (StringHelper::CompareN(content.Buffer(), INDEX_MAGIC, INDEX_MAGIC_SIZE) == 0);
+        }
+        ByteReader reader(content.Buffer(), content.Size(), INDEX_MAGIC_SIZE);
+        uint32 version = 0u;
+        if (ok) {
+            ok = reader.ReadValue(version);
+        }
+        if (ok) {
+            ok = (version == INDEX_VERSION);
+        }
+        if (ok) {
+            ok = reader.ReadValue(numberOfFiles);
+        }
+        if (ok) {
+            ok = reader.ReadValue(numberOfTerms);
+        }
+        if (ok) {
+            ok = reader.ReadValue(fileOffsetsOffset);
+        }
+        if (ok) {
+            ok = reader.ReadValue(termsOffset);
+        }
+        if (ok) {
+            ok = reader.ReadValue(termOffsetsOffset);
+        }
+        if (ok) {
+            ok = ((fileOffsetsOffset + (static_cast<uint64>(numberOfFiles) * sizeof(uint64))) <= termsOffset);
+        }
+        if (ok) {
+            ok = ((termOffsetsOffset + (static_cast<uint64>(numberOfTerms) * sizeof(uint64))) <= content.Size());
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s is not a valid index\n", indexFilename);
+        }
+        return ok;
+    }
+
+    uint32 GetNumberOfFiles() const {
+        return numberOfFiles;
+    }
+
+    uint32 GetNumberOfTerms() const {
+        return numberOfTerms;
+    }
+
+    /**
+     * @brief Gets the bytes of the record of the file \a fileIdx.
+     */
+    bool GetFileRecord(const uint32 fileIdx, const char8 *&record, uint32 &size) const {
+        uint64 start = 0u;
+        uint64 end = fileOffsetsOffset;
+        bool ok = ReadOffset(fileOffsetsOffset, fileIdx, start);
+        if ((ok) && ((fileIdx + 1u) < numberOfFiles)) {
+            ok = ReadOffset(fileOffsetsOffset, fileIdx + 1u, end);
+        }
+        if (ok) {
+            ok = (start <= end) && (end <= fileOffsetsOffset);
+        }
+        if (ok) {
+            record = &(content.Buffer()[start]);
+            size = static_cast<uint32>(end - start);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Gets the name and content hash of the file \a fileIdx.
+     */
+    bool GetFile(const uint32 fileIdx, StreamString &name, uint64 &hash) const {
+        const char8 *record = NULL_PTR(const char8 *);
+        uint32 size = 0u;
+        bool ok = GetFileRecord(fileIdx, record, size);
+        ByteReader reader(record, size);
+        if (ok) {
+            ok = reader.ReadString(name);
+        }
+        if (ok) {
+            ok = reader.ReadValue(hash);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Searches the file \a name (the files are sorted by name).
+     */
+    bool FindFile(const char8 * const name, uint32 &fileIdx) const {
+        uint32 first = 0u;
+        uint32 last = numberOfFiles;
+        bool found = false;
+        bool ok = true;
+        while ((first < last) && (!found) && (ok)) {
+            fileIdx = first + ((last - first) / 2u);
+            StreamString fileName;
+            uint64 hash = 0u;
+            ok = GetFile(fileIdx, fileName, hash);
+            int32 cmp = StringHelper::Compare(fileName.Buffer(), name);
+            found = (cmp == 0);
+            if (cmp < 0) {
+                first = fileIdx + 1u;
+            }
+            else if (cmp > 0) {
+                last = fileIdx;
+            }
+            else {
+                //Found
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Gets the path of the node \a nodeId of the file \a fileIdx.
+     */
+    bool GetNodePath(const uint32 fileIdx, const uint32 nodeId, StreamString &path) const {
+        const char8 *record = NULL_PTR(const char8 *);
+        uint32 size = 0u;
+        bool ok = GetFileRecord(fileIdx, record, size);
+        ByteReader reader(record, size);
+        uint64 hash = 0u;
+        uint32 numberOfNodes = 0u;
+        uint32 numberOfFileTerms = 0u;
+        if (ok) {
+            ok = reader.SkipString();
+        }
+        if (ok) {
+            ok = reader.ReadValue(hash);
+        }
+        if (ok) {
+            ok = reader.ReadValue(numberOfNodes);
+        }
+        if (ok) {
+            ok = reader.ReadValue(numberOfFileTerms);
+        }
+        if (ok) {
+            ok = (nodeId < numberOfNodes);
+        }
+        uint32 i;
+        for (i = 0u; (i < nodeId) && (ok); i++) {
+            ok = reader.SkipString();
+        }
+        if (ok) {
+            ok = reader.ReadString(path);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Gets the term \a termIdx.
+     */
+    bool GetTerm(const uint32 termIdx, StreamString &term) const {
+        uint64 start = 0u;
+        bool ok = ReadOffset(termOffsetsOffset, termIdx, start);
+        ByteReader reader(content.Buffer(), termOffsetsOffset, start);
+        if (ok) {
+            ok = reader.ReadString(term);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Gets the (sorted) postings of the term \a termIdx. Each posting is the file index (most significant 32 bits) and the node identifier.
+     * @details \a postings is allocated with new[] and must be deleted by the caller.
+     */
+    bool GetPostings(const uint32 termIdx, uint64 *&postings, uint32 &numberOfPostings) const {
+        uint64 start = 0u;
+        bool ok = ReadOffset(termOffsetsOffset, termIdx, start);
+        ByteReader reader(content.Buffer(), termOffsetsOffset, start);
+        if (ok) {
+            ok = reader.SkipString();
+        }
+        if (ok) {
+            ok = reader.ReadValue(numberOfPostings);
+        }
+        if (ok) {
+            ok = ((reader.GetOffset() + (static_cast<uint64>(numberOfPostings) * sizeof(uint64))) <= termOffsetsOffset);
+        }
+        if (ok) {
+            postings = new uint64[numberOfPostings];
+            uint32 i;
+            for (i = 0u; (i < numberOfPostings) && (ok); i++) {
+                ok = reader.ReadValue(postings[i]);
+            }
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Gets the index of the first term which is not lower than \a term (binary search).
+     */
+    uint32 LowerBound(const char8 * const term) const {
+        uint32 first = 0u;
+        uint32 last = numberOfTerms;
+        while (first < last) {
+            uint32 middle = first + ((last - first) / 2u);
+            StreamString middleTerm;
+            bool ok = GetTerm(middle, middleTerm);
+            if ((ok) && (StringHelper::Compare(middleTerm.Buffer(), term) < 0)) {
+                first = middle + 1u;
+            }
+            else {
+                last = middle;
+            }
+        }
+        return first;
+    }
+
+private:
+    bool ReadOffset(const uint64 tableOffset, const uint32 idx, uint64 &offset) const {
+        ByteReader reader(content.Buffer(), content.Size(), tableOffset + (static_cast<uint64>(idx) * sizeof(uint64)));
+        return reader.ReadValue(offset);
+    }
+
+    StreamString content;
+    uint32 numberOfFiles;
+    uint32 numberOfTerms;
+    uint64 fileOffsetsOffset;
+    uint64 termsOffset;
+    uint64 termOffsetsOffset;
+};
+
+/**
+ * @brief Merges the terms of all the file records into the inverted index (term to nodes).
+ */
+class TermTable {
+public:
+    TermTable() {
+        numberOfEntries = 0u;
+        entriesCapacity = 0u;
+        entries = NULL_PTR(Entry *);
+        table = NULL_PTR(uint32 *);
+        tableSize = 0u;
+        Grow();
+    }
+
+    ~TermTable() {
+        uint32 i;
+        for (i = 0u; i < numberOfEntries; i++) {
+            delete [] entries[i].postings;
+        }
+        delete [] entries;
+        delete [] table;
+    }
+
+    /**
+     * @brief Adds the terms of the file record \a record of the file \a fileIdx.
+     */
+    bool AddFileRecord(const uint32 fileIdx, const char8 * const record, const uint32 size) {
+        ByteReader reader(record, size);
+        uint64 hash = 0u;
+        uint32 numberOfNodes = 0u;
+        uint32 numberOfFileTerms = 0u;
+        bool ok = reader.SkipString();
+        if (ok) {
+            ok = reader.ReadValue(hash);
+        }
+        if (ok) {
+            ok = reader.ReadValue(numberOfNodes);
+        }
+        if (ok) {
+            ok = reader.ReadValue(numberOfFileTerms);
+        }
+        uint32 i;
+        for (i = 0u; (i < numberOfNodes) && (ok); i++) {
+            ok = reader.SkipString();
+        }
+        StreamString term;
+        for (i = 0u; (i < numberOfFileTerms) && (ok); i++) {
+            uint32 nodeId = 0u;
+            ok = reader.ReadString(term);
+            if (ok) {
+                ok = reader.ReadValue(nodeId);
+            }
+            if (ok) {
+                Add(term, (static_cast<uint64>(fileIdx) << 32u) | nodeId);
+            }
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Writes the term records, sorted by term, and their offsets (relative to \a baseOffset).
+     */
+    void Write(const uint64 baseOffset, StreamString &terms, StreamString &offsets) {
+        uint32 *sorted = new uint32[numberOfEntries];
+        uint32 i;
+        for (i = 0u; i < numberOfEntries; i++) {
+            sorted[i] = i;
+        }
+        EntryLess less;
+        less.entries = entries;
+        BinaryRecord::MergeSort(sorted, numberOfEntries, less);
+        for (i = 0u; i < numberOfEntries; i++) {
+            Entry &entry = entries[sorted[i]];
+            BinaryRecord::AppendValue(offsets, static_cast<uint64>(baseOffset + terms.Size()));
+            entry.numberOfPostings = SortUnique(entry.postings, entry.numberOfPostings);
+            BinaryRecord::AppendString(terms, entry.term.Buffer());
+            BinaryRecord::AppendValue(terms, entry.numberOfPostings);
+            uint32 size = static_cast<uint32>(entry.numberOfPostings * sizeof(uint64));
+            (void) terms.Write(reinterpret_cast<const char8 *>(entry.postings), size);
+        }
+        delete [] sorted;
+    }
+
+    uint32 GetNumberOfTerms() const {
+        return numberOfEntries;
+    }
+
+private:
+    struct Entry {
+        StreamString term;
+        uint64 hash;
+        uint64 *postings;
+        uint32 numberOfPostings;
+        uint32 postingsCapacity;
+    };
+
+    struct EntryLess {
+        const Entry *entries;
+        bool operator()(const uint32 a, const uint32 b) const {
+            return (StringHelper::Compare(entries[a].term.Buffer(), entries[b].term.Buffer()) < 0);
+        }
+    };
+
+    void Add(const StreamString &term, const uint64 posting) {
+        uint64 hash = HashFunction::Fnv1a(term.Buffer(), static_cast<uint32>(term.Size()));
+        uint32 slot = static_cast<uint32>(hash) & (tableSize - 1u);
+        bool found = false;
+        while ((table[slot] != EMPTY_SLOT) && (!found)) {
+            const Entry &candidate = entries[table[slot]];
+            found = (candidate.hash == hash) && (candidate.term == term.Buffer());
+            if (!found) {
+                slot = (slot + 1u) & (tableSize - 1u);
+            }
+        }
+        if (!found) {
+            if (numberOfEntries == entriesCapacity) {
+                Grow();
+                slot = static_cast<uint32>(hash) & (tableSize - 1u);
+                while (table[slot] != EMPTY_SLOT) {
+                    slot = (slot + 1u) & (tableSize - 1u);
+                }
+            }
+            Entry &entry = entries[numberOfEntries];
+            entry.term = term;
+            entry.hash = hash;
+            entry.postingsCapacity = 4u;
+            entry.postings = new uint64[entry.postingsCapacity];
+            entry.numberOfPostings = 0u;
+            table[slot] = numberOfEntries;
+            numberOfEntries++;
+        }
+        Entry &entry = entries[table[slot]];
+        if (entry.numberOfPostings == entry.postingsCapacity) {
+            uint64 *newPostings = new uint64[entry.postingsCapacity * 2u];
+            (void) MemoryOperationsHelper::Copy(newPostings, entry.postings, static_cast<uint32>(entry.numberOfPostings * sizeof(uint64)));
+            delete [] entry.postings;
+            entry.postings = newPostings;
+            entry.postingsCapacity *= 2u;
+        }
+        entry.postings[entry.numberOfPostings] = posting;
+        entry.numberOfPostings++;
+    }
+
+    /**
+     * @brief Doubles the capacity of the entries and rebuilds the hash table (which is kept at most half full).
+     */
+    void Grow() {
+        uint32 newCapacity = (entriesCapacity == 0u) ? 4096u : (entriesCapacity * 2u);
+        Entry *newEntries = new Entry[newCapacity];
+        uint32 i;
+        for (i = 0u; i < numberOfEntries; i++) {
+            newEntries[i].term = entries[i].term;
+            newEntries[i].hash = entries[i].hash;
+            newEntries[i].postings = entries[i].postings;
+            newEntries[i].numberOfPostings = entries[i].numberOfPostings;
+            newEntries[i].postingsCapacity = entries[i].postingsCapacity;
+        }
+        if (entries != NULL_PTR(Entry *)) {
+            delete [] entries;
+        }
+        entries = newEntries;
+        entriesCapacity = newCapacity;
+        if (table != NULL_PTR(uint32 *)) {
+            delete [] table;
+        }
+        tableSize = newCapacity * 2u;
+        table = new uint32[tableSize];
+        for (i = 0u; i < tableSize; i++) {
+            table[i] = EMPTY_SLOT;
+        }
+        for (i = 0u; i < numberOfEntries; i++) {
+            uint32 slot = static_cast<uint32>(entries[i].hash) & (tableSize - 1u);
+            while (table[slot] != EMPTY_SLOT) {
+                slot = (slot + 1u) & (tableSize - 1u);
+            }
+            table[slot] = i;
+        }
+    }
+
+    static const uint32 EMPTY_SLOT = 0xFFFFFFFFu;
+
+    Entry *entries;
+    uint32 numberOfEntries;
+    uint32 entriesCapacity;
+    uint32 *table;
+    uint32 tableSize;
+};
+
+/**
+ * One configuration file of the corpus to be indexed.
+ */
+struct IndexInput {
+    StreamString filename;
+    StreamString format;
+
+    /**
+     * The record of the file in the previous index, if any.
+     */
+    const char8 *previousRecord;
+    uint32 previousRecordSize;
+    uint64 previousHash;
+
+    /**
+     * Set to false if the previous record can be reused.
+     */
+    bool changed;
+    StreamString record;
+};
+
+/**
+ * @brief Reads the IndexInput with index \a jobIndex (of the array \a context) and, if its content changed, parses and indexes it.
+ */
+static bool IndexInputJob(void * const context, const uint32 jobIndex) {
+    IndexInput *input = &(static_cast<IndexInput *>(context)[jobIndex]);
+    Diagnostics::SetContext(input->filename.Buffer());
+    StreamString content;
+    bool ok = ConfigurationCache::ReadFile(input->filename.Buffer(), content);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", input->filename.Buffer());
+    }
+    uint64 hash = 0u;
+    if (ok) {
+        hash = HashFunction::Fnv1a(content.Buffer(), static_cast<uint32>(content.Size()));
+        input->changed = (input->previousRecord == NULL_PTR(const char8 *)) || (input->previousHash != hash);
+    }
+    if ((ok) && (input->changed)) {
+        ConfigurationDatabase cdb;
+        StreamString parserError;
+        ok = ConfigurationCache::Parse(content, input->format.Buffer(), cdb, parserError, 1u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to parse %s: %s\n", input->filename.Buffer(), parserError.Buffer());
+        }
+        FileIndexBuilder builder;
+        if (ok) {
+            ok = cdb.MoveToRoot();
+        }
+        if (ok) {
+            ok = IndexNode(cdb, "", "", 0u, builder);
+        }
+        if (ok) {
+            builder.Encode(input->filename.Buffer(), hash, input->record);
+        }
+    }
+    Diagnostics::SetContext(NULL_PTR(const char8 *));
+    return ok;
+}
+
+struct IndexInputLess {
+    const IndexInput *inputs;
+    bool operator()(const uint32 a, const uint32 b) const {
+        return (StringHelper::Compare(inputs[a].filename.Buffer(), inputs[b].filename.Buffer()) < 0);
+    }
+};
+
+/**
+ * @brief Updates (or creates) the index \a indexFilename so that it holds exactly the \a numberOfFilenames files \a filenames.
+ * @details Only the files whose content hash differs from the one in the previous index are parsed (concurrently). The inverted
+ * index is then rebuilt from the file records.
+ */
+static bool UpdateIndex(const char8 * const indexFilename, const char8 * const inputFormat, char8 ** const filenames, const uint32 numberOfFilenames) {
+    ConfigurationIndex previous;
+    bool hasPrevious = false;
+    {
+        File f;
+        hasPrevious = f.Open(indexFilename, BasicFile::ACCESS_MODE_R);
+        if (hasPrevious) {
+            (void) f.Close();
+        }
+    }
+    bool ok = true;
+    if (hasPrevious) {
+        ok = previous.Open(indexFilename);
+    }
+    IndexInput *inputs = new IndexInput[numberOfFilenames];
+    uint32 *sorted = new uint32[numberOfFilenames];
+    uint32 i;
+    for (i = 0u; i < numberOfFilenames; i++) {
+        inputs[i].filename = filenames[i];
+        inputs[i].format = inputFormat;
+        inputs[i].previousRecord = NULL_PTR(const char8 *);
+        inputs[i].previousRecordSize = 0u;
+        inputs[i].previousHash = 0u;
+        inputs[i].changed = true;
+        sorted[i] = i;
+    }
+    IndexInputLess less;
+    less.inputs = inputs;
+    BinaryRecord::MergeSort(sorted, numberOfFilenames, less);
+    //Remove repeated file names
+    uint32 numberOfFiles = 0u;
+    for (i = 0u; i < numberOfFilenames; i++) {
+        if ((numberOfFiles == 0u) || (!(inputs[sorted[numberOfFiles - 1u]].filename == inputs[sorted[i]].filename.Buffer()))) {
+            sorted[numberOfFiles] = sorted[i];
+            numberOfFiles++;
+        }
+    }
+    for (i = 0u; (i < numberOfFiles) && (ok) && (hasPrevious); i++) {
+        IndexInput &input = inputs[sorted[i]];
+        uint32 fileIdx = 0u;
+        if (previous.FindFile(input.filename.Buffer(), fileIdx)) {
+            StreamString name;
+            ok = previous.GetFile(fileIdx, name, input.previousHash);
+            if (ok) {
+                ok = previous.GetFileRecord(fileIdx, input.previousRecord, input.previousRecordSize);
+            }
+        }
+    }
+    if (ok) {
+        ParallelJobRunner runner;
+        ok = runner.Run(&IndexInputJob, inputs, numberOfFilenames);
+    }
+    StreamString records;
+    StreamString fileOffsets;
+    TermTable terms;
+    uint32 numberOfChanged = 0u;
+    for (i = 0u; (i < numberOfFiles) && (ok); i++) {
+        IndexInput &input = inputs[sorted[i]];
+        BinaryRecord::AppendValue(fileOffsets, static_cast<uint64>(INDEX_HEADER_SIZE + records.Size()));
+        const char8 *record = input.record.Buffer();
+        uint32 size = static_cast<uint32>(input.record.Size());
+        if (input.changed) {
+            numberOfChanged++;
+        }
+        else {
+            record = input.previousRecord;
+            size = input.previousRecordSize;
+        }
+        ok = terms.AddFileRecord(i, record, size);
+        if (ok) {
+            uint32 writeSize = size;
+            ok = records.Write(record, writeSize);
+        }
+    }
+    delete [] sorted;
+    delete [] inputs;
+
+    StreamString termRecords;
+    StreamString termOffsets;
+    uint64 fileOffsetsOffset = INDEX_HEADER_SIZE + records.Size();
+    uint64 termsOffset = fileOffsetsOffset + fileOffsets.Size();
+    if (ok) {
+        terms.Write(termsOffset, termRecords, termOffsets);
+    }
+    StreamString header;
+    if (ok) {
+        char8 magic[INDEX_MAGIC_SIZE];
+        (void) MemoryOperationsHelper::Set(&magic[0], '\0', INDEX_MAGIC_SIZE);
+        (void) StringHelper::Copy(&magic[0], INDEX_MAGIC);
+        uint32 magicSize = INDEX_MAGIC_SIZE;
+        (void) header.Write(&magic[0], magicSize);
+        BinaryRecord::AppendValue(header, INDEX_VERSION);
+        BinaryRecord::AppendValue(header, numberOfFiles);
+        BinaryRecord::AppendValue(header, terms.GetNumberOfTerms());
+        BinaryRecord::AppendValue(header, fileOffsetsOffset);
+        BinaryRecord::AppendValue(header, termsOffset);
+        BinaryRecord::AppendValue(header, static_cast<uint64>(termsOffset + termRecords.Size()));
+    }
+    //The previous index (which the reused records point to) is no longer needed
+    File outputFile;
+    if (ok) {
+        Directory d(indexFilename);
+        d.Delete();
+        ok = outputFile.Open(indexFilename, BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", indexFilename);
+        }
+    }
+    StreamString *sections[] = { &header, &records, &fileOffsets, &termRecords, &termOffsets };
+    for (i = 0u; (i < 5u) && (ok); i++) {
+        uint32 size = static_cast<uint32>(sections[i]->Size());
+        ok = outputFile.Write(sections[i]->Buffer(), size);
+    }
+    if (ok) {
+        ok = outputFile.Flush();
+    }
+    if (outputFile.IsOpen()) {
+        (void) outputFile.Close();
+    }
+    if (ok) {
+        printf("%u files (%u parsed), %u terms\n", numberOfFiles, numberOfChanged, terms.GetNumberOfTerms());
+    }
+    return ok;
+}
+
+/**
+ * @brief One condition of a query.
+ */
+struct QueryClause {
+    /**
+     * Pattern of the terms to match (* matches any sequence of characters).
+     */
+    StreamString pattern;
+
+    /**
+     * The fixed beginning of the pattern, which selects the range of terms to test.
+     */
+    StreamString prefix;
+
+    /**
+     * For the comparisons other than =, the operator (!, <, >, l for <=, g for >=), the number of characters of the
+     * term before the value and the value to compare with.
+     */
+    char8 comparison;
+    uint32 valueStart;
+    StreamString value;
+};
+
+/**
+ * @brief Parses a clause: Path=PATH, Input=SIGNAL[@DATA_SOURCE], Output=SIGNAL[@DATA_SOURCE] or KEY OP VALUE, with OP one
+ * of =, !=, <, <=, >, >=.
+ */
+static bool ParseClause(const char8 * const clauseStr, QueryClause &clause) {
+    const char8 *op = clauseStr;
+    while ((*op != '\0') && (*op != '=') && (*op != '!') && (*op != '<') && (*op != '>')) {
+        op++;
+    }
+    StreamString key;
+    uint32 keySize = static_cast<uint32>(op - clauseStr);
+    (void) key.Write(clauseStr, keySize);
+    clause.comparison = '=';
+    const char8 *valueStr = op;
+    if ((op[0] == '!') && (op[1] == '=')) {
+        clause.comparison = '!';
+        valueStr = &op[2];
+    }
+    else if ((op[0] == '<') && (op[1] == '=')) {
+        clause.comparison = 'l';
+        valueStr = &op[2];
+    }
+    else if ((op[0] == '>') && (op[1] == '=')) {
+        clause.comparison = 'g';
+        valueStr = &op[2];
+    }
+    else if ((op[0] == '=') || (op[0] == '<') || (op[0] == '>')) {
+        clause.comparison = op[0];
+        valueStr = &op[1];
+    }
+    else {
+        valueStr = NULL_PTR(const char8 *);
+    }
+    bool ok = (valueStr != NULL_PTR(const char8 *)) && (keySize > 0u);
+    bool isPath = (key == "Path");
+    bool isSignal = (key == "Input") || (key == "Output");
+    if ((ok) && ((isPath) || (isSignal))) {
+        ok = (clause.comparison == '=');
+    }
+    if (ok) {
+        clause.pattern = "";
+        clause.value = valueStr;
+        if (isPath) {
+            (void) clause.pattern.Printf("%s%s", TERM_PATH, valueStr);
+        }
+        else if (isSignal) {
+            const char8 *signalPrefix = (key == "Input") ? TERM_INPUT : TERM_OUTPUT;
+            const char8 *anyDataSource = (StringHelper::SearchChar(valueStr, '@') == NULL_PTR(const char8 *)) ? "@*" : "";
+            (void) clause.pattern.Printf("%s%s%s", signalPrefix, valueStr, anyDataSource);
+        }
+        else if (clause.comparison == '=') {
+            (void) clause.pattern.Printf("%s%s=%s", TERM_KEY_VALUE, key.Buffer(), valueStr);
+        }
+        else {
+            (void) clause.pattern.Printf("%s%s=*", TERM_KEY_VALUE, key.Buffer());
+            clause.valueStart = static_cast<uint32>(clause.pattern.Size() - 1u);
+        }
+        const char8 *star = StringHelper::SearchChar(clause.pattern.Buffer(), '*');
+        uint32 prefixSize = (star == NULL_PTR(const char8 *)) ? static_cast<uint32>(clause.pattern.Size()) : static_cast<uint32>(star - clause.pattern.Buffer());
+        clause.prefix = "";
+        (void) clause.prefix.Write(clause.pattern.Buffer(), prefixSize);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid query clause %s\n", clauseStr);
+    }
+    return ok;
+}
+
+/**
+ * @brief Returns true if the value of the key/value term \a term satisfies the comparison of \a clause.
+ */
+static bool CompareValue(const QueryClause &clause, const char8 * const term) {
+    const char8 *termValue = &term[clause.valueStart];
+    bool match = (clause.comparison == '=');
+    if (clause.comparison == '!') {
+        match = (StringHelper::Compare(termValue, clause.value.Buffer()) != 0);
+    }
+    else if (!match) {
+        char8 *end = NULL_PTR(char8 *);
+        float64 left = strtod(termValue, &end);
+        bool isNumber = (end != termValue) && (*end == '\0');
+        float64 right = strtod(clause.value.Buffer(), &end);
+        isNumber = (isNumber) && (end != clause.value.Buffer()) && (*end == '\0');
+        if (isNumber) {
+            if (clause.comparison == '<') {
+                match = (left < right);
+            }
+            else if (clause.comparison == 'l') {
+                match = (left <= right);
+            }
+            else if (clause.comparison == '>') {
+                match = (left > right);
+            }
+            else {
+                match = (left >= right);
+            }
+        }
+    }
+    else {
+        //Already matched by the pattern
+    }
+    return match;
+}
+
+/**
+ * @brief Gets the (sorted) nodes which satisfy \a clause. \a nodes is allocated with new[] and must be deleted by the caller.
+ */
+static bool EvaluateClause(const ConfigurationIndex &index, const QueryClause &clause, uint64 *&nodes, uint32 &numberOfNodes) {
+    bool ok = true;
+    uint32 capacity = 64u;
+    nodes = new uint64[capacity];
+    numberOfNodes = 0u;
+    uint32 prefixSize = static_cast<uint32>(clause.prefix.Size());
+    uint32 termIdx = index.LowerBound(clause.prefix.Buffer());
+    bool inRange = true;
+    while ((termIdx < index.GetNumberOfTerms()) && (inRange) && (ok)) {
+        StreamString term;
+        ok = index.GetTerm(termIdx, term);
+        if (ok) {
+            inRange = (StringHelper::CompareN(term.Buffer(), clause.prefix.Buffer(), prefixSize) == 0);
+        }
+        if ((ok) && (inRange) && (GlobMatch(clause.pattern.Buffer(), term.Buffer())) && (CompareValue(clause, term.Buffer()))) {
+            uint64 *postings = NULL_PTR(uint64 *);
+            uint32 numberOfPostings = 0u;
+            ok = index.GetPostings(termIdx, postings, numberOfPostings);
+            if (ok) {
+                if ((numberOfNodes + numberOfPostings) > capacity) {
+                    capacity = (numberOfNodes + numberOfPostings) * 2u;
+                    uint64 *newNodes = new uint64[capacity];
+                    (void) MemoryOperationsHelper::Copy(newNodes, nodes, static_cast<uint32>(numberOfNodes * sizeof(uint64)));
+                    delete [] nodes;
+                    nodes = newNodes;
+                }
+                (void) MemoryOperationsHelper::Copy(&nodes[numberOfNodes], postings, static_cast<uint32>(numberOfPostings * sizeof(uint64)));
+                numberOfNodes += numberOfPostings;
+            }
+            if (postings != NULL_PTR(uint64 *)) {
+                delete [] postings;
+            }
+        }
+        termIdx++;
+    }
+    numberOfNodes = SortUnique(nodes, numberOfNodes);
+    return ok;
+}
+
+/**
+ * @brief Prints the file and path of every node which satisfies all the \a numberOfClauses clauses.
+ * @return true if the index could be read. \a found is true if at least one node was printed.
+ */
+static bool Query(const char8 * const indexFilename, char8 ** const clauses, const uint32 numberOfClauses, bool &found) {
+    ConfigurationIndex index;
+    bool ok = index.Open(indexFilename);
+    uint64 *result = NULL_PTR(uint64 *);
+    uint32 resultSize = 0u;
+    uint32 c;
+    for (c = 0u; (c < numberOfClauses) && (ok); c++) {
+        QueryClause clause;
+        ok = ParseClause(clauses[c], clause);
+        uint64 *nodes = NULL_PTR(uint64 *);
+        uint32 numberOfNodes = 0u;
+        if (ok) {
+            ok = EvaluateClause(index, clause, nodes, numberOfNodes);
+        }
+        if ((ok) && (result == NULL_PTR(uint64 *))) {
+            result = nodes;
+            resultSize = numberOfNodes;
+            nodes = NULL_PTR(uint64 *);
+        }
+        else if (ok) {
+            //Intersect the sorted lists
+            uint32 a = 0u;
+            uint32 b = 0u;
+            uint32 k = 0u;
+            while ((a < resultSize) && (b < numberOfNodes)) {
+                if (result[a] < nodes[b]) {
+                    a++;
+                }
+                else if (nodes[b] < result[a]) {
+                    b++;
+                }
+                else {
+                    result[k] = result[a];
+                    k++;
+                    a++;
+                    b++;
+                }
+            }
+            resultSize = k;
+        }
+        else {
+            //Failed
+        }
+        if (nodes != NULL_PTR(uint64 *)) {
+            delete [] nodes;
+        }
+    }
+    uint32 i;
+    for (i = 0u; (i < resultSize) && (ok); i++) {
+        uint32 fileIdx = static_cast<uint32>(result[i] >> 32u);
+        uint32 nodeId = static_cast<uint32>(result[i] & 0xFFFFFFFFu);
+        StreamString fileName;
+        StreamString path;
+        uint64 hash = 0u;
+        ok = index.GetFile(fileIdx, fileName, hash);
+        if (ok) {
+            ok = index.GetNodePath(fileIdx, nodeId, path);
+        }
+        if (ok) {
+            printf("%s  %s\n", fileName.Buffer(), path.Buffer());
+        }
+    }
+    found = (resultSize > 0u);
+    if (result != NULL_PTR(uint64 *)) {
+        delete [] result;
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+int main(int argc, char **argv) {
+    Diagnostics::Install();
+    const char8 *args = "-u INDEX_FILE -if json|xml|cdb INPUT_FILE... | -l INDEX_FILE | -q INDEX_FILE CLAUSE...";
+    StreamString mode;
+    if (argc > 2) {
+        mode = argv[1];
+    }
+    bool ok = true;
+    bool found = true;
+    if ((mode == "-u") && (argc > 5)) {
+        ok = (StreamString("-if") == argv[3]);
+        if (ok) {
+            ok = UpdateIndex(argv[2], argv[4], &argv[5], static_cast<uint32>(argc - 5));
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
+        }
+    }
+    else if ((mode == "-l") && (argc == 3)) {
+        ConfigurationIndex index;
+        ok = index.Open(argv[2]);
+        uint32 i;
+        for (i = 0u; (i < index.GetNumberOfFiles()) && (ok); i++) {
+            StreamString fileName;
+            uint64 hash = 0u;
+            ok = index.GetFile(i, fileName, hash);
+            if (ok) {
+                printf("%016llx  %s\n", hash, fileName.Buffer());
+            }
+        }
+    }
+    else if ((mode == "-q") && (argc > 3)) {
+        ok = Query(argv[2], &argv[3], static_cast<uint32>(argc - 3), found);
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
+        ok = false;
+    }
+    int32 ret = ok ? (found ? 0 : 1) : -1;
+    return ret;
+}
+
@@ -28,40 +28,42 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include <stdio.h>
 #include "AdvancedErrorManagement.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationConverter.h"
 #include "ConfigurationDatabase.h"
-#include "Directory.h"
+#include "ConfigurationInclude.h"
+#include "ConfigurationSidecar.h"
+#include "ConfigurationStream.h"
+#include "Diagnostics.h"
 #include "File.h"
+#include "HashFunction.h"
 #include "JsonParser.h"
-#include "JsonPrinter.h"
 #include "ObjectRegistryDatabase.h"
+#include "ParallelJobRunner.h"
 #include "Reference.h"
 #include "ReferenceT.h"
 #include "StreamString.h"
 #include "StandardParser.h"
-#include "StandardPrinter.h"
-#include "StreamStructuredData.h"
-#include "StreamStructuredDataI.h"
+#include "ToolServer.h"
+#include "TypeConversion.h"
 #include "XMLParser.h"
-#include "XMLPrinter.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 using namespace MARTe;
 
-void MainErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo, const char * const errorDescription) {
-    MARTe::StreamString errorCodeStr;
-    MARTe::ErrorManagement::ErrorCodeToStream(errorInfo.header.errorType, errorCodeStr);
-    MARTe::StreamString err;
-    err.Printf("[%s - %s:%d]: %s", errorCodeStr.Buffer(), errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
-    printf("%s\n", err.Buffer());
-}
+/**
+ * Where the hashes (and the errors, see Diagnostics::SetOutput) are printed. The standard error is used when the standard output carries a converted configuration.
+ */
+static FILE *messageOutput = stdout;
 
 static bool ParseArgument(uint32 nargs, char8 **args, StreamString flag, StreamString &arg) {
     bool found = false;
@@ -77,119 +79,433 @@ static bool ParseArgument(uint32 nargs, char8 **args, StreamString flag, StreamS
     return found;
 }
 
-/*---------------------------------------------------------------------------*/
-/*                           Method definitions                              */
-/*---------------------------------------------------------------------------*/
-int main(int argc, char **argv) {
-    SetErrorProcessFunction(&MainErrorProcessFunction);
-    const char8 *args = "-i INPUT_FILE -o OUTPUT_FILE -if json|xml|cdb -of json|xml|cdb";
-    int32 nargs = 9u;
-    if (argc != nargs) {
-        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s (%d!=%d)\n", args, argc, nargs);
-        return -1;
+/**
+ * @brief Returns true if the argument \a flag (which has no value) was set.
+ */
+static bool HasFlagArgument(uint32 nargs, char8 **args, StreamString flag) {
+    bool found = false;
+    for (uint32 i=1u; (i<nargs) && (!found); i++) {
+        found = (flag == args[i]);
     }
-    StreamString inputFilename;
-    StreamString outputFilename;
-    StreamString inputFormat;
-    StreamString outputFormat;
-    bool ok = ParseArgument(argc, argv, "-i", inputFilename);
-    if (ok) {
-       ok = ParseArgument(argc, argv, "-o", outputFilename);
+    return found;
+}
+
+/**
+ * @brief Prints \a cdb into the standard output using the \a outputFormat.
+ * @param[in] canonical see ConfigurationConverter::Print.
+ * @param[out] hash if not NULL, the hash of the printed content.
+ */
+static bool PrintConfigurationToStandardOutput(ConfigurationDatabase &cdb, const StreamString &outputFormat, const bool canonical, uint64 * const hash) {
+    StreamString content;
+    bool ok = ConfigurationConverter::Print(cdb, content, outputFormat, canonical);
+    if ((ok) && (hash != NULL_PTR(uint64 *))) {
+        *hash = HashFunction::Fnv1a(content.Buffer(), static_cast<uint32>(content.Size()));
     }
     if (ok) {
-       ok = ParseArgument(argc, argv, "-if", inputFormat);
+        int32 fd = ConfigurationStream::OpenOutput("-");
+        ok = ConfigurationStream::WriteAll(fd, content.Buffer(), static_cast<uint32>(content.Size()));
     }
-    if (ok) {
-       ok = ParseArgument(argc, argv, "-of", outputFormat);
+    return ok;
+}
+
+/**
+ * @brief As ConfigurationConverter::PrintToFile but the file - is the standard output.
+ */
+static bool PrintConfigurationToOutput(ConfigurationDatabase &cdb, const StreamString &outputFilename, const StreamString &outputFormat, const bool canonical, uint64 * const hash, const bool compress) {
+    bool ok;
+    if ((outputFilename == "-") && (compress)) {
+        ok = ConfigurationConverter::PrintCompressed(cdb, ConfigurationStream::OpenOutput("-"), outputFormat, canonical, hash);
+    }
+    else if (outputFilename == "-") {
+        ok = PrintConfigurationToStandardOutput(cdb, outputFormat, canonical, hash);
     }
+    else {
+        ok = ConfigurationConverter::PrintToFile(cdb, outputFilename, outputFormat, canonical, hash, compress);
+    }
+    return ok;
+}
 
-    File inputFile;
+/**
+ * @brief Handles the ToolServer requests. The only supported Command is Convert, with the leaves:
+ *  - InputFormat and OutputFormat (json, xml or cdb);
+ *  - Input: the input file. If not set the request body is converted;
+ *  - Output: the output file. If not set the converted configuration is returned in the response;
+ *  - Canonical: if set to 1 the configuration is converted to its canonical form.
+ */
+static bool HandleRequest(ConfigurationDatabase &request, StreamString &body, ConfigurationCache &cache, StreamString &response) {
+    StreamString command;
+    StreamString inputFilename;
+    StreamString outputFilename;
+    StreamString inputFormat;
+    StreamString outputFormat;
+    bool ok = request.Read("Command", command);
     if (ok) {
-        ok = inputFile.Open(inputFilename.Buffer(), BasicFile::ACCESS_MODE_R);
+        ok = (command == "Convert");
         if (!ok) {
-            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", inputFilename.Buffer());
+            (void) response.Printf("Unknown command %s", command.Buffer());
         }
     }
     if (ok) {
-        ok = inputFile.Seek(0);
+        ok = request.Read("InputFormat", inputFormat);
+        if (ok) {
+            ok = request.Read("OutputFormat", outputFormat);
+        }
+        if (!ok) {
+            (void) response.Printf("%s", "InputFormat and OutputFormat shall be specified");
+        }
+    }
+    uint32 canonical = 0u;
+    if (!request.Read("Canonical", canonical)) {
+        canonical = 0u;
     }
     ConfigurationDatabase parsedConfiguration;
     if (ok) {
         StreamString parserError;
-        if (inputFormat == "xml") {
-            XMLParser parser(inputFile, parsedConfiguration, &parserError);
-            ok = parser.Parse();
+        const bool hasInputFile = request.Read("Input", inputFilename);
+        if (!hasInputFile) {
+            inputFilename = "-";
         }
-        else if (inputFormat == "json") {
-            JsonParser parser(inputFile, parsedConfiguration, &parserError);
-            ok = parser.Parse();
-        }
-        else if (inputFormat == "cdb") {
-            StandardParser parser(inputFile, parsedConfiguration, &parserError);
-            ok = parser.Parse();
+        Diagnostics::SetContext(inputFilename.Buffer());
+        if (hasInputFile) {
+            ok = cache.GetFile(inputFilename.Buffer(), inputFormat.Buffer(), parsedConfiguration, parserError);
         }
         else {
-            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown input format specified");
+            ok = cache.GetContent(body, inputFormat.Buffer(), parsedConfiguration, parserError);
         }
         if (!ok) {
-            StreamString errPrint;
-            (void) errPrint.Printf("Failed to parse %s", parserError.Buffer());
-            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, errPrint.Buffer());
+            (void) response.Printf("Failed to parse %s", parserError.Buffer());
+        }
+        else if (!ConfigurationInclude::Resolve(parsedConfiguration, inputFilename.Buffer(), inputFormat.Buffer())) {
+            (void) response.Printf("Failed to compose %s", inputFilename.Buffer());
+            ok = false;
+        }
+        else if (!ConfigurationSidecar::Load(parsedConfiguration, inputFilename.Buffer())) {
+            (void) response.Printf("Failed to load the sidecar arrays of %s", inputFilename.Buffer());
+            ok = false;
+        }
+        else {
+            //Composed
         }
     }
     if (ok) {
-        ok = inputFile.Close();
+        if (request.Read("Output", outputFilename)) {
+            ok = ConfigurationConverter::PrintToFile(parsedConfiguration, outputFilename, outputFormat, (canonical == 1u));
+        }
+        else {
+            ok = ConfigurationConverter::Print(parsedConfiguration, response, outputFormat, (canonical == 1u));
+        }
+        if (!ok) {
+            (void) response.Printf("Failed to print the configuration in %s", outputFormat.Buffer());
+        }
     }
-    if (ok) {
-        ok = parsedConfiguration.MoveToRoot();
+    Diagnostics::SetContext(NULL_PTR(const char8 *));
+    return ok;
+}
+
+/**
+ * One output of a conversion.
+ */
+struct ConversionOutput {
+    StreamString filename;
+    StreamString format;
+    bool canonical;
+    bool printHash;
+    bool compress;
+    uint64 hash;
+    const char8 *inputFilename;
+
+    /**
+     * Shares the (read-only) parsed tree, with its own current node.
+     */
+    ConfigurationDatabase cdb;
+};
+
+/**
+ * @brief Growable list of the outputs of a conversion.
+ */
+class ConversionOutputList {
+public:
+    ConversionOutputList() {
+        numberOfOutputs = 0u;
+        capacity = 4u;
+        outputs = new ConversionOutput[capacity];
     }
-    if (ok) {
+
+    ~ConversionOutputList() {
+        delete [] outputs;
     }
-    File outputFile;
-    if (ok) {
-        Directory d(outputFilename.Buffer());
-        d.Delete();
 
-        ok = outputFile.Open(outputFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
-        if (!ok) {
-            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", outputFilename.Buffer());
+    void Add(const char8 * const filename, const char8 * const format) {
+        if (numberOfOutputs == capacity) {
+            ConversionOutput *newOutputs = new ConversionOutput[capacity * 2u];
+            uint32 i;
+            for (i = 0u; i < numberOfOutputs; i++) {
+                newOutputs[i].filename = outputs[i].filename;
+                newOutputs[i].format = outputs[i].format;
+            }
+            delete [] outputs;
+            outputs = newOutputs;
+            capacity *= 2u;
         }
+        outputs[numberOfOutputs].filename = filename;
+        outputs[numberOfOutputs].format = format;
+        outputs[numberOfOutputs].canonical = false;
+        outputs[numberOfOutputs].printHash = false;
+        outputs[numberOfOutputs].compress = false;
+        outputs[numberOfOutputs].hash = 0u;
+        outputs[numberOfOutputs].inputFilename = NULL_PTR(const char8 *);
+        numberOfOutputs++;
+    }
+
+    ConversionOutput *outputs;
+    uint32 numberOfOutputs;
+
+private:
+    uint32 capacity;
+};
+
+/**
+ * @brief Adds to \a outputList the outputs listed in the manifest \a manifestFilename: one output per line, with the output format
+ * followed by the output file (e.g. json RTApp-1.json). Empty lines and lines starting with # are ignored.
+ */
+static bool ReadOutputManifest(const char8 * const manifestFilename, ConversionOutputList &outputList) {
+    StreamString content;
+    bool ok = ConfigurationCache::ReadFile(manifestFilename, content);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to read the output manifest %s\n", manifestFilename);
     }
-    StreamStructuredDataI *sdata = NULL_PTR(StreamStructuredDataI *);
     if (ok) {
-        if (outputFormat == "xml") {
-            sdata = new StreamStructuredData<XMLPrinter>(outputFile);
+        ok = content.Seek(0LLU);
+    }
+    StreamString line;
+    char8 terminator;
+    while ((ok) && (content.GetToken(line, "\n", terminator, "\r"))) {
+        StreamString format;
+        StreamString filename;
+        char8 separator;
+        ok = line.Seek(0LLU);
+        bool hasFormat = (ok) && (line.GetToken(format, " \t", separator));
+        if ((hasFormat) && (format.Buffer()[0] != '#')) {
+            //The rest of the line is the file name
+            uint32 start = static_cast<uint32>(line.Position());
+            while ((start < line.Size()) && ((line.Buffer()[start] == ' ') || (line.Buffer()[start] == '\t'))) {
+                start++;
+            }
+            ok = (start < line.Size());
+            if (ok) {
+                outputList.Add(&(line.Buffer()[start]), format.Buffer());
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "No output file for the format %s in %s\n", format.Buffer(), manifestFilename);
+            }
         }
-        else if (outputFormat == "json") {
-            sdata = new StreamStructuredData<JsonPrinter>(outputFile);
-            dynamic_cast<StreamStructuredData<JsonPrinter> *>(sdata)->GetPrinter()->PrintBegin();
+        line = "";
+    }
+    return ok;
+}
+
+/**
+ * @brief Prints the ConversionOutput with index \a jobIndex (of the array \a context).
+ */
+static bool PrintOutputJob(void * const context, const uint32 jobIndex) {
+    ConversionOutput *output = &(static_cast<ConversionOutput *>(context)[jobIndex]);
+    Diagnostics::SetContext(output->inputFilename);
+    bool ok = PrintConfigurationToOutput(output->cdb, output->filename, output->format, output->canonical, output->printHash ? &output->hash : NULL_PTR(uint64 *), output->compress);
+    Diagnostics::SetContext(NULL_PTR(const char8 *));
+    return ok;
+}
+
+/**
+ * @brief Prints one document of a multi-document stream with the format and the options of the ConversionOutput \a context.
+ */
+static bool PrintStreamDocument(void * const context, ConfigurationDatabase &cdb, StreamString &output) {
+    ConversionOutput *conversion = static_cast<ConversionOutput *>(context);
+    return ConfigurationConverter::Print(cdb, output, conversion->format, conversion->canonical);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+int main(int argc, char **argv) {
+    Diagnostics::Install();
+    const char8 *args = "-i INPUT_FILE -if json|xml|cdb (-o OUTPUT_FILE -of json|xml|cdb)... [-outputs MANIFEST_FILE] [--canonical] [--hash] [-compress gzip] [-sidecar SIDECAR_FILE [-sidecarthreshold N]] [-stream length|delimiter [-delimiter LINE]] (or -server SOCKET_PATH). The file - is the standard input/output. The .gz outputs are always compressed";
+    if ((argc == 3) && (StreamString("-server") == argv[1])) {
+        ToolServer server(&HandleRequest);
+        bool ok = server.Start(argv[2]);
+        return ok ? 0 : -1;
+    }
+    bool printHash = HasFlagArgument(argc, argv, "--hash");
+    //The hash is only meaningful for the canonical form
+    bool canonical = (printHash || HasFlagArgument(argc, argv, "--canonical"));
+    StreamString inputFilename;
+    StreamString inputFormat;
+    StreamString streamFraming;
+    StreamString delimiter = "---";
+    StreamString compression;
+    StreamString sidecarFilename;
+    //Arrays with fewer elements are printed inline
+    uint32 sidecarThreshold = 1024u;
+    ConversionOutputList outputList;
+    //The n-th -o is paired with the n-th -of
+    uint32 numberOfOutputFormats = 0u;
+    bool ok = true;
+    int32 i;
+    for (i = 1; (i < argc) && (ok); i++) {
+        StreamString arg = argv[i];
+        if ((arg == "--canonical") || (arg == "--hash")) {
+            //Already handled
         }
-        else if (outputFormat == "cdb") {
-            sdata = new StreamStructuredData<StandardPrinter>(outputFile);
+        else if ((i + 1) < argc) {
+            i++;
+            if (arg == "-i") {
+                inputFilename = argv[i];
+            }
+            else if (arg == "-if") {
+                inputFormat = argv[i];
+            }
+            else if (arg == "-o") {
+                outputList.Add(argv[i], "");
+            }
+            else if (arg == "-of") {
+                ok = (numberOfOutputFormats < outputList.numberOfOutputs);
+                if (ok) {
+                    outputList.outputs[numberOfOutputFormats].format = argv[i];
+                    numberOfOutputFormats++;
+                }
+            }
+            else if (arg == "-stream") {
+                streamFraming = argv[i];
+                ok = (streamFraming == "length") || (streamFraming == "delimiter");
+            }
+            else if (arg == "-compress") {
+                compression = argv[i];
+                ok = (compression == "gzip");
+            }
+            else if (arg == "-sidecar") {
+                sidecarFilename = argv[i];
+            }
+            else if (arg == "-sidecarthreshold") {
+                ok = TypeConvert(sidecarThreshold, argv[i]);
+            }
+            else if (arg == "-delimiter") {
+                delimiter = argv[i];
+                ok = (delimiter.Size() > 0u);
+            }
+            else if (arg == "-outputs") {
+                ok = (numberOfOutputFormats == outputList.numberOfOutputs);
+                if (ok) {
+                    ok = ReadOutputManifest(argv[i], outputList);
+                    numberOfOutputFormats = outputList.numberOfOutputs;
+                }
+            }
+            else {
+                ok = false;
+            }
         }
         else {
-            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown output format specified");
+            ok = false;
         }
-
     }
     if (ok) {
-        ok = parsedConfiguration.Copy(*sdata);
+        ok = (inputFilename.Size() > 0u) && (inputFormat.Size() > 0u) && (outputList.numberOfOutputs > 0u) && (numberOfOutputFormats == outputList.numberOfOutputs);
+    }
+    if ((ok) && (streamFraming.Size() > 0u)) {
+        //A stream is converted into a single output stream
+        ok = (outputList.numberOfOutputs == 1u) && (!printHash) && (compression.Size() == 0u) && (sidecarFilename.Size() == 0u);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
+        return -1;
+    }
+    uint32 o;
+    for (o = 0u; o < outputList.numberOfOutputs; o++) {
+        if (outputList.outputs[o].filename == "-") {
+            messageOutput = stderr;
+            Diagnostics::SetOutput(STDERR_FILENO);
+        }
     }
+
+    Diagnostics::SetContext(inputFilename.Buffer());
+    if (streamFraming.Size() > 0u) {
+        int32 inputFd = ConfigurationStream::OpenInput(inputFilename.Buffer());
+        int32 outputFd = ConfigurationStream::OpenOutput(outputList.outputs[0].filename.Buffer());
+        ok = (inputFd >= 0) && (outputFd >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open %s or %s\n", inputFilename.Buffer(), outputList.outputs[0].filename.Buffer());
+        }
+        if (ok) {
+            outputList.outputs[0].canonical = canonical;
+            ConfigurationStream stream(inputFd, outputFd, inputFormat.Buffer(), (streamFraming == "delimiter") ? delimiter.Buffer() : NULL_PTR(const char8 *));
+            ok = stream.Convert(&PrintStreamDocument, &outputList.outputs[0]);
+        }
+        (void) ConfigurationStream::Close(inputFd);
+        if (!ConfigurationStream::Close(outputFd)) {
+            ok = false;
+        }
+        Diagnostics::SetContext(NULL_PTR(const char8 *));
+        return ok ? 0 : -1;
+    }
+
+    File inputFile;
+    StreamString standardInput;
+    BufferedStreamI *input = &inputFile;
+    if (inputFilename == "-") {
+        input = &standardInput;
+        ok = ConfigurationStream::ReadAll(ConfigurationStream::OpenInput("-"), standardInput);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to read the standard input\n");
+        }
+    }
+    else {
+        ok = inputFile.Open(inputFilename.Buffer(), BasicFile::ACCESS_MODE_R);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", inputFilename.Buffer());
+        }
+    }
+    ConfigurationDatabase parsedConfiguration;
     if (ok) {
-        if (outputFormat == "json") {
-            dynamic_cast<StreamStructuredData<JsonPrinter> *>(sdata)->GetPrinter()->PrintEnd();
+        StreamString parserError;
+        ok = ConfigurationCache::Parse(*input, inputFormat.Buffer(), parsedConfiguration, parserError);
+        if (!ok) {
+            StreamString errPrint;
+            (void) errPrint.Printf("Failed to parse %s", parserError.Buffer());
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, errPrint.Buffer());
         }
     }
+    if ((ok) && (inputFile.IsOpen())) {
+        ok = inputFile.Close();
+    }
+    if (ok) {
+        ok = ConfigurationInclude::Resolve(parsedConfiguration, inputFilename.Buffer(), inputFormat.Buffer());
+    }
+    if (ok) {
+        //Inlines the arrays of any sidecar file referred by the input
+        ok = ConfigurationSidecar::Load(parsedConfiguration, inputFilename.Buffer());
+    }
+    if ((ok) && (sidecarFilename.Size() > 0u)) {
+        ok = ConfigurationSidecar::Extract(parsedConfiguration, sidecarFilename.Buffer(), sidecarThreshold);
+    }
     if (ok) {
-        ok = outputFile.Flush();
+        ok = parsedConfiguration.MoveToRoot();
     }
     if (ok) {
-        ok = outputFile.Close();
+        //Each printer walks the shared tree with its own ConfigurationDatabase. These are created here so that the tree reference is only shared from this thread.
+        for (o = 0u; o < outputList.numberOfOutputs; o++) {
+            outputList.outputs[o].cdb = parsedConfiguration;
+            outputList.outputs[o].canonical = canonical;
+            outputList.outputs[o].printHash = printHash;
+            outputList.outputs[o].compress = (compression.Size() > 0u);
+            outputList.outputs[o].inputFilename = inputFilename.Buffer();
+        }
+        ParallelJobRunner runner(outputList.numberOfOutputs);
+        ok = runner.Run(&PrintOutputJob, outputList.outputs, outputList.numberOfOutputs);
     }
-    if (sdata != NULL_PTR(StreamStructuredDataI *)) {
-        delete sdata;
+    if ((ok) && (printHash)) {
+        for (o = 0u; o < outputList.numberOfOutputs; o++) {
+            fprintf(messageOutput, "%016llx  %s\n", outputList.outputs[o].hash, outputList.outputs[o].filename.Buffer());
+        }
     }
+    Diagnostics::SetContext(NULL_PTR(const char8 *));
     int32 ret = ok ? 0 : -1;
     return ret;
 }
-
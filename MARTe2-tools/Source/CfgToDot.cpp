@@ -23,316 +23,106 @@
 
 /**
  * This tool allows to export the links between several components of a MARTe2
- * RealTimeApplication into several Graphviz dot files.
+ * RealTimeApplication into several Graphviz dot files. The model and the graphs are built by the ConfigurationGraphs functions.
  */
 
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include <stdio.h>
 #include "AdvancedErrorManagement.h"
-#include "ClassRegistryDatabase.h"
-#include "ClassRegistryItem.h"
+#include "BasicFile.h"
+#include "ConfigurationCache.h"
 #include "ConfigurationDatabase.h"
+#include "ConfigurationGraphs.h"
+#include "ConfigurationInclude.h"
+#include "Diagnostics.h"
 #include "Directory.h"
 #include "File.h"
-#include "GlobalObjectsDatabase.h"
-#include "Object.h"
-#include "ObjectRegistryDatabase.h"
-#include "ProcessorType.h"
-#include "RealTimeApplication.h"
-#include "Reference.h"
-#include "ReferenceT.h"
+#include "HighResolutionTimer.h"
 #include "StreamString.h"
-#include "StandardParser.h"
-#include "StateMachine.h"
-#include "StaticList.h"
+#include "StringHelper.h"
+#include "ToolServer.h"
+#include "TypeConversion.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 using namespace MARTe;
 
-void MainErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo, const char * const errorDescription) {
-    MARTe::StreamString errorCodeStr;
-    MARTe::ErrorManagement::ErrorCodeToStream(errorInfo.header.errorType, errorCodeStr);
-    MARTe::StreamString err;
-    err.Printf("[%s - %s:%d]: %s", errorCodeStr.Buffer(), errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
-    printf("%s\n", err.Buffer());
-}
-
-/**
- * Wraps the concept of a MARTe2 RealTimeState
- */
-class GraphvizState : public ReferenceContainer {
-public:
-    CLASS_REGISTER_DECLARATION()
-    GraphvizState() : ReferenceContainer() {
-    }
-    virtual ~GraphvizState() {
-    }
-private:
-    
-};
-CLASS_REGISTER(GraphvizState, "");
-
-/**
- * Wraps the concept of a MARTe2 RealTimeThread
- */
-class GraphvizThread : public ReferenceContainer {
-public:
-    CLASS_REGISTER_DECLARATION()
-    GraphvizThread() : ReferenceContainer() {
-    }
-    virtual ~GraphvizThread() {
-    }
-private:
-    
-};
-CLASS_REGISTER(GraphvizThread, "");
-
-/**
- * Wraps the concept of a MARTe2 DataSource
- */
-class GraphvizDataSource : public Object {
-public:
-    CLASS_REGISTER_DECLARATION()
-    GraphvizDataSource() : Object() {
-    }
-    virtual ~GraphvizDataSource() {
-    }
-
-    void SetClassName(StreamString classNameIn) {
-        className = classNameIn;
+static bool ParseArgument(uint32 nargs, char8 **args, StreamString flag, StreamString &arg, bool required = true) {
+    bool found = false;
+    for (uint32 i=1u; (i<(nargs - 1u) && (!found)); i++) {
+        found = (flag == args[i]);
+        if (found) {
+            arg = args[i + 1];
+        }
     }
-
-    StreamString GetClassName() const {
-        return className;
+    if ((!found) && (required)) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Input parameter %s not found\n", flag.Buffer());
     }
-
-private:
-    StreamString className;    
-};
-CLASS_REGISTER(GraphvizDataSource, "");
-
+    return found;
+}
 
 /**
- * Wraps the concept of a MARTe2 Function
+ * @brief Returns true if the argument \a flag (which has no value) was set.
  */
-class GraphvizFunction : public Object {
-public:
-    CLASS_REGISTER_DECLARATION()
-    GraphvizFunction() : Object() {
-        inputDataSources = Reference(new ReferenceContainer());
-        outputDataSources = Reference(new ReferenceContainer());
-    }
-    virtual ~GraphvizFunction() {
-    }
-
-    void SetQualifiedName(StreamString qualifiedNameIn) {
-        qualifiedName = qualifiedNameIn;
-    }
-
-    StreamString GetQualifiedName() const {
-        return qualifiedName;
-    }
-
-    void SetClassName(StreamString classNameIn) {
-        className = classNameIn;
-    }
-
-    StreamString GetClassName() const {
-        return className;
-    }
-
-    void AddInputDataSource(ReferenceT<GraphvizDataSource> dataSource) {
-        uint32 i;
-        bool found = false;
-        StreamString dataSourceToAddName = dataSource->GetName();
-        for (i=0; (i<inputDataSources->Size()) && (!found); i++) {
-            StreamString dataSourceName = inputDataSources->Get(i)->GetName();
-            found = (dataSourceToAddName == dataSourceName);
-        }
-        if (!found) {
-            inputDataSources->Insert(dataSource);
-        }
-    }
-
-    void AddOutputDataSource(ReferenceT<GraphvizDataSource> dataSource) {
-        uint32 i;
-        bool found = false;
-        StreamString dataSourceToAddName = dataSource->GetName();
-        for (i=0; (i<outputDataSources->Size()) && (!found); i++) {
-            StreamString dataSourceName = outputDataSources->Get(i)->GetName();
-            found = (dataSourceToAddName == dataSourceName);
-        }
-        if (!found) {
-            outputDataSources->Insert(dataSource);
-        }
-    }
-
-    ReferenceT<ReferenceContainer> GetInputDataSources() {
-        return inputDataSources;
-    }
-
-    ReferenceT<ReferenceContainer> GetOutputDataSources() {
-        return outputDataSources;
+static bool HasFlagArgument(uint32 nargs, char8 **args, StreamString flag) {
+    bool found = false;
+    for (uint32 i=1u; (i<nargs) && (!found); i++) {
+        found = (flag == args[i]);
     }
-
-private:
-    StreamString className;    
-    StreamString qualifiedName;    
-    ReferenceT<ReferenceContainer> inputDataSources;    
-    ReferenceT<ReferenceContainer> outputDataSources;    
-};
-CLASS_REGISTER(GraphvizFunction, "");
+    return found;
+}
 
 /**
- * @brief Recursevily adds a MARTe2 function to the existentFunctions list, keeping the fully qualified function name (i.e. keeping the parents path)
- * @param[out] existentFunctions list where to add the GraphvizFunction to.
- * @param[in] threadI the RealTimeThead which executes this function.
- * @param[in] cdb which must point at the +Functions node when it enters here the first time.
- * @param[out] fullFunctionName the function name including all the path not separated by dots.
- * @param[out] qualifiedFunctionName the function name including all the path separated by dots.
- * @return true if all the movements in the ConfigurationDatabase are valid.
+ * @brief Reads the optional numeric argument \a flag into \a arg. \a arg is not modified if the flag is not set.
+ * @return false if the flag is set but its value is not a valid number.
  */
-static bool AddFunction(ReferenceT<ReferenceContainer> existentFunctions, ReferenceT<GraphvizThread> threadI, StreamString functionToAdd, ConfigurationDatabase cdb, StreamString fullFunctionName, StreamString qualifiedFunctionName) {
-    bool ok = cdb.MoveRelative(functionToAdd.Buffer());
-    StreamString className;
-    if (ok) {
-        ok = cdb.Read("Class", className);
-    }
-    if (ok) {
-        if (className == "ReferenceContainer") {
-            uint32 c;
-            uint32 numberOfChildren = cdb.GetNumberOfChildren();
-            StreamString recursiveFunctionName = fullFunctionName;
-            StreamString recursiveQualifiedFunctionName = qualifiedFunctionName;
-            for (c=0; c<numberOfChildren; c++) {
-                fullFunctionName = recursiveFunctionName;
-                qualifiedFunctionName = recursiveQualifiedFunctionName; 
-                StreamString nextFunctionName = cdb.GetChildName(c);
-                if (cdb.MoveRelative(nextFunctionName.Buffer())) {
-                    if(fullFunctionName.Size() > 0) {
-                        fullFunctionName.Printf(".", voidAnyType);
-                        qualifiedFunctionName.Printf(".", voidAnyType);
-                    }
-                    functionToAdd.Seek(1);
-                    fullFunctionName.Printf("%s", functionToAdd);
-                    qualifiedFunctionName.Printf("%s", functionToAdd.Buffer());
-                    //The recursion will make this move again
-                    cdb.MoveToAncestor(1);
-                    ok = AddFunction(existentFunctions, threadI, nextFunctionName, cdb, fullFunctionName, qualifiedFunctionName);
-                }
-            } 
-        }
-        else {
-            //Check if the function already exists in the existentFunctions
-            uint32 f;
-            bool found = false;
-            for (f=0; (f<existentFunctions->Size()) && (!found); f++) {
-                ReferenceT<GraphvizFunction> function = existentFunctions->Get(f);
-                found = (functionToAdd == function->GetName());
-            }
-            if (!found) {
-                ReferenceT<GraphvizFunction> function = Reference(new GraphvizFunction()); 
-                StreamString thisFunctionName = cdb.GetName();
-                thisFunctionName.Seek(1);
-                if(fullFunctionName.Size() > 0) {
-                    fullFunctionName.Printf(".", voidAnyType);
-                    qualifiedFunctionName.Printf(".", voidAnyType);
-                }
-                fullFunctionName.Printf("%s", thisFunctionName);
-                qualifiedFunctionName.Printf("%s", thisFunctionName.Buffer());
-                function->SetName(fullFunctionName.Buffer());
-                function->SetQualifiedName(qualifiedFunctionName);
-                if (ok) {
-                    function->SetClassName(className);
-                    existentFunctions->Insert(function);
-                    threadI->Insert(function);
-                } 
-            }
+static bool ParseUInt32Argument(uint32 nargs, char8 **args, StreamString flag, uint32 &arg) {
+    StreamString argStr;
+    bool ok = true;
+    if (ParseArgument(nargs, args, flag, argStr, false)) {
+        ok = TypeConvert(arg, argStr.Buffer());
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid value %s for parameter %s\n", argStr.Buffer(), flag.Buffer());
         }
     }
     return ok;
 }
 
 /**
- * @brief Checks which data sources interact with the \a function.
- * @param[in] cdb the ConfigurationDatabase pointing at the RealTimeApplication root.
- * @param[in] dataSourceList list of existent DataSources
- * @param[in] function the Functon to query.
- * @return true if no errors are found while moving to the ConfigurationDatabase subtrees.
+ * @brief Converts the name of a model format (json or graphml) into \a modelFormat.
+ * @return false if the name is not valid.
  */
-static bool AddDataSourcesToFunction (ConfigurationDatabase cdb, ReferenceT<ReferenceContainer> dataSourceList, ReferenceT<GraphvizFunction> function) {
-    cdb.MoveRelative("+Functions");
-    bool ok = cdb.MoveRelative(function->GetQualifiedName().Buffer());
-    if (ok) {
-        //Extract from which DataSources this gam reads from/writes to and create as needed
-        if(cdb.MoveRelative("InputSignals")) {
-            uint32 numberOfInputSignals = cdb.GetNumberOfChildren();
-            uint32 n;
-            for (n=0; n<numberOfInputSignals; n++) {
-                StreamString signalName = cdb.GetChildName(n);
-                if (cdb.MoveRelative(signalName.Buffer())) {
-                    StreamString dataSourceName;
-                    if(cdb.Read("DataSource", dataSourceName)) {
-                        //Check if this data source already exists
-                        uint32 d;
-                        ReferenceT<GraphvizDataSource> dataSource;
-                        bool dataSourceExists = false;
-                        for (d=0; (d<dataSourceList->Size()) && (!dataSourceExists); d++) {
-                            dataSource = dataSourceList->Get(d);
-                            StreamString existentDataSourceName = &(dataSource->GetName())[1];
-                            dataSourceExists = (existentDataSourceName == dataSourceName);
-                        }
-                        if (dataSourceExists) {
-                            function->AddInputDataSource(dataSource);
-                        }
-                    }
-                    cdb.MoveToAncestor(1);
-                }
-            }
-            cdb.MoveToAncestor(1);
-        }
-        if(cdb.MoveRelative("OutputSignals")) {
-            uint32 numberOfOutputSignals = cdb.GetNumberOfChildren();
-            uint32 n;
-            for (n=0; n<numberOfOutputSignals; n++) {
-                StreamString signalName = cdb.GetChildName(n);
-                if (cdb.MoveRelative(signalName.Buffer())) {
-                    StreamString dataSourceName;
-                    if(cdb.Read("DataSource", dataSourceName)) {
-                        //Check if this data source already exists
-                        bool dataSourceExists = false;
-                        ReferenceT<GraphvizDataSource> dataSource;
-                        uint32 d;
-                        for (d=0; (d<dataSourceList->Size()) && (!dataSourceExists); d++) {
-                            dataSource = dataSourceList->Get(d);
-                            StreamString existentDataSourceName = &(dataSource->GetName())[1];
-                            dataSourceExists = (existentDataSourceName == dataSourceName);
-                        } 
-                        if (dataSourceExists) {
-                            function->AddOutputDataSource(dataSource);
-                        }
-                    }
-                    cdb.MoveToAncestor(1);
-                }
-            }
-            cdb.MoveToAncestor(1);
-        }
+static bool ParseModelFormat(const StreamString &modelFormatName, ApplicationModelFormat &modelFormat) {
+    bool ok = true;
+    if (modelFormatName == "json") {
+        modelFormat = ApplicationModelJson;
+    }
+    else if (modelFormatName == "graphml") {
+        modelFormat = ApplicationModelGraphML;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid model format %s\n", modelFormatName.Buffer());
+        ok = false;
     }
     return ok;
 }
 
 /**
- * @brief Parses the configuration file from \a inputFilename and adds (and links) all the states to stateList, the functions to functionList and the data sources to the dataSourceList.
+ * @brief Parses the configuration file from \a inputFilename into \a cdb.
+ * @param[out] includedFilenames if not NULL, the fragments read (see ConfigurationInclude::Resolve).
  */
-static bool ParseConfigurationFile(StreamString inputFilename, ReferenceT<ReferenceContainer> stateList, ReferenceT<ReferenceContainer> functionList, ReferenceT<ReferenceContainer> dataSourceList, ConfigurationDatabase &cdb) {
+static bool ParseConfigurationFile(StreamString inputFilename, ConfigurationDatabase &cdb, StreamString * const includedFilenames = NULL_PTR(StreamString *)) {
     BasicFile inputFile;
     bool ok = inputFile.Open(inputFilename.Buffer(), BasicFile::ACCESS_MODE_R);
     if (ok) {
@@ -343,566 +133,362 @@ static bool ParseConfigurationFile(StreamString inputFilename, ReferenceT<Refere
     }
     StreamString err;
     if (ok) {
-        StandardParser parser(inputFile, cdb, &err);
-        ok = parser.Parse();
+        ok = ConfigurationCache::Parse(inputFile, "cdb", cdb, err);
     }
     if (!ok) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to parse %s\n", err.Buffer());
     }
     inputFile.Close();
-
-    //Find the realtime application
-    uint32 i;
-    bool found = false;
-    uint32 numberOfNodesAfterRoot = cdb.GetNumberOfChildren(); 
-    for (i=0; (i<numberOfNodesAfterRoot) && (ok) && (!found); i++) {
-        ok = cdb.MoveToChild(i);
-        StreamString className;
-        if (ok) {
-            ok = cdb.Read("Class", className);
-        }
-        if (ok) {
-            found = (className == "RealTimeApplication");
-            if (!found) {
-                ok = cdb.MoveToAncestor(1);
-            }
-        }
-    }
     if (ok) {
-        ok = found;
-        if (!ok) {
-            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not find the RealTimeApplication\n");
-        }
-    }
- 
-    ConfigurationDatabase cdbRTApp;
-    //Load all the GAMs
-    if (ok) {
-        cdbRTApp = cdb;
-        //Move to the states
-        ok = cdb.MoveRelative("+States");
-        uint32 numberOfStates = cdb.GetNumberOfChildren();
-        
-        //For each state get the number of threads
-        uint32 s;
-        for (s=0; (s<numberOfStates) && (ok); s++) {
-            StreamString stateName = cdb.GetChildName(s);
-            ConfigurationDatabase cdbState = cdb;
-            if (cdb.MoveRelative(stateName.Buffer())) {
-                ReferenceT<GraphvizState> state = Reference(new GraphvizState());
-                state->SetName(&(stateName.Buffer()[1]));
-                stateList->Insert(state);
-                uint32 t;
-                uint32 numberOfThreads;
-                if (ok) {
-                    ok = cdb.MoveRelative("+Threads");
-                }
-                if (ok) {
-                    numberOfThreads = cdb.GetNumberOfChildren();
-                }
-                ConfigurationDatabase cdbThread = cdb;
-                for (t=0; (t<numberOfThreads) && (ok); t++) {
-                    StreamString threadName = cdb.GetChildName(t);
-                    if(cdb.MoveRelative(threadName.Buffer())) { 
-                        ReferenceT<GraphvizThread> threadI = Reference(new GraphvizThread()); 
-                        threadI->SetName(&(threadName.Buffer()[1]));
-                        state->Insert(threadI);
-                        //Read all the GAMs that are executed by this thread
-                        AnyType functionsType = cdb.GetType("Functions");
-                        ok = !functionsType.IsVoid();
-                        if (ok) {
-                            ok = (functionsType.GetNumberOfDimensions() == 1u);
-                            uint32 numberOfFunctions = functionsType.GetNumberOfElements(0u);
-                            Vector<StreamString> functions(numberOfFunctions);
-                            if (ok) {
-                                ok = cdb.Read("Functions", functions);
-                            }
-                            uint32 f;
-                            for (f=0; (f<numberOfFunctions) && (ok); f++) {
-                                //Find the class name
-                                cdb = cdbRTApp;
-                                cdb.MoveRelative("+Functions");
-                                StreamString functionName;
-                                functionName.Printf("+%s", functions[f].Buffer());
-                                ok = AddFunction(functionList, threadI, functionName.Buffer(), cdb, "", "");
-                            }
-                        }
-                    }
-                    cdb = cdbThread;
-                }
-            } 
-            cdb = cdbState;
-        }
-    }
-    //Create all the data sources
-    cdb = cdbRTApp;
-    ok = cdb.MoveRelative("+Data"); 
-    uint32 c;
-    for (c=0; (c<cdb.GetNumberOfChildren()) && (ok); c++) {
-        StreamString dataSourceName = cdb.GetChildName(c);
-        if (cdb.MoveRelative(dataSourceName.Buffer())) {
-            ReferenceT<GraphvizDataSource> dataSource = Reference(new GraphvizDataSource());
-            StreamString className;
-            if (ok) {
-                ok = cdb.Read("Class", className);
-            }
-            dataSource->SetName(dataSourceName.Buffer());
-            dataSource->SetClassName(className.Buffer());
-            dataSourceList->Insert(dataSource);
-            cdb.MoveToAncestor(1);
-        }
-    }
-    //Link the data sources to the functions
-    uint32 f; 
-    for (f=0; (f<functionList->Size()) && (ok); f++) {
-        ReferenceT<GraphvizFunction> function = functionList->Get(f);
-        ok = AddDataSourcesToFunction(cdbRTApp, dataSourceList, function);
-    }
-    
-    return ok; 
-}
-
-
-//The style to apply to the functions. This could be read from an external configuration file in the future.
-#define GRAPHVIZ_FONT_SIZE 12
-static void GraphvizFunctionStyle(File &outputFile, const char8 *const functionName, const char8 *const className, const char8 * const style="filled", const char8 *const fillColor="white", const char8 * const color="blue", uint32 fontSize=GRAPHVIZ_FONT_SIZE) {
-    outputFile.Printf("[shape=record, style=%s, fillcolor=%s, color=%s,label=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\"><font point-size=\"%d\">%s <BR/>(%s)</font></TD></TR></TABLE>>]", style, fillColor, color, fontSize, functionName, className);
-}
-
-static void GraphvizDataSourceStyle(File &outputFile, const char8 *const dataSourceName, const char8 *const className, const char8 * const style="filled", const char8 *const fillColor="white", const char8 * const color="darkgreen", uint32 fontSize=GRAPHVIZ_FONT_SIZE) {
-    outputFile.Printf("[shape=record, style=%s, fillcolor=%s, color=%s,label=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\"><font point-size=\"%d\">%s <BR/>(%s)</font></TD></TR></TABLE>>]", style, fillColor, color, fontSize, dataSourceName, className);
-}
-
-static void GraphvizStateMachineStyle(File &outputFile, const char8 *const stateName, uint32 numberOfEnterActions, const char8* const actionList, const char8 * const style="filled", const char8 *const fillColor="white", const char8 * const color="red", uint32 fontSize=GRAPHVIZ_FONT_SIZE) {
-    if (numberOfEnterActions == 0) {
-        outputFile.Printf("[style=%s, fillcolor=%s, color=%s,label=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\"><font point-size=\"%d\">%s</font></TD></TR></TABLE>>]", style, fillColor, color, fontSize, stateName);
-    }
-    else {
-        outputFile.Printf("[style=%s, fillcolor=%s, color=%s,label=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\"><font point-size=\"%d\">%s</font></TD></TR><TR><TD><font point-size=\"%d\"> / ENTER </font></TD></TR><TR><TD><font point-size=\"%d\">%s</font></TD></TR></TABLE>>]", style, fillColor, color, fontSize, stateName, fontSize, fontSize, actionList);
-    }
-}
-
-static void GraphvizObjectStyle(File &outputFile, const char8 *const objName, const char8 *const className, const char8 * const style="filled", const char8 *const fillColor="white", const char8 * const color="black", uint32 fontSize=GRAPHVIZ_FONT_SIZE) {
-    outputFile.Printf("[shape=record, style=%s, fillcolor=%s, color=%s,label=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\"><font point-size=\"%d\">%s <BR/>(%s)</font></TD></TR></TABLE>>]", style, fillColor, color, fontSize, objName, className);
-}
-
-/**
- * @brief Lists in Graphviz format all the functions that belong to a given state in the configuration file.
- */
-static bool ListFunctionsGraph(File &outputFile, ReferenceT<GraphvizState> state) {
-    uint32 t;
-    bool ok = state.IsValid();
-    for (t=0; (t<state->Size()) && (ok); t++) {
-        ReferenceT<GraphvizThread> threadI = state->Get(t);
-        uint32 f;
-        ok = threadI.IsValid(); 
-        for (f=0; (f<threadI->Size()) && (ok); f++) {
-            ReferenceT<GraphvizFunction> function = threadI->Get(f);
-            StreamString stateName = state->GetName();
-            StreamString threadName = threadI->GetName();
-            StreamString uniqueFunctionName;
-            uniqueFunctionName.Printf("\"%s.%s.%s\"", stateName.Buffer(), threadName.Buffer(), function->GetName());
-            ok = outputFile.Printf("%s ", uniqueFunctionName.Buffer());
-            GraphvizFunctionStyle(outputFile, function->GetName(), function->GetClassName().Buffer());
-            ok &= outputFile.Printf("\n", voidAnyType);
-        }
+        ok = ConfigurationInclude::Resolve(cdb, inputFilename.Buffer(), "cdb", includedFilenames);
     }
     return ok;
 }
 
 /**
- * @brief Creates a Graphviz cluster with all the states, threads and functions with-in.
+ * @brief Appends \a name to \a line escaping the characters which are special in a make rule.
  */
-static bool CreateStateClusterGraph(File &outputFile, ReferenceT<GraphvizState> state) {
-    bool ok = outputFile.Printf("subgraph cluster_%s {\n", state->GetName());
-    if (ok) {
-        ok = outputFile.Printf("label = \"State: %s\"\n", state->GetName());
-    }
-    if (ok) {
-        ok = state.IsValid();
-    }
-    uint32 t;
-    for (t=0; (t<state->Size()) && (ok); t++) {
-        ReferenceT<GraphvizThread> threadI = state->Get(t);
-        ok = outputFile.Printf("subgraph cluster_%s_%s {\n", state->GetName(), threadI->GetName());
-        ok &= outputFile.Printf("label = \"Thread: %s\"\n", threadI->GetName());
-        ok &= outputFile.Printf("color= \"%s\"\n", "red");
-        StreamString executionList;
-        uint32 f; 
-        for (f=0; (f<threadI->Size()) && (ok); f++) {
-            ReferenceT<GraphvizFunction> function = threadI->Get(f);
-            ok = function.IsValid();
-            if (ok) {
-                StreamString stateName = state->GetName();
-                StreamString threadName = threadI->GetName();
-                StreamString uniqueFunctionName;
-                ok = uniqueFunctionName.Printf("\"%s.%s.%s\"", stateName.Buffer(), threadName.Buffer(), function->GetName());
-                if(executionList.Size() != 0) {
-                    ok &= executionList.Printf("->", voidAnyType);
-                }
-                ok &= executionList.Printf("%s", uniqueFunctionName.Buffer());
-            }
+static void AppendMakeName(StreamString &line, const char8 * const name) {
+    uint32 i;
+    for (i = 0u; name[i] != '\0'; i++) {
+        if ((name[i] == ' ') || (name[i] == '#') || (name[i] == ':')) {
+            line += '\\';
         }
-        ok &= outputFile.Printf("%s\n", executionList.Buffer());
-        ok &= outputFile.Printf("%s", "}\n");
-    }
-    if (ok) {
-        ok = outputFile.Printf("%s", "}\n");
+        else if (name[i] == '$') {
+            line += '$';
+        }
+        else {
+            //Not special
+        }
+        line += name[i];
     }
-    return ok;
 }
 
 /**
- * @brief Lists in Graphviz format all the data sources from the configuration file.
+ * @brief Writes the make rule "OUTPUTS: INPUT [STYLE] [FRAGMENTS]" into \a depFilename, so that make (or ninja) knows all the graphs produced from the input.
+ * @param[in] outputSuffix appended to each output name (e.g. .gz).
+ * @param[in] target if not empty (-MT), the target of the rule instead of the graphs (e.g. the stamp file built by make).
+ * @param[in] styleFilename the style file, or empty if none.
+ * @param[in] includedFilenames the fragments included by the input and by the style file (see ConfigurationInclude::Resolve).
  */
-static bool ListDataSourcesGraph(File &outputFile, ReferenceT<ReferenceContainer> dataSourceList) {
-    //Create the dataSource clusters
-    bool ok = true;
-    uint32 s;
-    for (s=0; (s<dataSourceList->Size()) && (ok); s++) {
-        ReferenceT<GraphvizDataSource> dataSource = dataSourceList->Get(s);
-        ok = dataSource.IsValid();
-        ok &= outputFile.Printf("\"%s\" ", dataSource->GetName());
-        GraphvizDataSourceStyle(outputFile, dataSource->GetName(), dataSource->GetClassName().Buffer());
-        ok &= outputFile.Printf("\n", voidAnyType);
+static bool WriteDependencyFile(const StreamString &depFilename, const GraphNameList &outputs, const char8 * const outputSuffix, const StreamString &target, const StreamString &inputFilename, const StreamString &styleFilename, const StreamString &includedFilenames) {
+    StreamString rule;
+    if (target.Size() > 0u) {
+        AppendMakeName(rule, target.Buffer());
     }
-    return ok;
-}
-
-/**
- * @brief Exports all the states, threads with-in states and functions in a graph file named %sRTApp.gv (outputFilenamePrefix.Buffer())
- */
-static bool ExportRTAppGraph(StreamString outputFilenamePrefix, ReferenceT<ReferenceContainer> stateList, ReferenceT<ReferenceContainer> functionList, ReferenceT<ReferenceContainer> dataSourceList) {
-    StreamString outputFilename;
-    outputFilename.Printf("%sRTApp.gv", outputFilenamePrefix.Buffer());
-    //Delete any existent output file
-    Directory d(outputFilename.Buffer());
+    uint32 i;
+    for (i = 0u; (i < outputs.GetNumberOfGraphs()) && (target.Size() == 0u); i++) {
+        if (i > 0u) {
+            (void) rule.Printf("%s", " \\\n ");
+        }
+        AppendMakeName(rule, outputs.GetName(i));
+        AppendMakeName(rule, outputSuffix);
+    }
+    (void) rule.Printf("%s", ": ");
+    AppendMakeName(rule, inputFilename.Buffer());
+    if (styleFilename.Size() > 0u) {
+        (void) rule.Printf("%s", " ");
+        AppendMakeName(rule, styleFilename.Buffer());
+    }
+    const char8 *includedFilename = includedFilenames.Buffer();
+    const char8 *includedFilenamesEnd = &includedFilename[includedFilenames.Size()];
+    while (includedFilename < includedFilenamesEnd) {
+        (void) rule.Printf("%s", " \\\n ");
+        AppendMakeName(rule, includedFilename);
+        includedFilename = &includedFilename[StringHelper::Length(includedFilename) + 1u];
+    }
+    (void) rule.Printf("%s", "\n");
+    File depFile;
+    Directory d(depFilename.Buffer());
     d.Delete();
-    File outputFile;
-    bool ok = outputFile.Open(outputFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+    bool ok = depFile.Open(depFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
     if (ok) {
-        outputFile.Seek(0);
+        uint32 writeSize = static_cast<uint32>(rule.Size());
+        ok = depFile.Write(rule.Buffer(), writeSize);
     }
     else {
-        REPORT_ERROR_STATIC(ErrorManagement::FatalError,"Failed to open file %s\n", outputFilename.Buffer());
-    }
-
-    if (ok) {
-        outputFile.Printf("%s", "digraph G {\n");
-        outputFile.Printf("%s", "rankdir=LR\n");
-        outputFile.Printf("%s", "concentrate=true\n");
-    }
-   
-    //List all the functions
-    uint32 s; 
-    for (s=0; (s<stateList->Size()) && (ok); s++) {
-        ReferenceT<GraphvizState> state = stateList->Get(s);
-        ok = ListFunctionsGraph(outputFile, state); 
-    }
-    //Create the state/thread clusters
-    for (s=0; (s<stateList->Size()) && (ok); s++) {
-        ReferenceT<GraphvizState> state = stateList->Get(s);
-        ok = CreateStateClusterGraph(outputFile, state);
-    }
-    if (ok) {
-        ok = outputFile.Printf("subgraph cluster_DataSources {\n", voidAnyType);
-        ok &= outputFile.Printf("label = \"Data Sources\"\n", voidAnyType);
-        ok &= ListDataSourcesGraph(outputFile, dataSourceList);
-        ok &= outputFile.Printf("%s", "}\n");
-    }
-    if (ok) {
-        outputFile.Printf("%s", "}\n");
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", depFilename.Buffer());
     }
-    outputFile.Flush();
-    outputFile.Close();
-    return ok;
-}
-
-/**
- * @brief For a given state, connects the functions of this state to the respective data sources.
- */
-static bool ConnectFunctionsToDataSources (File &outputFile, ReferenceT<GraphvizState> state, ReferenceT<ReferenceContainer> connectedDataSources) {
-    bool ok = true;
-    uint32 t; 
-    for (t=0; (t<state->Size()) && (ok); t++) {
-        ReferenceT<GraphvizThread> threadI = state->Get(t);
-        ok = threadI.IsValid();
-        uint32 f;
-        for (f=0; (f<threadI->Size()) && (ok); f++) {
-            ReferenceT<GraphvizFunction> function = threadI->Get(f);
-            StreamString stateName = state->GetName();
-            StreamString threadName = threadI->GetName();
-            StreamString uniqueFunctionName;
-            uniqueFunctionName.Printf("\"%s.%s.%s\"", stateName.Buffer(), threadName.Buffer(), function->GetName());
-            ReferenceT<ReferenceContainer> inputs = function->GetInputDataSources();
-            ReferenceT<ReferenceContainer> outputs = function->GetOutputDataSources();
-            uint32 i;
-            for (i=0; i<inputs->Size(); i++) {
-                outputFile.Printf("\"%s\"->%s\n", inputs->Get(i)->GetName(), uniqueFunctionName.Buffer());
-                connectedDataSources->Insert(inputs->Get(i));
-            }
-            for (i=0; i<outputs->Size(); i++) {
-                outputFile.Printf("%s->\"%s\"\n", uniqueFunctionName.Buffer(), outputs->Get(i)->GetName());
-                connectedDataSources->Insert(outputs->Get(i));
-            }
+    if (depFile.IsOpen()) {
+        if (!depFile.Close()) {
+            ok = false;
         }
     }
     return ok;
 }
 
 /**
- * @brief Creates one file for each state, named %sState%s.gv (outputFilenamePrefix.Buffer(), state->GetName()) and adds the connections between the functions belonging to these states and the data sources.
+ * @brief Handles the ToolServer requests. The supported Commands are:
+ *  - DotExport: exports the configuration file Input into files prefixed with OutputPrefix. The optional MaxDepth, Collapse and Group leaves have the same meaning of the -maxdepth, -collapse and -group arguments;
+ *  - Analysis: returns the states, threads, functions and data sources of each RealTimeApplication of the configuration file Input,
+ *    the data sources used (and never used) by each state and the data sources shared by several states.
+ * If Input is not set the configuration is read from the request body. The configuration is always in cdb syntax.
  */
-static bool ExportRTStatesGraph(StreamString outputFilenamePrefix, ReferenceT<ReferenceContainer> stateList, ReferenceT<ReferenceContainer> functionList, ReferenceT<ReferenceContainer> dataSourceList) {
-    bool ok = true; 
-    //For each state
-    uint32 s; 
-    for (s=0; (s<stateList->Size()) && (ok); s++) {
-        ReferenceT<GraphvizState> state = stateList->Get(s);
-        ok = state.IsValid();
-        StreamString outputFilename;
-        outputFilename.Printf("%sState%s.gv", outputFilenamePrefix.Buffer(), state->GetName());
-        //Delete any existent output file
-        Directory d(outputFilename.Buffer());
-        d.Delete();
-        File outputFile;
-        if (ok) {
-            ok = outputFile.Open(outputFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+static bool HandleRequest(ConfigurationDatabase &request, StreamString &body, ConfigurationCache &cache, StreamString &response) {
+    StreamString command;
+    StreamString inputFilename;
+    bool ok = request.Read("Command", command);
+    ConfigurationDatabase cdb;
+    if (ok) {
+        StreamString parserError;
+        const bool hasInputFile = request.Read("Input", inputFilename);
+        if (!hasInputFile) {
+            inputFilename = "-";
         }
-        if (ok) {
-            outputFile.Seek(0);
+        Diagnostics::SetContext(inputFilename.Buffer());
+        if (hasInputFile) {
+            ok = cache.GetFile(inputFilename.Buffer(), "cdb", cdb, parserError);
         }
         else {
-            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to open file %s\n", outputFilename.Buffer());
+            ok = cache.GetContent(body, "cdb", cdb, parserError);
         }
-
-        if (ok) {
-            outputFile.Printf("%s", "digraph G {\n");
-            outputFile.Printf("%s", "rankdir=LR\n");
-            outputFile.Printf("%s", "concentrate=true\n");
+        if (!ok) {
+            (void) response.Printf("Failed to parse %s", parserError.Buffer());
         }
-        if (ok) {
-            ok = ListFunctionsGraph(outputFile, state); 
+        else if (!ConfigurationInclude::Resolve(cdb, inputFilename.Buffer(), "cdb")) {
+            (void) response.Printf("Failed to compose %s", inputFilename.Buffer());
+            ok = false;
         }
-        if (ok) {
-            ok = CreateStateClusterGraph(outputFile, state);
+        else {
+            //Composed
         }
-        ReferenceT<ReferenceContainer> connectedDataSources = Reference(new ReferenceContainer()); 
-        if (ok) {
-            ok = ConnectFunctionsToDataSources(outputFile, state, connectedDataSources);
+    }
+    if (ok) {
+        if (command == "DotExport") {
+            StreamString outputFilenamePrefix;
+            ObjectsLevelOfDetail objectsLevelOfDetail;
+            ok = request.Read("OutputPrefix", outputFilenamePrefix);
+            if (!request.Read("MaxDepth", objectsLevelOfDetail.maxDepth)) {
+                objectsLevelOfDetail.maxDepth = 0u;
+            }
+            if (!request.Read("Collapse", objectsLevelOfDetail.collapseThreshold)) {
+                objectsLevelOfDetail.collapseThreshold = 0u;
+            }
+            if (!request.Read("Group", objectsLevelOfDetail.groupThreshold)) {
+                objectsLevelOfDetail.groupThreshold = 0u;
+            }
+            if ((ok) && (objectsLevelOfDetail.groupThreshold == 1u)) {
+                //A single object is never grouped
+                (void) response.Printf("%s", "Group shall be 0 or at least 2");
+                ok = false;
+            }
+            ApplicationModelFormat modelFormat = ApplicationModelNone;
+            StreamString modelFormatName;
+            if ((ok) && (request.Read("Model", modelFormatName))) {
+                ok = ParseModelFormat(modelFormatName, modelFormat);
+                if (!ok) {
+                    (void) response.Printf("Invalid Model %s", modelFormatName.Buffer());
+                }
+            }
+            else if (!ok) {
+                (void) response.Printf("%s", "OutputPrefix shall be specified");
+            }
+            else {
+                //No model
+            }
+            uint32 explorer;
+            if (!request.Read("Explorer", explorer)) {
+                explorer = 0u;
+            }
+            if (ok) {
+                GraphFileOutput output;
+                ok = ConfigurationGraphs::Export(cdb, outputFilenamePrefix, objectsLevelOfDetail, output, modelFormat, (explorer != 0u));
+                if (!ok) {
+                    (void) response.Printf("Failed to export %s", outputFilenamePrefix.Buffer());
+                }
+            }
         }
-        if (ok) {
-            ok = ListDataSourcesGraph(outputFile, connectedDataSources);
+        else if (command == "Analysis") {
+            ok = ConfigurationGraphs::Analyse(cdb, response);
+        }
+        else {
+            (void) response.Printf("Unknown command %s", command.Buffer());
+            ok = false;
         }
-
-        outputFile.Printf("%s", "}\n");
-        outputFile.Flush();
-        outputFile.Close();
     }
+    Diagnostics::SetContext(NULL_PTR(const char8 *));
     return ok;
 }
 
 /**
- * @brief Exports a MARTe2 state machine in a graph file named %sStateMachine.gv (outputFilenamePrefix.Buffer())
+ * Time (in ms) without changes to the watched file before it is exported again.
  */
-bool ExportStateMachine(StreamString outputFilenamePrefix, ConfigurationDatabase &cdb) {
-    //Look for a StateMachine
-    uint32 i;
-    bool found = false;
-    bool ok = cdb.MoveToRoot();
-    uint32 numberOfNodesAfterRoot = cdb.GetNumberOfChildren(); 
-    for (i=0; (i<numberOfNodesAfterRoot) && (ok) && (!found); i++) {
-        ok = cdb.MoveToChild(i);
-        StreamString className;
-        if (ok) {
-            ok = cdb.Read("Class", className);
-        }
-        if (ok) {
-            found = (className == "StateMachine");
-            if (!found) {
-                ok = cdb.MoveToAncestor(1);
-            }
-        }
-    }
-    bool stateMachineExists = found;
-    if (stateMachineExists) {
-        if (ok) {
-            ok = found;
-            if (!ok) {
-                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not find the StateMachine\n");
-            }
-        }
-        ReferenceT<StateMachine> stateMachine;
-        if (ok) {
-            stateMachine = Reference(new StateMachine());
-            ok = stateMachine->Initialise(cdb);
-            if (!ok) {
-                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to initialise the StateMachine\n");
-            }
-        }
+#define WATCH_DEBOUNCE_PERIOD_MS 150
 
-        StreamString outputFilename;
-        if (ok) {
-            outputFilename.Printf("%sStateMachine.gv", outputFilenamePrefix.Buffer());
-            //Delete any existent output file
-            Directory d(outputFilename.Buffer());
-            d.Delete();
-        }
-        File outputFile;
+/**
+ * @brief The files of a watched configuration (the input file and its fragments), each identified by the inotify watch of its
+ * directory and by its name in that directory.
+ */
+class WatchedFileList {
+public:
+    WatchedFileList() {
+        numberOfFiles = 0u;
+        capacity = 4u;
+        descriptors = new int32[capacity];
+        names = new StreamString[capacity];
+    }
+
+    ~WatchedFileList() {
+        delete [] descriptors;
+        delete [] names;
+    }
+
+    /**
+     * @brief Watches the directory of \a filename with \a watchFd (the directories are watched, so that editors which save by renaming
+     * a temporary file are also detected) and adds \a filename to the list.
+     * @return false if the directory cannot be watched.
+     */
+    bool Add(const int32 watchFd, const char8 * const filename) {
+        StreamString directoryName = ".";
+        const char8 *name = filename;
+        const char8 *separator = StringHelper::SearchLastChar(filename, '/');
+        if (separator != NULL_PTR(const char8 *)) {
+            directoryName = "";
+            uint32 directoryNameSize = static_cast<uint32>(separator - filename) + 1u;
+            (void) directoryName.Write(filename, directoryNameSize);
+            name = &separator[1];
+        }
+        //Watching an already watched directory returns the same descriptor
+        int32 wd = inotify_add_watch(watchFd, directoryName.Buffer(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+        bool ok = (wd >= 0);
         if (ok) {
-            ok = outputFile.Open(outputFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
-            if (!ok) {
-                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to open file %s\n", outputFilename.Buffer());
+            if (numberOfFiles == capacity) {
+                int32 *newDescriptors = new int32[capacity * 2u];
+                StreamString *newNames = new StreamString[capacity * 2u];
+                uint32 i;
+                for (i = 0u; i < numberOfFiles; i++) {
+                    newDescriptors[i] = descriptors[i];
+                    newNames[i] = names[i];
+                }
+                delete [] descriptors;
+                delete [] names;
+                descriptors = newDescriptors;
+                names = newNames;
+                capacity *= 2u;
             }
+            descriptors[numberOfFiles] = wd;
+            names[numberOfFiles] = name;
+            numberOfFiles++;
         }
-        if (ok) {
-            outputFile.Seek(0);
-        }
-        if (ok) {
-            outputFile.Printf("%s", "digraph G {\n");
-            outputFile.Printf("%s", "rankdir=TD\n");
-            outputFile.Printf("%d", "nodesep=2.5\n");
-        }
-        uint32 numberOfStates = 0;
-        uint32 s;
-        //List all the states
-        if (ok) {
-            numberOfStates = stateMachine->Size();
-            for (s=0; (s<numberOfStates) && (ok); s++) {
-                ReferenceT<ReferenceContainer> state = stateMachine->Get(s);
-                ok = state.IsValid();
-                if (ok) {
-                    //Check if the event has an ENTER action list
-                    StreamString actionList;
-                    uint32 numberOfEvents = state->Size();
-                    uint32 numberOfEnterActions = 0u;
-                    uint i;
-                    for (i=0; (i<numberOfEvents) && (ok); i++) {
-                        ReferenceT<ReferenceContainer> event = state->Get(i);
-                        if (event.IsValid()) {
-                            StreamString evtName = event->GetName();    
-                            if (evtName == "ENTER") {
-                                numberOfEnterActions = event->Size();
-                                uint32 a;
-                                for (a=0; a<numberOfEnterActions; a++) {
-                                    ok &= actionList.Printf("%d. %s <BR/>", (a + 1), event->Get(a)->GetName());
-                                }
-                            }
-                        }
-                    }
-                    ok = outputFile.Printf("\"%s\" ", state->GetName());
-                    GraphvizStateMachineStyle(outputFile, state->GetName(), numberOfEnterActions, actionList.Buffer());
-                    ok &= outputFile.Printf("\n", voidAnyType);
-                } 
-            }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to watch %s\n", directoryName.Buffer());
         }
-        //Connect the states
-        if (ok) {
-            for (s=0; (s<numberOfStates) && (ok); s++) {
-                ReferenceT<ReferenceContainer> state = stateMachine->Get(s);
-                ok = state.IsValid();
-                if (ok) {
-                    uint32 numberOfEvents = state->Size();
-                    uint i;
-                    for (i=0; (i<numberOfEvents) && (ok); i++) {
-                        ReferenceT<StateMachineEvent> event = state->Get(i);
-                        if (event.IsValid()) {
-                            //Get the destination
-                            StreamString nextState = event->GetNextState();
-                            StreamString nextStateError = event->GetNextStateError();
-                            uint32 numberOfActions = event->Size();
-                            if (numberOfActions > 0) {
-                                ok = outputFile.Printf("\"%s\"->\"%s\" [label= <<TABLE border=\"0\" cellborder=\"0\"><TR><TD ROWSPAN=\"%d\"><font point-size=\"%d\">%s</font></TD>", state->GetName(), nextState.Buffer(), numberOfActions, GRAPHVIZ_FONT_SIZE, event->GetName());
-                                ok = outputFile.Printf("<TD ALIGN=\"CENTER\" ROWSPAN=\"%d\"><font point-size=\"%d\"> / </font></TD>", numberOfActions, GRAPHVIZ_FONT_SIZE);
-                                ok = outputFile.Printf("<TD ALIGN=\"LEFT\"><font point-size=\"%d\">1. %s </font></TD></TR>", GRAPHVIZ_FONT_SIZE, event->Get(0)->GetName());
-                                uint32 a;
-                                for (a=1; a<numberOfActions; a++) {
-                                    ok &= outputFile.Printf("<TR><TD ALIGN=\"LEFT\"><font point-size=\"%d\">%d. %s </font></TD></TR>", GRAPHVIZ_FONT_SIZE, (a + 1), event->Get(a)->GetName());
-                                }
-                            }
-                            else {
-                                ok = outputFile.Printf("\"%s\"->\"%s\" [label= <<TABLE border=\"0\" cellborder=\"0\"><TR><TD><font point-size=\"%d\">%s</font></TD></TR>", state->GetName(), nextState.Buffer(), GRAPHVIZ_FONT_SIZE, event->GetName());
-                            }
-                            ok = outputFile.Printf("</TABLE>>]\n", voidAnyType);
-                        }
-                    }
-                }
-            }
+        return ok;
+    }
+
+    /**
+     * @brief Empties the list. The directories stay watched.
+     */
+    void Clear() {
+        numberOfFiles = 0u;
+    }
+
+    /**
+     * @brief Returns true if the file \a name of the directory watched by \a wd is in the list.
+     */
+    bool Contains(const int32 wd, const char8 * const name) const {
+        bool found = false;
+        uint32 i;
+        for (i = 0u; (i < numberOfFiles) && (!found); i++) {
+            found = (descriptors[i] == wd) && (names[i] == name);
         }
-        outputFile.Printf("%s", "}\n");
-        outputFile.Flush();
-        outputFile.Close();
-    } 
-    else {
-        REPORT_ERROR_STATIC(ErrorManagement::Warning, "No state machine defined");
+        return found;
     }
 
+private:
+    int32 *descriptors;
+    StreamString *names;
+    uint32 numberOfFiles;
+    uint32 capacity;
+};
+
+/**
+ * @brief Parses \a inputFilename and exports the graphs that changed. If the file cannot be parsed the previous configuration is kept.
+ * @details The files in \a watched are replaced by the input file and by all the fragments that it includes.
+ */
+static bool UpdateWatchedConfiguration(IncrementalGraphExport &watched, StreamString inputFilename, const int32 watchFd, WatchedFileList &watchedFiles) {
+    Diagnostics::SetContext(inputFilename.Buffer());
+    ConfigurationDatabase cdb;
+    StreamString includedFilenames;
+    bool ok = ParseConfigurationFile(inputFilename, cdb, &includedFilenames);
+    //The fragments read are watched even if the configuration is not valid, so that fixing a fragment exports it again
+    watchedFiles.Clear();
+    (void) watchedFiles.Add(watchFd, inputFilename.Buffer());
+    const char8 *includedFilename = includedFilenames.Buffer();
+    const char8 *includedFilenamesEnd = &includedFilename[includedFilenames.Size()];
+    while (includedFilename < includedFilenamesEnd) {
+        (void) watchedFiles.Add(watchFd, includedFilename);
+        includedFilename = &includedFilename[StringHelper::Length(includedFilename) + 1u];
+    }
+    if (ok) {
+        ok = watched.Update(cdb);
+    }
+    Diagnostics::SetContext(NULL_PTR(const char8 *));
     return ok;
 }
 
 /**
- * @brief Exports all the configuraion file objects in a filed named %sObjects.gv (outputFilenamePrefix.Buffer())
+ * @brief Exports \a inputFilename and then exports it again (only the graphs that changed) every time that the file, or any of the
+ * fragments that it includes, is written.
+ * @details The directories of the files are watched (so that editors which save by renaming a temporary file are also detected) and
+ * the changes are debounced by WATCH_DEBOUNCE_PERIOD_MS. Never returns unless the file cannot be watched.
+ * @param[in] compress see GraphFileOutput.
+ * @param[in] modelFormat see ConfigurationGraphs::Export.
+ * @param[in] explorer see ConfigurationGraphs::Export.
  */
-bool ExportObjects(File &outputFile, ConfigurationDatabase &cdb, StreamString uniqueName = "") {
-    bool ok = true;
-    //Number of children
-    uint32 numberOfChildren = cdb.GetNumberOfChildren();
-    uint32 i;
-    bool isLeaf = true;
-    StreamString className;
-    if (!cdb.Read("Class", className)) {
-        className = "";
-    }
-    StreamString objName = cdb.GetName();
-    if (objName[0] == '+') {
-        objName = &(objName.Buffer())[1];
-    }
-    else if (objName[0] == '$') {
-        objName = &(objName.Buffer())[1];
-    }
-    bool clusterCreated = false;
-    uniqueName.Printf("%s", objName.Buffer());
-    //Replace - and : with _
-    (void)uniqueName.Seek(0LLU);
-    StreamString newUniqueName;
-    StreamString token;
-    char8 term;
-    while(uniqueName.GetToken(token, ":-", term)) {
-        if (newUniqueName.Size() > 0) {
-            newUniqueName += "_";
-        }
-        newUniqueName += token.Buffer();
-        token = "";
-    }
-    uniqueName = newUniqueName;
-    for(i=0; i<numberOfChildren; i++) {
-        if (cdb.MoveRelative(cdb.GetChildName(i))) {
-            StreamString childClassName;
-            if (!cdb.Read("Class", childClassName)) {
-                childClassName = "";
-            }
-            if (childClassName.Size() > 0) {
-                isLeaf = false;
-                if (!clusterCreated) {
-                    if(objName.Size() > 0) {
-                        outputFile.Printf("subgraph cluster_%s {\nlabel=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\"><font point-size=\"%d\">%s <BR/>(%s)</font></TD></TR></TABLE>>\n", uniqueName.Buffer(), GRAPHVIZ_FONT_SIZE, objName.Buffer(), className.Buffer());
-                        clusterCreated = true;
-                    }
+static bool WatchConfiguration(StreamString inputFilename, StreamString outputFilenamePrefix, const ObjectsLevelOfDetail &objectsLevelOfDetail, const bool compress, const ApplicationModelFormat modelFormat, const bool explorer) {
+    int32 watchFd = inotify_init1(IN_CLOEXEC);
+    bool ok = (watchFd >= 0);
+    WatchedFileList watchedFiles;
+    if (ok) {
+        ok = watchedFiles.Add(watchFd, inputFilename.Buffer());
+    }
+    GraphFileOutput output(compress);
+    IncrementalGraphExport watched(outputFilenamePrefix, objectsLevelOfDetail, output, modelFormat, explorer);
+    if (ok) {
+        (void) UpdateWatchedConfiguration(watched, inputFilename, watchFd, watchedFiles);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Watching %s\n", inputFilename.Buffer());
+    }
+    const uint32 bufferSize = 4096u;
+    char8 *buffer = new char8[bufferSize];
+    bool pending = false;
+    while (ok) {
+        struct pollfd pfd;
+        pfd.fd = watchFd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        //Wait forever for the first event and then until there are no more events for the debounce period
+        int32 ret = poll(&pfd, 1, pending ? WATCH_DEBOUNCE_PERIOD_MS : -1);
+        if (ret > 0) {
+            ssize_t readSize = read(watchFd, buffer, bufferSize);
+            ssize_t idx = 0;
+            while (idx < readSize) {
+                struct inotify_event *event = reinterpret_cast<struct inotify_event *>(&buffer[idx]);
+                if (event->len > 0u) {
+                    pending = pending || (watchedFiles.Contains(event->wd, event->name));
                 }
+                idx += static_cast<ssize_t>(sizeof(struct inotify_event) + event->len);
             }
-            ExportObjects(outputFile, cdb, uniqueName.Buffer());
-            cdb.MoveToAncestor(1);
         }
-    }
-    if (clusterCreated) {
-        outputFile.Printf("}\n", voidAnyType);
-    }
-    if (isLeaf) {
-        if (className.Size() > 0) {
-            ok = outputFile.Printf("%s ", uniqueName.Buffer(), objName.Buffer());
-            GraphvizObjectStyle(outputFile, objName.Buffer(), className.Buffer()); 
-            ok &= outputFile.Printf("\n", voidAnyType);
+        else if ((ret == 0) && (pending)) {
+            pending = false;
+            uint64 start = HighResolutionTimer::Counter();
+            if (UpdateWatchedConfiguration(watched, inputFilename, watchFd, watchedFiles)) {
+                float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period() * 1e3;
+                REPORT_ERROR_STATIC(ErrorManagement::Information, "Exported %s in %f ms\n", inputFilename.Buffer(), elapsed);
+            }
         }
+        else if ((ret < 0) && (errno != EINTR)) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to wait for changes in %s\n", inputFilename.Buffer());
+            ok = false;
+        }
+        else {
+            //Interrupted
+        }
+    }
+    delete [] buffer;
+    if (watchFd >= 0) {
+        close(watchFd);
     }
     return ok;
 }
@@ -911,86 +497,157 @@ bool ExportObjects(File &outputFile, ConfigurationDatabase &cdb, StreamString un
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 int main(int argc, char **argv) {
-    SetErrorProcessFunction(&MainErrorProcessFunction);
-    if (argc != 5) {
-        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are -i INPUT_FILE -o OUTPUT_FILE_PREFIX\n");
+    Diagnostics::Install();
+    const char8 *args = "-i INPUT_FILE -o OUTPUT_FILE_PREFIX [-maxdepth N] [-collapse N] [-group N] [-style STYLE_FILE] [-compress gzip] [-model json|graphml] [--html] [-MD] [-MF DEPFILE] [-MT TARGET] [--list-outputs] [--watch] (or -server SOCKET_PATH [-style STYLE_FILE])";
+    StreamString socketPath;
+    bool serverMode = ((argc > 1) && (StreamString("-server") == argv[1]));
+    bool watchMode = HasFlagArgument(argc, argv, "--watch");
+    bool listOutputs = HasFlagArgument(argc, argv, "--list-outputs");
+    bool writeDepFile = HasFlagArgument(argc, argv, "-MD");
+    bool explorer = HasFlagArgument(argc, argv, "--html");
+    //The --watch, --list-outputs, --html and -MD flags have no value
+    int32 numberOfValueArguments = argc;
+    if (watchMode) {
+        numberOfValueArguments--;
+    }
+    if (listOutputs) {
+        numberOfValueArguments--;
+        //The standard output carries the list of outputs
+        Diagnostics::SetOutput(STDERR_FILENO);
+    }
+    if (writeDepFile) {
+        numberOfValueArguments--;
+    }
+    if (explorer) {
+        numberOfValueArguments--;
+    }
+    if (serverMode) {
+        if (((argc != 3) && (argc != 5)) || (!ParseArgument(argc, argv, "-server", socketPath))) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
+            return -1;
+        }
+    }
+    else if ((numberOfValueArguments < 5) || ((numberOfValueArguments % 2) != 1)) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
         return -1;
     }
-    StreamString argv1 = argv[1];
-    StreamString argv3 = argv[3];
     StreamString inputFilename;
     StreamString outputFilenamePrefix;
-
-    if (argv1 == "-i") {
-        inputFilename = argv[2];
-    }
-    else if (argv3 == "-i") {
-        inputFilename = argv[4];
-    }
-    else {
-        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are -i INPUT_FILE -o OUTPUT_FILE_PREFIX\n");
-        return -1;
+    ObjectsLevelOfDetail objectsLevelOfDetail;
+    objectsLevelOfDetail.maxDepth = 0u;
+    objectsLevelOfDetail.collapseThreshold = 0u;
+    objectsLevelOfDetail.groupThreshold = 0u;
+    bool argsOk = true;
+    if (!serverMode) {
+        argsOk = ParseArgument(argc, argv, "-i", inputFilename);
+        if (argsOk) {
+            argsOk = ParseArgument(argc, argv, "-o", outputFilenamePrefix);
+        }
+        if (argsOk) {
+            argsOk = ParseUInt32Argument(argc, argv, "-maxdepth", objectsLevelOfDetail.maxDepth);
+        }
+        if (argsOk) {
+            argsOk = ParseUInt32Argument(argc, argv, "-collapse", objectsLevelOfDetail.collapseThreshold);
+        }
+        if (argsOk) {
+            argsOk = ParseUInt32Argument(argc, argv, "-group", objectsLevelOfDetail.groupThreshold);
+        }
+        if ((argsOk) && (objectsLevelOfDetail.groupThreshold == 1u)) {
+            //A single object is never grouped
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "-group shall be 0 or at least 2\n");
+            argsOk = false;
+        }
     }
-
-    if (argv1 == "-o") {
-        outputFilenamePrefix = argv[2];
+    StreamString depFilename;
+    if (ParseArgument(argc, argv, "-MF", depFilename, false)) {
+        writeDepFile = true;
     }
-    else if (argv3 == "-o") {
-        outputFilenamePrefix = argv[4];
+    else if (writeDepFile) {
+        //As gcc -MD, the dependency file is named after the output
+        depFilename.Printf("%s.d", outputFilenamePrefix.Buffer());
     }
     else {
-        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are -i INPUT_FILE -o OUTPUT_FILE_PREFIX\n");
+        //No dependency file
+    }
+    StreamString depTarget;
+    if ((ParseArgument(argc, argv, "-MT", depTarget, false)) && (!writeDepFile)) {
+        //As gcc, -MT only names the target of the rule
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "-MT requires -MD or -MF\n");
+        argsOk = false;
+    }
+    StreamString compression;
+    if ((argsOk) && (ParseArgument(argc, argv, "-compress", compression, false))) {
+        argsOk = (compression == "gzip");
+    }
+    bool compress = (compression.Size() > 0u);
+    StreamString modelFormatName;
+    ApplicationModelFormat modelFormat = ApplicationModelNone;
+    if ((argsOk) && (ParseArgument(argc, argv, "-model", modelFormatName, false))) {
+        argsOk = ParseModelFormat(modelFormatName, modelFormat);
+    }
+    if ((argsOk) && (explorer)) {
+        //The browsers cannot load compressed fragments from local files
+        argsOk = !compress;
+    }
+    if ((argsOk) && ((writeDepFile) || (listOutputs))) {
+        //The watch mode only exports the graphs that changed
+        argsOk = ((!serverMode) && (!watchMode));
+    }
+    if (!argsOk) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
         return -1;
     }
-    ReferenceT<ReferenceContainer> stateList = Reference(new ReferenceContainer()); 
-    ReferenceT<ReferenceContainer> functionList = Reference(new ReferenceContainer()); 
-    ReferenceT<ReferenceContainer> dataSourceList = Reference(new ReferenceContainer()); 
-    ConfigurationDatabase cdb; 
-    bool ok = ParseConfigurationFile(inputFilename, stateList, functionList, dataSourceList, cdb);
-    if (ok) {
-        ok = ExportRTAppGraph(outputFilenamePrefix, stateList, functionList, dataSourceList);
+    //Must live until the end of the program, as the styles point at its strings
+    ConfigurationDatabase styleCdb;
+    StreamString styleFilename;
+    StreamString styleIncludedFilenames;
+    if (ParseArgument(argc, argv, "-style", styleFilename, false)) {
+        Diagnostics::SetContext(styleFilename.Buffer());
+        argsOk = ParseConfigurationFile(styleFilename, styleCdb, &styleIncludedFilenames);
+        if (argsOk) {
+            argsOk = ConfigurationGraphs::LoadStyles(styleCdb);
+        }
+        Diagnostics::SetContext(NULL_PTR(const char8 *));
+        if (!argsOk) {
+            return -1;
+        }
     }
-    if (ok) {
-        ok = ExportRTStatesGraph(outputFilenamePrefix, stateList, functionList, dataSourceList);
+    bool ok = true;
+    if (serverMode) {
+        ToolServer server(&HandleRequest);
+        ok = server.Start(socketPath.Buffer());
     }
-    if (ok) {
-        ok = ExportStateMachine(outputFilenamePrefix, cdb);
+    else if (watchMode) {
+        ok = WatchConfiguration(inputFilename, outputFilenamePrefix, objectsLevelOfDetail, compress, modelFormat, explorer);
     }
-    if (ok) {
-        cdb.MoveToRoot();
-        uint32 numberOfNodesAfterRoot = cdb.GetNumberOfChildren();
-        //Generate one Objects file for each sub-root node, otherwise it is a mess!
-        uint32 i;
-        for (i=0; i<numberOfNodesAfterRoot; i++) {
-            cdb.MoveToRoot();
-            cdb.MoveToChild(i);
-            StreamString outputFilename;
-            if (ok) {
-                outputFilename.Printf("%sObjects_%d.gv", outputFilenamePrefix.Buffer(), i);
-                //Delete any existent output file
-                Directory d(outputFilename.Buffer());
-                d.Delete();
-            }
-            File outputFile;
-            if (ok) {
-                ok = outputFile.Open(outputFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
-            }
-            if (ok) {
-                outputFile.Seek(0);
-            }
-            else {
-                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to open file %s\n", outputFilename.Buffer());
-            }
-            if (ok) {
-                outputFile.Printf("%s", "digraph G {\n");
-                outputFile.Printf("%s", "bgcolor=white\n");
+    else {
+        Diagnostics::SetContext(inputFilename.Buffer());
+        ConfigurationDatabase cdb; 
+        StreamString includedFilenames;
+        ok = ParseConfigurationFile(inputFilename, cdb, &includedFilenames);
+        GraphFileOutput files(compress);
+        const char8 *outputSuffix = compress ? ".gz" : "";
+        //The names are listed without printing the graphs
+        GraphNameList output;
+        if ((ok) && ((listOutputs) || (writeDepFile))) {
+            ok = ConfigurationGraphs::ListOutputs(cdb, outputFilenamePrefix, output, modelFormat, explorer);
+        }
+        //With --list-outputs the graphs are only named, not written
+        if ((ok) && (!listOutputs)) {
+            ok = ConfigurationGraphs::Export(cdb, outputFilenamePrefix, objectsLevelOfDetail, files, modelFormat, explorer);
+        }
+        if ((ok) && (listOutputs)) {
+            uint32 i;
+            for (i = 0u; i < output.GetNumberOfGraphs(); i++) {
+                printf("%s%s\n", output.GetName(i), outputSuffix);
             }
-            ok = ExportObjects(outputFile, cdb);
-            outputFile.Printf("%s", "}\n");
-            outputFile.Flush();
-            outputFile.Close();
         }
+        if ((ok) && (writeDepFile)) {
+            uint32 writeSize = static_cast<uint32>(styleIncludedFilenames.Size());
+            (void) includedFilenames.Write(styleIncludedFilenames.Buffer(), writeSize);
+            ok = WriteDependencyFile(depFilename, output, outputSuffix, depTarget, inputFilename, styleFilename, includedFilenames);
+        }
+        Diagnostics::SetContext(NULL_PTR(const char8 *));
     }
-    return 0;
+    return ok ? 0 : -1;
 }
-
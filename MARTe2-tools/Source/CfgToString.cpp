@@ -28,26 +28,29 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include <stdio.h>
 #include "AdvancedErrorManagement.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationConverter.h"
 #include "ConfigurationDatabase.h"
+#include "ConfigurationInclude.h"
+#include "ConfigurationStream.h"
+#include "Diagnostics.h"
 #include "Directory.h"
 #include "File.h"
-#include "JsonParser.h"
 #include "JsonPrinter.h"
 #include "ObjectRegistryDatabase.h"
 #include "Reference.h"
 #include "ReferenceT.h"
 #include "StreamString.h"
-#include "StandardParser.h"
 #include "StandardPrinter.h"
 #include "StreamStructuredData.h"
 #include "StreamStructuredDataI.h"
-#include "XMLParser.h"
 #include "XMLPrinter.h"
 
 /*---------------------------------------------------------------------------*/
@@ -55,14 +58,6 @@
 /*---------------------------------------------------------------------------*/
 using namespace MARTe;
 
-void MainErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo, const char * const errorDescription) {
-    MARTe::StreamString errorCodeStr;
-    MARTe::ErrorManagement::ErrorCodeToStream(errorInfo.header.errorType, errorCodeStr);
-    MARTe::StreamString err;
-    err.Printf("[%s - %s:%d]: %s", errorCodeStr.Buffer(), errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
-    printf("%s\n", err.Buffer());
-}
-
 static bool ParseArgument(uint32 nargs, char8 **args, StreamString flag, StreamString &arg) {
     bool found = false;
     for (uint32 i=1u; (i<(nargs - 1u) && (!found)); i++) {
@@ -77,13 +72,40 @@ static bool ParseArgument(uint32 nargs, char8 **args, StreamString flag, StreamS
     return found;
 }
 
+/**
+ * @brief Returns true if the argument \a flag was set.
+ */
+static bool HasArgument(uint32 nargs, char8 **args, StreamString flag) {
+    bool found = false;
+    for (uint32 i=1u; (i<nargs) && (!found); i++) {
+        found = (flag == args[i]);
+    }
+    return found;
+}
+
+/**
+ * @brief Prints one document of a multi-document stream as the C string variable \a context (a StreamString).
+ */
+static bool PrintStreamDocument(void * const context, ConfigurationDatabase &cdb, StreamString &output) {
+    const StreamString *cVariableName = static_cast<StreamString *>(context);
+    return ConfigurationConverter::PrintCString(cdb, *cVariableName, output);
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 int main(int argc, char **argv) {
-    SetErrorProcessFunction(&MainErrorProcessFunction);
-    const char8 *args = "-i INPUT_FILE -o OUTPUT_FILE -if json|xml|cdb -ov cVariableName";
+    Diagnostics::Install();
+    const char8 *args = "-i INPUT_FILE -o OUTPUT_FILE -if json|xml|cdb -ov cVariableName [-stream length|delimiter [-delimiter LINE]]. The file - is the standard input/output";
+    bool isStream = HasArgument(argc, argv, "-stream");
+    bool hasDelimiter = HasArgument(argc, argv, "-delimiter");
     int32 nargs = 9u;
+    if (isStream) {
+        nargs += 2;
+    }
+    if (hasDelimiter) {
+        nargs += 2;
+    }
     if (argc != nargs) {
         REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s (%d!=%d)\n", args, argc, nargs);
         return -1;
@@ -102,51 +124,94 @@ int main(int argc, char **argv) {
     if (ok) {
        ok = ParseArgument(argc, argv, "-ov", cVariableName);
     }
+    StreamString streamFraming;
+    StreamString delimiter = "---";
+    if ((ok) && (isStream)) {
+        ok = ParseArgument(argc, argv, "-stream", streamFraming);
+        if (ok) {
+            ok = (streamFraming == "length") || (streamFraming == "delimiter");
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Arguments are %s\n", args);
+            }
+        }
+    }
+    if ((ok) && (hasDelimiter)) {
+        ok = ParseArgument(argc, argv, "-delimiter", delimiter);
+    }
+    if (outputFilename == "-") {
+        //The standard output carries the C string
+        Diagnostics::SetOutput(STDERR_FILENO);
+    }
+    Diagnostics::SetContext(inputFilename.Buffer());
+    if ((ok) && (isStream)) {
+        int32 inputFd = ConfigurationStream::OpenInput(inputFilename.Buffer());
+        int32 outputFd = ConfigurationStream::OpenOutput(outputFilename.Buffer());
+        ok = (inputFd >= 0) && (outputFd >= 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open %s or %s\n", inputFilename.Buffer(), outputFilename.Buffer());
+        }
+        if (ok) {
+            ConfigurationStream stream(inputFd, outputFd, inputFormat.Buffer(), (streamFraming == "delimiter") ? delimiter.Buffer() : NULL_PTR(const char8 *));
+            ok = stream.Convert(&PrintStreamDocument, &cVariableName);
+        }
+        (void) ConfigurationStream::Close(inputFd);
+        if (!ConfigurationStream::Close(outputFd)) {
+            ok = false;
+        }
+        Diagnostics::SetContext(NULL_PTR(const char8 *));
+        return ok ? 0 : -1;
+    }
 
     File inputFile;
-    if (ok) {
+    StreamString standardInput;
+    BufferedStreamI *input = &inputFile;
+    if ((ok) && (inputFilename == "-")) {
+        input = &standardInput;
+        ok = ConfigurationStream::ReadAll(ConfigurationStream::OpenInput("-"), standardInput);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to read the standard input\n");
+        }
+    }
+    else if (ok) {
         ok = inputFile.Open(inputFilename.Buffer(), BasicFile::ACCESS_MODE_R);
         if (!ok) {
             REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", inputFilename.Buffer());
         }
+        if (ok) {
+            ok = inputFile.Seek(0);
+        }
     }
-    if (ok) {
-        ok = inputFile.Seek(0);
+    else {
+        //Invalid arguments
     }
     ConfigurationDatabase parsedConfiguration;
     if (ok) {
         StreamString parserError;
-        if (inputFormat == "xml") {
-            XMLParser parser(inputFile, parsedConfiguration, &parserError);
-            ok = parser.Parse();
-        }
-        else if (inputFormat == "json") {
-            JsonParser parser(inputFile, parsedConfiguration, &parserError);
-            ok = parser.Parse();
-        }
-        else if (inputFormat == "cdb") {
-            StandardParser parser(inputFile, parsedConfiguration, &parserError);
-            ok = parser.Parse();
-        }
-        else {
-            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown input format specified");
-        }
+        ok = ConfigurationCache::Parse(*input, inputFormat.Buffer(), parsedConfiguration, parserError);
         if (!ok) {
             StreamString errPrint;
             (void) errPrint.Printf("Failed to parse %s", parserError.Buffer());
             REPORT_ERROR_STATIC(ErrorManagement::ParametersError, errPrint.Buffer());
         }
     }
-    if (ok) {
+    if ((ok) && (inputFile.IsOpen())) {
         ok = inputFile.Close();
     }
     if (ok) {
-        ok = parsedConfiguration.MoveToRoot();
+        ok = ConfigurationInclude::Resolve(parsedConfiguration, inputFilename.Buffer(), inputFormat.Buffer());
     }
     if (ok) {
+        ok = parsedConfiguration.MoveToRoot();
     }
-    File outputFile;
+    StreamString text;
     if (ok) {
+        ok = ConfigurationConverter::PrintCString(parsedConfiguration, cVariableName, text);
+    }
+    if ((ok) && (outputFilename == "-")) {
+        ok = ConfigurationStream::WriteAll(ConfigurationStream::OpenOutput("-"), text.Buffer(), static_cast<uint32>(text.Size()));
+    }
+    else if (ok) {
+        File outputFile;
         Directory d(outputFilename.Buffer());
         d.Delete();
 
@@ -154,42 +219,21 @@ int main(int argc, char **argv) {
         if (!ok) {
             REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", outputFilename.Buffer());
         }
-    }
-    StreamString cfgAsString;
-    StreamString output;
-    if (ok) {
-        cfgAsString.Printf("%!", parsedConfiguration);
-        cfgAsString.Seek(0LLU);
-        StreamString token;
-        char8 term;
-        while(cfgAsString.GetToken(token, "\"", term)) {
-            if (token.Size() > 0LLU) {
-                output += token;
-                if (term == '\"') {
-                    output += "\\\"";
-                }
-            }
-            token = "";
-        }
-    }
-    if (ok) {
-        output.Seek(0LLU);
-        StreamString line;
-        ok = outputFile.Printf("const char * %s = \"\"\n", cVariableName.Buffer());
-        while(output.GetLine(line) && ok) {
-            ok = outputFile.Printf("\"%s\\n\"\n", line.Buffer());
-            line = "";
-        }
         if (ok) {
-            outputFile.Printf("%s", ";\n");
+            uint32 writeSize = static_cast<uint32>(text.Size());
+            ok = outputFile.Write(text.Buffer(), writeSize);
         }
         if (ok) {
             ok = outputFile.Flush();
         }
+        if (ok) {
+            ok = outputFile.Close();
+        }
     }
-    if (ok) {
-        ok = outputFile.Close();
+    else {
+        //Failed to parse
     }
+    Diagnostics::SetContext(NULL_PTR(const char8 *));
     int32 ret = ok ? 0 : -1;
     return ret;
 }
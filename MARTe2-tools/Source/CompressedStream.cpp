@@ -0,0 +1,333 @@
+/**
+ * @file CompressedStream.cpp
+ * @brief Source file for class CompressedStream
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CompressedStream (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <unistd.h>
+#include <zlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CompressedStream.h"
+#include "ConfigurationStream.h"
+#include "Diagnostics.h"
+#include "MemoryOperationsHelper.h"
+#include "Sleep.h"
+#include "StringHelper.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Size of the pipe write buffer and of the deflate/inflate buffers.
+ */
+static const uint32 COMPRESSED_STREAM_BUFFER_SIZE = 65536u;
+
+/**
+ * zlib window bits. Adding 16 selects the gzip wrapper instead of the zlib one.
+ */
+static const int COMPRESSED_STREAM_GZIP_WINDOW_BITS = 15 + 16;
+
+/**
+ * @brief Initialises \a zs to deflate a gzip stream.
+ */
+static bool DeflateBegin(z_stream &zs) {
+    (void) MemoryOperationsHelper::Set(&zs, '\0', static_cast<uint32>(sizeof(z_stream)));
+    bool ok = (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, COMPRESSED_STREAM_GZIP_WINDOW_BITS, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to initialise the compressor");
+    }
+    return ok;
+}
+
+/**
+ * @brief Deflates the pending input of \a zs and writes the result into \a outputFd.
+ * @param[in] flush Z_NO_FLUSH while there is more input to come, Z_FINISH to write the end of the gzip stream.
+ * @param[in] outputBuffer scratch buffer with COMPRESSED_STREAM_BUFFER_SIZE bytes.
+ */
+static bool DeflateInto(z_stream &zs, const int flush, const int32 outputFd, char8 * const outputBuffer) {
+    bool ok = true;
+    bool done = false;
+    while ((ok) && (!done)) {
+        zs.next_out = reinterpret_cast<Bytef *>(outputBuffer);
+        zs.avail_out = static_cast<uInt>(COMPRESSED_STREAM_BUFFER_SIZE);
+        int ret = deflate(&zs, flush);
+        uint32 produced = COMPRESSED_STREAM_BUFFER_SIZE - static_cast<uint32>(zs.avail_out);
+        ok = (ret != Z_STREAM_ERROR);
+        if ((ok) && (produced > 0u)) {
+            ok = ConfigurationStream::WriteAll(outputFd, outputBuffer, produced);
+        }
+        if (flush == Z_FINISH) {
+            done = (ret == Z_STREAM_END);
+            if ((!done) && (produced == 0u)) {
+                //No progress possible
+                ok = false;
+            }
+        }
+        else {
+            //All the input was consumed
+            done = (zs.avail_out != 0u);
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+CompressedStream::CompressedStream() {
+    pipeInputFd = -1;
+    outputFd = -1;
+    open = false;
+    compressorOk = true;
+    compressorTid = InvalidThreadIdentifier;
+    (void) compressorDoneSem.Create();
+}
+
+CompressedStream::~CompressedStream() {
+    (void) Close();
+    (void) compressorDoneSem.Close();
+}
+
+bool CompressedStream::Open(const int32 outputFdIn) {
+    int pipeFds[2];
+    bool ok = (!open);
+    if (ok) {
+        ok = (pipe(pipeFds) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to create the compressor pipe");
+        }
+    }
+    if (ok) {
+        //The File is opened on its own descriptor, so that closing it signals the end of the content to the compressor thread
+        StreamString pipeName;
+        (void) pipeName.Printf("/dev/fd/%d", static_cast<int32>(pipeFds[1]));
+        pipeInputFd = static_cast<int32>(pipeFds[0]);
+        ok = pipeOutput.Open(pipeName.Buffer(), BasicFile::ACCESS_MODE_W);
+        (void) close(pipeFds[1]);
+        if (ok) {
+            //The printers write many small tokens
+            ok = pipeOutput.SetBufferSize(0u, COMPRESSED_STREAM_BUFFER_SIZE);
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open the compressor pipe");
+        }
+    }
+    if (ok) {
+        outputFd = outputFdIn;
+        compressorOk = true;
+        (void) compressorDoneSem.Reset();
+        compressorTid = Threads::BeginThread(&CompressedStream::CompressorThread, this, THREADS_DEFAULT_STACKSIZE * 4u);
+        ok = (compressorTid != InvalidThreadIdentifier);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to start the compressor thread");
+        }
+    }
+    if (ok) {
+        open = true;
+    }
+    else {
+        if (pipeOutput.IsOpen()) {
+            (void) pipeOutput.Close();
+        }
+        if (pipeInputFd >= 0) {
+            (void) close(pipeInputFd);
+            pipeInputFd = -1;
+        }
+    }
+    return ok;
+}
+
+BufferedStreamI &CompressedStream::GetStream() {
+    return pipeOutput;
+}
+
+bool CompressedStream::Close() {
+    bool ok = true;
+    if (open) {
+        ok = pipeOutput.Flush();
+        //Closing the write end of the pipe lets the compressor thread finish the gzip stream
+        if (!pipeOutput.Close()) {
+            ok = false;
+        }
+        (void) compressorDoneSem.Wait(TTInfiniteWait);
+        //Join the compressor thread, which may still be inside Post, before the stream is reopened or destroyed
+        while (Threads::IsAlive(compressorTid)) {
+            Sleep::MSec(1u);
+        }
+        compressorTid = InvalidThreadIdentifier;
+        if (!compressorOk) {
+            ok = false;
+        }
+        open = false;
+    }
+    return ok;
+}
+
+bool CompressedStream::IsCompressedName(const char8 * const filename) {
+    uint32 length = StringHelper::Length(filename);
+    bool compressed = (length > 3u);
+    if (compressed) {
+        compressed = (StringHelper::Compare(&filename[length - 3u], ".gz") == 0);
+    }
+    return compressed;
+}
+
+bool CompressedStream::IsCompressed(StreamI &stream) {
+    char8 magic[2];
+    uint32 readSize = 2u;
+    bool compressed = stream.Seek(0LLU);
+    if (compressed) {
+        compressed = stream.Read(&magic[0], readSize);
+    }
+    if (compressed) {
+        compressed = ((readSize == 2u) && (static_cast<uint8>(magic[0]) == 0x1Fu) && (static_cast<uint8>(magic[1]) == 0x8Bu));
+    }
+    (void) stream.Seek(0LLU);
+    return compressed;
+}
+
+bool CompressedStream::Decompress(StreamI &stream, StreamString &content) {
+    z_stream zs;
+    (void) MemoryOperationsHelper::Set(&zs, '\0', static_cast<uint32>(sizeof(z_stream)));
+    bool ok = (inflateInit2(&zs, COMPRESSED_STREAM_GZIP_WINDOW_BITS) == Z_OK);
+    bool initialised = ok;
+    if (ok) {
+        ok = stream.Seek(0LLU);
+    }
+    char8 *inputBuffer = new char8[COMPRESSED_STREAM_BUFFER_SIZE];
+    char8 *outputBuffer = new char8[COMPRESSED_STREAM_BUFFER_SIZE];
+    bool ended = false;
+    uint32 readSize = COMPRESSED_STREAM_BUFFER_SIZE;
+    while ((ok) && (readSize == COMPRESSED_STREAM_BUFFER_SIZE)) {
+        ok = stream.Read(inputBuffer, readSize);
+        if ((ok) && (readSize > 0u) && (ended)) {
+            //Another gzip member follows (e.g. cat a.gz b.gz)
+            ok = (inflateReset(&zs) == Z_OK);
+            ended = false;
+        }
+        zs.next_in = reinterpret_cast<Bytef *>(inputBuffer);
+        zs.avail_in = static_cast<uInt>(readSize);
+        while ((ok) && (zs.avail_in > 0u)) {
+            zs.next_out = reinterpret_cast<Bytef *>(outputBuffer);
+            zs.avail_out = static_cast<uInt>(COMPRESSED_STREAM_BUFFER_SIZE);
+            int ret = inflate(&zs, Z_NO_FLUSH);
+            ok = ((ret == Z_OK) || (ret == Z_STREAM_END));
+            uint32 produced = COMPRESSED_STREAM_BUFFER_SIZE - static_cast<uint32>(zs.avail_out);
+            if ((ok) && (produced > 0u)) {
+                ok = content.Write(outputBuffer, produced);
+            }
+            if ((ok) && (ret == Z_STREAM_END)) {
+                ended = true;
+                if (zs.avail_in > 0u) {
+                    ok = (inflateReset(&zs) == Z_OK);
+                    ended = false;
+                }
+            }
+        }
+    }
+    if (ok) {
+        //Otherwise the content is truncated
+        ok = ended;
+    }
+    if (initialised) {
+        (void) inflateEnd(&zs);
+    }
+    delete [] inputBuffer;
+    delete [] outputBuffer;
+    if (ok) {
+        ok = content.Seek(0LLU);
+    }
+    return ok;
+}
+
+bool CompressedStream::Compress(const char8 * const buffer, const uint32 size, const int32 outputFd) {
+    z_stream zs;
+    bool ok = DeflateBegin(zs);
+    if (ok) {
+        char8 *outputBuffer = new char8[COMPRESSED_STREAM_BUFFER_SIZE];
+        zs.next_in = reinterpret_cast<Bytef *>(const_cast<char8 *>(buffer));
+        zs.avail_in = static_cast<uInt>(size);
+        ok = DeflateInto(zs, Z_FINISH, outputFd, outputBuffer);
+        (void) deflateEnd(&zs);
+        delete [] outputBuffer;
+    }
+    return ok;
+}
+
+void CompressedStream::CompressorThread(const void * const parameters) {
+    CompressedStream *stream = static_cast<CompressedStream *>(const_cast<void *>(parameters));
+    z_stream zs;
+    bool initialised = DeflateBegin(zs);
+    bool ok = initialised;
+    char8 *inputBuffer = new char8[COMPRESSED_STREAM_BUFFER_SIZE];
+    char8 *outputBuffer = new char8[COMPRESSED_STREAM_BUFFER_SIZE];
+    bool done = false;
+    while (!done) {
+        ssize_t n = read(stream->pipeInputFd, inputBuffer, static_cast<size_t>(COMPRESSED_STREAM_BUFFER_SIZE));
+        if (n > 0) {
+            //After a failure the pipe is still drained, so that the printer is never blocked
+            if (ok) {
+                zs.next_in = reinterpret_cast<Bytef *>(inputBuffer);
+                zs.avail_in = static_cast<uInt>(n);
+                ok = DeflateInto(zs, Z_NO_FLUSH, stream->outputFd, outputBuffer);
+            }
+        }
+        else if (n == 0) {
+            done = true;
+        }
+        else if (errno == EINTR) {
+            //Retry
+        }
+        else {
+            ok = false;
+            done = true;
+        }
+    }
+    if (ok) {
+        ok = DeflateInto(zs, Z_FINISH, stream->outputFd, outputBuffer);
+    }
+    if (initialised) {
+        (void) deflateEnd(&zs);
+    }
+    delete [] inputBuffer;
+    delete [] outputBuffer;
+    (void) close(stream->pipeInputFd);
+    stream->pipeInputFd = -1;
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to compress the output");
+    }
+    stream->compressorOk = ok;
+    Diagnostics::Release();
+    (void) stream->compressorDoneSem.Post();
+}
+
+}
@@ -0,0 +1,148 @@
+/**
+ * @file CompressedStream.h
+ * @brief Header file for class CompressedStream
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class CompressedStream
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef COMPRESSEDSTREAM_H_
+#define COMPRESSEDSTREAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BufferedStreamI.h"
+#include "CompilerTypes.h"
+#include "EventSem.h"
+#include "File.h"
+#include "StreamI.h"
+#include "StreamString.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Writes a gzip compressed output while it is being printed.
+ * @details The printers write into a pipe (GetStream) and a compressor thread deflates what comes out of the pipe into the output file
+ * descriptor, so that the compression overlaps with the printing. The output is a standard gzip file (RFC 1952), which can be read with gunzip.
+ *
+ * The static methods detect and inflate gzip content, so that any configuration file may be given compressed to the parsers.
+ */
+class CompressedStream {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    CompressedStream();
+
+    /**
+     * @brief Destructor. Calls Close if the stream is still open.
+     */
+    ~CompressedStream();
+
+    /**
+     * @brief Starts the compressor thread, which writes into \a outputFdIn.
+     * @details \a outputFdIn is not closed by this class.
+     * @return true if the pipe was created and the thread started.
+     */
+    bool Open(const int32 outputFdIn);
+
+    /**
+     * @brief The stream where the uncompressed content is to be printed. Only valid between Open and Close.
+     */
+    BufferedStreamI &GetStream();
+
+    /**
+     * @brief Flushes the stream and waits for the compressor thread to write the end of the gzip stream.
+     * @return true if all the content was compressed and written.
+     */
+    bool Close();
+
+    /**
+     * @brief Returns true if \a filename has the .gz extension.
+     */
+    static bool IsCompressedName(const char8 * const filename);
+
+    /**
+     * @brief Returns true if \a stream starts with the gzip magic number. The stream is left at position 0.
+     */
+    static bool IsCompressed(StreamI &stream);
+
+    /**
+     * @brief Inflates the gzip \a stream (from its position 0) into \a content. Concatenated gzip members are supported.
+     */
+    static bool Decompress(StreamI &stream, StreamString &content);
+
+    /**
+     * @brief Deflates the \a size bytes of \a buffer as a gzip stream into \a outputFd, in the caller's thread.
+     */
+    static bool Compress(const char8 * const buffer, const uint32 size, const int32 outputFd);
+
+private:
+    /**
+     * @brief Deflates the content of the pipe into the output file descriptor until the pipe is closed.
+     */
+    static void CompressorThread(const void * const parameters);
+
+    /**
+     * The write end of the pipe, given to the printers.
+     */
+    File pipeOutput;
+
+    /**
+     * The read end of the pipe, read by the compressor thread.
+     */
+    int32 pipeInputFd;
+
+    /**
+     * Where the compressed content is written.
+     */
+    int32 outputFd;
+
+    /**
+     * True while the compressor thread is running.
+     */
+    bool open;
+
+    /**
+     * False if the compressor thread failed to deflate or to write.
+     */
+    bool compressorOk;
+
+    /**
+     * Posted when the compressor thread terminates.
+     */
+    EventSem compressorDoneSem;
+
+    /**
+     * The compressor thread, joined by Close.
+     */
+    ThreadIdentifier compressorTid;
+};
+
+}
+
+#endif /* COMPRESSEDSTREAM_H_ */
@@ -0,0 +1,348 @@
+/**
+ * @file ConfigurationCache.cpp
+ * @brief Source file for class ConfigurationCache
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ConfigurationCache (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <string.h>
+#include <time.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CompressedStream.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationParallelParser.h"
+#include "Directory.h"
+#include "FastStandardParser.h"
+#include "File.h"
+#include "HashFunction.h"
+#include "JsonParser.h"
+#include "XMLParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ConfigurationCache::ConfigurationCache(const uint32 capacityIn) {
+    capacity = capacityIn;
+    if (capacity == 0u) {
+        capacity = 1u;
+    }
+    entries = new Entry[capacity];
+    uint32 i;
+    for (i = 0u; i < capacity; i++) {
+        entries[i].used = false;
+        entries[i].writeTime = 0u;
+        entries[i].readTime = 0u;
+        entries[i].size = 0u;
+        entries[i].hash = 0u;
+        entries[i].lastUsed = 0u;
+    }
+    useCounter = 0u;
+    hits = 0u;
+    misses = 0u;
+    (void) mux.Create();
+}
+
+ConfigurationCache::~ConfigurationCache() {
+    delete [] entries;
+    (void) mux.Close();
+}
+
+bool ConfigurationCache::Parse(StreamI &stream, const char8 * const format, ConfigurationDatabase &cdb, StreamString &err, const uint32 numberOfThreads) {
+    bool ok = stream.Seek(0LLU);
+    StreamString formatStr = format;
+    if ((ok) && (CompressedStream::IsCompressed(stream))) {
+        //Any of the formats may be gzip compressed
+        StreamString content;
+        ok = CompressedStream::Decompress(stream, content);
+        if (ok) {
+            ok = Parse(content, format, cdb, err, numberOfThreads);
+        }
+        else {
+            err.Printf("%s", "Failed to decompress the gzip input");
+        }
+    }
+    else if ((ok) && (numberOfThreads != 1u) && (stream.Size() >= ConfigurationParallelParser::MIN_PARALLEL_SIZE)) {
+        StreamString content;
+        ok = ReadStream(stream, content);
+        if (ok) {
+            ok = ConfigurationParallelParser::Parse(content, format, cdb, err, numberOfThreads);
+        }
+    }
+    else if (ok) {
+        if (formatStr == "xml") {
+            XMLParser parser(stream, cdb, &err);
+            ok = parser.Parse();
+        }
+        else if (formatStr == "json") {
+            JsonParser parser(stream, cdb, &err);
+            ok = parser.Parse();
+        }
+        else if (formatStr == "cdb") {
+            ok = FastStandardParser::Parse(stream, cdb, err);
+        }
+        else {
+            err.Printf("Unknown input format %s", format);
+            ok = false;
+        }
+    }
+    else {
+        //Failed
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    return ok;
+}
+
+bool ConfigurationCache::ReadFile(const char8 * const filename, StreamString &content) {
+    File inputFile;
+    bool ok = inputFile.Open(filename, BasicFile::ACCESS_MODE_R);
+    if (ok) {
+        ok = inputFile.Seek(0LLU);
+    }
+    if (ok) {
+        ok = ReadStream(inputFile, content);
+    }
+    if (inputFile.IsOpen()) {
+        (void) inputFile.Close();
+    }
+    return ok;
+}
+
+bool ConfigurationCache::ReadStream(StreamI &stream, StreamString &content) {
+    const uint32 bufferSize = 65536u;
+    char8 *buffer = new char8[bufferSize];
+    uint32 readSize = bufferSize;
+    bool ok = true;
+    while ((ok) && (readSize == bufferSize)) {
+        readSize = bufferSize;
+        ok = stream.Read(buffer, readSize);
+        if ((ok) && (readSize > 0u)) {
+            uint32 writeSize = readSize;
+            ok = content.Write(buffer, writeSize);
+        }
+    }
+    delete [] buffer;
+    return ok;
+}
+
+uint32 ConfigurationCache::Find(const char8 * const key, const char8 * const format) const {
+    uint32 idx = capacity;
+    uint32 i;
+    for (i = 0u; (i < capacity) && (idx == capacity); i++) {
+        if (entries[i].used) {
+            if ((entries[i].key == key) && (entries[i].format == format)) {
+                idx = i;
+            }
+        }
+    }
+    return idx;
+}
+
+void ConfigurationCache::Store(const char8 * const key, const char8 * const format, const uint64 writeTime, const uint64 readTime, const uint64 size,
+                               const uint64 hash, const StreamString * const content, ConfigurationDatabase &cdb) {
+    uint32 idx = Find(key, format);
+    uint32 i;
+    for (i = 0u; (i < capacity) && (idx == capacity); i++) {
+        if (!entries[i].used) {
+            idx = i;
+        }
+    }
+    if (idx == capacity) {
+        //Evict the least recently used
+        idx = 0u;
+        for (i = 1u; i < capacity; i++) {
+            if (entries[i].lastUsed < entries[idx].lastUsed) {
+                idx = i;
+            }
+        }
+    }
+    useCounter++;
+    entries[idx].used = true;
+    entries[idx].key = key;
+    entries[idx].format = format;
+    entries[idx].writeTime = writeTime;
+    entries[idx].readTime = readTime;
+    entries[idx].size = size;
+    entries[idx].hash = hash;
+    (void) entries[idx].content.SetSize(0LLU);
+    if (content != NULL_PTR(const StreamString *)) {
+        //Written rather than assigned, as a (compressed) content may contain zeros
+        uint32 contentSize = static_cast<uint32>(content->Size());
+        (void) entries[idx].content.Write(content->Buffer(), contentSize);
+    }
+    entries[idx].lastUsed = useCounter;
+    entries[idx].cdb = cdb;
+}
+
+bool ConfigurationCache::GetFile(const char8 * const filename, const char8 * const format, ConfigurationDatabase &cdb, StreamString &err) {
+    Directory d(filename);
+    bool ok = d.Exists();
+    uint64 writeTime = 0u;
+    if (ok) {
+        writeTime = d.GetLastWriteTime();
+    }
+    else {
+        err.Printf("File %s does not exist", filename);
+    }
+    bool found = false;
+    if (ok) {
+        ok = mux.Lock(TTInfiniteWait).ErrorsCleared();
+    }
+    if (ok) {
+        uint32 idx = Find(filename, format);
+        if (idx < capacity) {
+            //The write time has a one second resolution: if the file was read in the same second it was written
+            //it may have been rewritten since without changing the write time
+            found = (entries[idx].writeTime == writeTime) && (writeTime < entries[idx].readTime);
+            if (found) {
+                useCounter++;
+                entries[idx].lastUsed = useCounter;
+                cdb = entries[idx].cdb;
+            }
+        }
+        (void) mux.UnLock();
+    }
+    StreamString content;
+    uint64 hash = 0u;
+    //Taken before reading so that a write during the read is never considered older than the read
+    uint64 readTime = static_cast<uint64>(time(NULL_PTR(time_t *)));
+    if ((ok) && (!found)) {
+        ok = ReadFile(filename, content);
+        if (ok) {
+            hash = HashFunction::Fnv1a(content.Buffer(), static_cast<uint32>(content.Size()));
+        }
+        else {
+            err.Printf("Failed to read %s", filename);
+        }
+    }
+    if ((ok) && (!found)) {
+        //Touched but not changed?
+        ok = mux.Lock(TTInfiniteWait).ErrorsCleared();
+        if (ok) {
+            uint32 idx = Find(filename, format);
+            if (idx < capacity) {
+                found = (entries[idx].size == content.Size()) && (entries[idx].hash == hash);
+                if (found) {
+                    useCounter++;
+                    entries[idx].lastUsed = useCounter;
+                    entries[idx].writeTime = writeTime;
+                    entries[idx].readTime = readTime;
+                    cdb = entries[idx].cdb;
+                }
+            }
+            (void) mux.UnLock();
+        }
+    }
+    if ((ok) && (!found)) {
+        ConfigurationDatabase parsed;
+        //Parse outside of the lock so that different files can be parsed concurrently
+        ok = Parse(content, format, parsed, err);
+        if (ok) {
+            ok = mux.Lock(TTInfiniteWait).ErrorsCleared();
+        }
+        if (ok) {
+            misses++;
+            Store(filename, format, writeTime, readTime, content.Size(), hash, NULL_PTR(const StreamString *), parsed);
+            (void) mux.UnLock();
+            cdb = parsed;
+        }
+    }
+    else if (found) {
+        if (mux.Lock(TTInfiniteWait).ErrorsCleared()) {
+            hits++;
+            (void) mux.UnLock();
+        }
+    }
+    else {
+        //Failed
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    return ok;
+}
+
+bool ConfigurationCache::GetContent(StreamString &content, const char8 * const format, ConfigurationDatabase &cdb, StreamString &err) {
+    uint64 hash = HashFunction::Fnv1a(content.Buffer(), static_cast<uint32>(content.Size()));
+    StreamString key;
+    bool ok = key.Printf("inline:%llu", hash);
+    bool found = false;
+    if (ok) {
+        ok = mux.Lock(TTInfiniteWait).ErrorsCleared();
+    }
+    if (ok) {
+        uint32 idx = Find(key.Buffer(), format);
+        found = (idx < capacity);
+        if (found) {
+            //Do not trust the hash alone
+            found = (entries[idx].content.Size() == content.Size());
+        }
+        if (found) {
+            found = (memcmp(entries[idx].content.Buffer(), content.Buffer(), static_cast<size_t>(content.Size())) == 0);
+        }
+        if (found) {
+            useCounter++;
+            entries[idx].lastUsed = useCounter;
+            cdb = entries[idx].cdb;
+            hits++;
+        }
+        (void) mux.UnLock();
+    }
+    if ((ok) && (!found)) {
+        ConfigurationDatabase parsed;
+        ok = Parse(content, format, parsed, err);
+        if (ok) {
+            ok = mux.Lock(TTInfiniteWait).ErrorsCleared();
+        }
+        if (ok) {
+            misses++;
+            Store(key.Buffer(), format, 0u, 0u, content.Size(), hash, &content, parsed);
+            (void) mux.UnLock();
+            cdb = parsed;
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    return ok;
+}
+
+void ConfigurationCache::GetStatistics(uint64 &hitsOut, uint64 &missesOut) {
+    if (mux.Lock(TTInfiniteWait).ErrorsCleared()) {
+        hitsOut = hits;
+        missesOut = misses;
+        (void) mux.UnLock();
+    }
+}
+
+}
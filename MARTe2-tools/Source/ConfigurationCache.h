@@ -0,0 +1,144 @@
+/**
+ * @file ConfigurationCache.h
+ * @brief Header file for class ConfigurationCache
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ConfigurationCache
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CONFIGURATIONCACHE_H_
+#define CONFIGURATIONCACHE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+#include "MutexSem.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Least recently used cache of parsed configurations.
+ * @details Files are identified by their path and last write time. If the write time changed
+ * but the content size and hash did not, the cached configuration is still used. As the write time
+ * only has a resolution of one second, a file whose write time is not older than the moment it was read
+ * is always read and hashed again. Inline contents are identified by their hash and the full content
+ * is compared before using a cached configuration. The returned ConfigurationDatabase shares the (read-only) tree with the cache,
+ * so that it remains valid even if the entry is later evicted.
+ * All the methods are thread safe.
+ */
+class ConfigurationCache {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] capacityIn maximum number of parsed configurations to keep.
+     */
+    ConfigurationCache(const uint32 capacityIn = 32u);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ConfigurationCache();
+
+    /**
+     * @brief Gets the parsed configuration of the file \a filename, parsing it only if needed.
+     * @param[in] format one of cdb, json or xml.
+     * @param[out] cdb the parsed configuration, pointing at its root.
+     * @param[out] err the parser errors.
+     * @return true if the file could be read and parsed.
+     */
+    bool GetFile(const char8 * const filename, const char8 * const format, ConfigurationDatabase &cdb, StreamString &err);
+
+    /**
+     * @brief Gets the parsed configuration of \a content, parsing it only if needed.
+     * @see GetFile
+     */
+    bool GetContent(StreamString &content, const char8 * const format, ConfigurationDatabase &cdb, StreamString &err);
+
+    /**
+     * @brief Parses \a stream, in the given \a format (cdb, json or xml), into \a cdb.
+     * @details Streams with at least ConfigurationParallelParser::MIN_PARALLEL_SIZE bytes are parsed with the ConfigurationParallelParser.
+     * gzip compressed streams are first decompressed (see CompressedStream).
+     * @param[in] numberOfThreads the maximum number of parsing threads. If zero one per processor is used.
+     */
+    static bool Parse(StreamI &stream, const char8 * const format, ConfigurationDatabase &cdb, StreamString &err, const uint32 numberOfThreads = 0u);
+
+    /**
+     * @brief Reads the full content of the file \a filename into \a content.
+     */
+    static bool ReadFile(const char8 * const filename, StreamString &content);
+
+    /**
+     * @brief Reads \a stream, from its current position until its end, into \a content.
+     */
+    static bool ReadStream(StreamI &stream, StreamString &content);
+
+    /**
+     * @brief Gets the number of cache hits and misses since the cache was created.
+     */
+    void GetStatistics(uint64 &hits, uint64 &misses);
+
+private:
+    /**
+     * One cached configuration.
+     */
+    struct Entry {
+        StreamString key;
+        StreamString format;
+        uint64 writeTime;
+        uint64 readTime;
+        uint64 size;
+        uint64 hash;
+        StreamString content;
+        uint64 lastUsed;
+        bool used;
+        ConfigurationDatabase cdb;
+    };
+
+    /**
+     * @brief Finds the entry with \a key and \a format. Returns capacity if not found. Must be called with mux locked.
+     */
+    uint32 Find(const char8 * const key, const char8 * const format) const;
+
+    /**
+     * @brief Stores \a cdb, replacing the entry with the same key or the least recently used one. Must be called with mux locked.
+     * @param[in] content the content to compare against on later lookups (NULL for files, which are compared by size and hash).
+     */
+    void Store(const char8 * const key, const char8 * const format, const uint64 writeTime, const uint64 readTime, const uint64 size, const uint64 hash,
+               const StreamString * const content, ConfigurationDatabase &cdb);
+
+    Entry *entries;
+    uint32 capacity;
+    uint64 useCounter;
+    uint64 hits;
+    uint64 misses;
+    MutexSem mux;
+};
+
+}
+
+#endif /* CONFIGURATIONCACHE_H_ */
@@ -0,0 +1,230 @@
+/**
+ * @file ConfigurationCanonicalForm.cpp
+ * @brief Source file for the ConfigurationCanonicalForm functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the ConfigurationCanonicalForm functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationCanonicalForm.h"
+#include "Matrix.h"
+#include "StringHelper.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Sorts the indexes of the leaves by their names (insertion sort, as the number of leaves per node is small).
+ */
+static void SortByName(ConfigurationDatabase &source, uint32 * const indexes, const uint32 size) {
+    uint32 i;
+    for (i = 1u; i < size; i++) {
+        uint32 current = indexes[i];
+        const char8 * const currentName = source.GetChildName(current);
+        uint32 j = i;
+        while ((j > 0u) && (StringHelper::Compare(source.GetChildName(indexes[j - 1u]), currentName) > 0)) {
+            indexes[j] = indexes[j - 1u];
+            j--;
+        }
+        indexes[j] = current;
+    }
+}
+
+/**
+ * @brief Writes the leaf \a name of \a source, with all its elements normalised, into \a destination.
+ */
+static bool CopyLeaf(ConfigurationDatabase &source, StructuredDataI &destination, const char8 * const name) {
+    AnyType leaf = source.GetType(name);
+    uint8 numberOfDimensions = leaf.GetNumberOfDimensions();
+    bool ok = true;
+    if (numberOfDimensions == 0u) {
+        StreamString value;
+        ok = source.Read(name, value);
+        if (ok) {
+            ConfigurationCanonicalForm::NormaliseNumber(value);
+            ok = destination.Write(name, value);
+        }
+    }
+    else {
+        uint32 numberOfColumns = leaf.GetNumberOfElements(0u);
+        uint32 numberOfRows = (numberOfDimensions > 1u) ? leaf.GetNumberOfElements(1u) : 1u;
+        uint32 numberOfElements = numberOfColumns * numberOfRows;
+        StreamString *values = new StreamString[numberOfElements];
+        if (numberOfDimensions == 1u) {
+            Vector<StreamString> vec(values, numberOfColumns);
+            ok = source.Read(name, vec);
+        }
+        else {
+            Matrix<StreamString> mat(values, numberOfRows, numberOfColumns);
+            ok = source.Read(name, mat);
+        }
+        uint32 e;
+        for (e = 0u; (e < numberOfElements) && (ok); e++) {
+            ConfigurationCanonicalForm::NormaliseNumber(values[e]);
+        }
+        if (ok) {
+            if (numberOfDimensions == 1u) {
+                Vector<StreamString> vec(values, numberOfColumns);
+                ok = destination.Write(name, vec);
+            }
+            else {
+                Matrix<StreamString> mat(values, numberOfRows, numberOfColumns);
+                ok = destination.Write(name, mat);
+            }
+        }
+        delete [] values;
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace ConfigurationCanonicalForm {
+
+bool IsDecimalNumber(const char8 * const str, bool &isInteger) {
+    uint32 i = 0u;
+    if ((str[i] == '+') || (str[i] == '-')) {
+        i++;
+    }
+    uint32 mantissaDigits = 0u;
+    while ((str[i] >= '0') && (str[i] <= '9')) {
+        i++;
+        mantissaDigits++;
+    }
+    isInteger = true;
+    if (str[i] == '.') {
+        isInteger = false;
+        i++;
+        while ((str[i] >= '0') && (str[i] <= '9')) {
+            i++;
+            mantissaDigits++;
+        }
+    }
+    bool ok = (mantissaDigits > 0u);
+    if ((ok) && ((str[i] == 'e') || (str[i] == 'E'))) {
+        isInteger = false;
+        i++;
+        if ((str[i] == '+') || (str[i] == '-')) {
+            i++;
+        }
+        uint32 exponentDigits = 0u;
+        while ((str[i] >= '0') && (str[i] <= '9')) {
+            i++;
+            exponentDigits++;
+        }
+        ok = (exponentDigits > 0u);
+    }
+    if (ok) {
+        ok = (str[i] == '\0');
+    }
+    return ok;
+}
+
+void NormaliseNumber(StreamString &value) {
+    bool isInteger = false;
+    if (IsDecimalNumber(value.Buffer(), isInteger)) {
+        const char8 *str = value.Buffer();
+        StreamString normalised;
+        if (isInteger) {
+            bool negative = (str[0] == '-');
+            if ((str[0] == '+') || (str[0] == '-')) {
+                str = &str[1];
+            }
+            while ((str[0] == '0') && (str[1] != '\0')) {
+                str = &str[1];
+            }
+            //-0 is 0
+            if ((negative) && (StringHelper::Compare(str, "0") != 0)) {
+                (void) normalised.Printf("%s", "-");
+            }
+            (void) normalised.Printf("%s", str);
+        }
+        else {
+            float64 number = strtod(str, NULL_PTR(char8 **));
+            //Shortest representation that reads back to the same value
+            char8 buffer[32];
+            int32 precision;
+            bool found = false;
+            for (precision = 1; (precision <= 17) && (!found); precision++) {
+                (void) snprintf(&buffer[0], sizeof(buffer), "%.*g", precision, number);
+                found = (strtod(&buffer[0], NULL_PTR(char8 **)) == number);
+            }
+            (void) normalised.Printf("%s", &buffer[0]);
+            //Keep it a floating point number
+            if ((StringHelper::SearchChar(&buffer[0], '.') == NULL_PTR(const char8 *)) && (StringHelper::SearchChar(&buffer[0], 'e') == NULL_PTR(const char8 *))
+                    && (StringHelper::SearchChar(&buffer[0], 'n') == NULL_PTR(const char8 *))) {
+                (void) normalised.Printf("%s", ".0");
+            }
+        }
+        value = normalised;
+    }
+}
+
+bool Copy(ConfigurationDatabase &source, StructuredDataI &destination) {
+    uint32 numberOfChildren = source.GetNumberOfChildren();
+    uint32 *leaves = new uint32[numberOfChildren];
+    uint32 numberOfLeaves = 0u;
+    uint32 i;
+    //Leaves first (sorted by name), then the nodes in their original order
+    for (i = 0u; i < numberOfChildren; i++) {
+        if (source.MoveToChild(i)) {
+            (void) source.MoveToAncestor(1u);
+        }
+        else {
+            leaves[numberOfLeaves] = i;
+            numberOfLeaves++;
+        }
+    }
+    SortByName(source, leaves, numberOfLeaves);
+    bool ok = true;
+    for (i = 0u; (i < numberOfLeaves) && (ok); i++) {
+        ok = CopyLeaf(source, destination, source.GetChildName(leaves[i]));
+    }
+    delete [] leaves;
+    for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+        if (source.MoveToChild(i)) {
+            ok = destination.CreateRelative(source.GetName());
+            if (ok) {
+                ok = Copy(source, destination);
+            }
+            if (ok) {
+                ok = destination.MoveToAncestor(1u);
+            }
+            if (!source.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,77 @@
+/**
+ * @file ConfigurationCanonicalForm.h
+ * @brief Header file for the ConfigurationCanonicalForm functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the ConfigurationCanonicalForm functions.
+ */
+
+#ifndef CONFIGURATIONCANONICALFORM_H_
+#define CONFIGURATIONCANONICALFORM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+#include "StreamString.h"
+#include "StructuredDataI.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Deterministic normal form of a configuration, so that equivalent configurations (regardless of how and in which format
+ * they were written) are printed with exactly the same bytes.
+ * @details The rules are:
+ *  - the leaves of each node are written before its child nodes and are sorted by name (byte-wise);
+ *  - the child nodes keep their order, as MARTe2 instantiates the objects (and maps the signals) in the order in which they are declared;
+ *  - all the values are written as strings, so that each printer quotes all of them in the same way;
+ *  - numeric values are normalised: integers are written in decimal without sign prefix or leading zeros, and floating point numbers are
+ *    written with the shortest representation that reads back to the same float64 value (always with a '.' or an exponent);
+ *  - comments and white spaces are not preserved (they are already discarded by the parsers).
+ */
+namespace ConfigurationCanonicalForm {
+
+/**
+ * @brief Writes the subtree of the current node of \a source into the current node of \a destination (e.g. a StreamStructuredData), in canonical form.
+ * @details The source is only traversed once. On return \a source points at the same node.
+ * @return true if all the leaves could be read and written.
+ */
+bool Copy(ConfigurationDatabase &source, StructuredDataI &destination);
+
+/**
+ * @brief Checks if \a str is a decimal number ([+-]digits[.digits][(e|E)[+-]digits]).
+ * @param[out] isInteger true if the number has no fractional part nor exponent.
+ */
+bool IsDecimalNumber(const char8 * const str, bool &isInteger);
+
+/**
+ * @brief Normalises \a value if it is a decimal integer or floating point number. Any other value is not modified.
+ */
+void NormaliseNumber(StreamString &value);
+
+}
+
+}
+
+#endif /* CONFIGURATIONCANONICALFORM_H_ */
@@ -0,0 +1,218 @@
+/**
+ * @file ConfigurationConverter.cpp
+ * @brief Source file for the ConfigurationConverter functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the ConfigurationConverter functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CompressedStream.h"
+#include "ConfigurationCanonicalForm.h"
+#include "ConfigurationConverter.h"
+#include "ConfigurationStream.h"
+#include "Directory.h"
+#include "File.h"
+#include "HashFunction.h"
+#include "JsonPrinter.h"
+#include "StandardPrinter.h"
+#include "StreamStructuredData.h"
+#include "StreamStructuredDataI.h"
+#include "XMLPrinter.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Size of the write buffer of the output files.
+ */
+static const uint32 OUTPUT_BUFFER_SIZE = 65536u;
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace ConfigurationConverter {
+
+bool Print(ConfigurationDatabase &cdb, BufferedStreamI &stream, const StreamString &outputFormat, const bool canonical) {
+    bool ok = true;
+    StreamStructuredDataI *sdata = NULL_PTR(StreamStructuredDataI *);
+    if (outputFormat == "xml") {
+        sdata = new StreamStructuredData<XMLPrinter>(stream);
+    }
+    else if (outputFormat == "json") {
+        sdata = new StreamStructuredData<JsonPrinter>(stream);
+        dynamic_cast<StreamStructuredData<JsonPrinter> *>(sdata)->GetPrinter()->PrintBegin();
+    }
+    else if (outputFormat == "cdb") {
+        sdata = new StreamStructuredData<StandardPrinter>(stream);
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unknown output format specified");
+        ok = false;
+    }
+    if (ok) {
+        if (canonical) {
+            ok = ConfigurationCanonicalForm::Copy(cdb, *sdata);
+        }
+        else {
+            ok = cdb.Copy(*sdata);
+        }
+    }
+    if (ok) {
+        if (outputFormat == "json") {
+            dynamic_cast<StreamStructuredData<JsonPrinter> *>(sdata)->GetPrinter()->PrintEnd();
+        }
+    }
+    if (sdata != NULL_PTR(StreamStructuredDataI *)) {
+        delete sdata;
+    }
+    return ok;
+}
+
+/**
+ * @brief PrintToFile of an uncompressed file.
+ */
+static bool PrintToPlainFile(ConfigurationDatabase &cdb, const StreamString &outputFilename, const StreamString &outputFormat, const bool canonical, uint64 * const hash) {
+    File outputFile;
+    bool ok = outputFile.Open(outputFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", outputFilename.Buffer());
+    }
+    if (ok) {
+        //The printers write many small tokens
+        ok = outputFile.SetBufferSize(0u, OUTPUT_BUFFER_SIZE);
+    }
+    if ((ok) && (hash != NULL_PTR(uint64 *))) {
+        //The content must be hashed before being written
+        StreamString content;
+        ok = Print(cdb, content, outputFormat, canonical);
+        if (ok) {
+            *hash = HashFunction::Fnv1a(content.Buffer(), static_cast<uint32>(content.Size()));
+            uint32 writeSize = static_cast<uint32>(content.Size());
+            ok = outputFile.Write(content.Buffer(), writeSize);
+        }
+    }
+    else if (ok) {
+        ok = Print(cdb, outputFile, outputFormat, canonical);
+    }
+    else {
+        //Failed to open
+    }
+    if (ok) {
+        ok = outputFile.Flush();
+    }
+    if (outputFile.IsOpen()) {
+        if (!outputFile.Close()) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+bool PrintToFile(ConfigurationDatabase &cdb, const StreamString &outputFilename, const StreamString &outputFormat, const bool canonical, uint64 * const hash, const bool compress) {
+    Directory d(outputFilename.Buffer());
+    d.Delete();
+
+    bool ok;
+    if ((compress) || (CompressedStream::IsCompressedName(outputFilename.Buffer()))) {
+        int32 outputFd = ConfigurationStream::OpenOutput(outputFilename.Buffer());
+        ok = (outputFd >= 0);
+        if (ok) {
+            ok = PrintCompressed(cdb, outputFd, outputFormat, canonical, hash);
+            if (!ConfigurationStream::Close(outputFd)) {
+                ok = false;
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", outputFilename.Buffer());
+        }
+    }
+    else {
+        ok = PrintToPlainFile(cdb, outputFilename, outputFormat, canonical, hash);
+    }
+    return ok;
+}
+
+bool PrintCompressed(ConfigurationDatabase &cdb, const int32 outputFd, const StreamString &outputFormat, const bool canonical, uint64 * const hash) {
+    CompressedStream compressed;
+    bool ok = compressed.Open(outputFd);
+    if ((ok) && (hash != NULL_PTR(uint64 *))) {
+        //The content must be hashed before being compressed
+        StreamString content;
+        ok = Print(cdb, content, outputFormat, canonical);
+        if (ok) {
+            *hash = HashFunction::Fnv1a(content.Buffer(), static_cast<uint32>(content.Size()));
+            uint32 writeSize = static_cast<uint32>(content.Size());
+            ok = compressed.GetStream().Write(content.Buffer(), writeSize);
+        }
+    }
+    else if (ok) {
+        ok = Print(cdb, compressed.GetStream(), outputFormat, canonical);
+    }
+    else {
+        //Failed to start the compressor
+    }
+    if (!compressed.Close()) {
+        ok = false;
+    }
+    return ok;
+}
+
+bool PrintCString(ConfigurationDatabase &cdb, const StreamString &cVariableName, StreamString &text) {
+    StreamString cfgAsString;
+    StreamString output;
+    bool ok = cfgAsString.Printf("%!", cdb);
+    if (ok) {
+        cfgAsString.Seek(0LLU);
+        StreamString token;
+        char8 term;
+        while(cfgAsString.GetToken(token, "\"", term)) {
+            if (token.Size() > 0LLU) {
+                output += token;
+                if (term == '\"') {
+                    output += "\\\"";
+                }
+            }
+            token = "";
+        }
+    }
+    if (ok) {
+        output.Seek(0LLU);
+        StreamString line;
+        ok = text.Printf("const char * %s = \"\"\n", cVariableName.Buffer());
+        while(output.GetLine(line) && ok) {
+            ok = text.Printf("\"%s\\n\"\n", line.Buffer());
+            line = "";
+        }
+        if (ok) {
+            ok = text.Printf("%s", ";\n");
+        }
+    }
+    return ok;
+}
+
+}
+
+}
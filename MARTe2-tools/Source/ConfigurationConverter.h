@@ -0,0 +1,78 @@
+/**
+ * @file ConfigurationConverter.h
+ * @brief Header file for the ConfigurationConverter functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the ConfigurationConverter functions.
+ */
+
+#ifndef CONFIGURATIONCONVERTER_H_
+#define CONFIGURATIONCONVERTER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BufferedStreamI.h"
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Prints a parsed configuration in any of the supported formats (cdb, json or xml) or as a C string.
+ */
+namespace ConfigurationConverter {
+
+/**
+ * @brief Prints \a cdb (from its current node) into \a stream using the \a outputFormat (json, xml or cdb).
+ * @param[in] canonical if true the configuration is printed in its canonical form (see ConfigurationCanonicalForm).
+ */
+bool Print(ConfigurationDatabase &cdb, BufferedStreamI &stream, const StreamString &outputFormat, const bool canonical = false);
+
+/**
+ * @brief Prints \a cdb into the file \a outputFilename (which is replaced) using the \a outputFormat.
+ * @param[in] canonical see Print.
+ * @param[out] hash if not NULL, the hash of the printed content.
+ * @param[in] compress if true, or if \a outputFilename has the .gz extension, the file is gzip compressed (see PrintCompressed).
+ */
+bool PrintToFile(ConfigurationDatabase &cdb, const StreamString &outputFilename, const StreamString &outputFormat, const bool canonical = false, uint64 * const hash = NULL_PTR(uint64 *), const bool compress = false);
+
+/**
+ * @brief Prints \a cdb, gzip compressed, into the file descriptor \a outputFd (which is not closed).
+ * @details The compression runs in a CompressedStream thread, while the configuration is being printed.
+ * @param[in] canonical see Print.
+ * @param[out] hash if not NULL, the hash of the printed (uncompressed) content.
+ */
+bool PrintCompressed(ConfigurationDatabase &cdb, const int32 outputFd, const StreamString &outputFormat, const bool canonical = false, uint64 * const hash = NULL_PTR(uint64 *));
+
+/**
+ * @brief Prints \a cdb (from its root) as the C string variable \a cVariableName.
+ */
+bool PrintCString(ConfigurationDatabase &cdb, const StreamString &cVariableName, StreamString &text);
+
+}
+
+}
+
+#endif /* CONFIGURATIONCONVERTER_H_ */
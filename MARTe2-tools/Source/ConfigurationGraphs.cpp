@@ -0,0 +1,3565 @@
+/**
+ * @file ConfigurationGraphs.cpp
+ * @brief Source file for the ConfigurationGraphs classes and functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the ConfigurationGraphs classes and functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <ctype.h>
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BitSet.h"
+#include "ClassRegistryDatabase.h"
+#include "ClassRegistryItem.h"
+#include "CompressedStream.h"
+#include "ConfigurationGraphs.h"
+#include "ConfigurationHash.h"
+#include "ConfigurationStream.h"
+#include "Directory.h"
+#include "FastPollingMutexSem.h"
+#include "File.h"
+#include "Object.h"
+#include "ParallelJobRunner.h"
+#include "Reference.h"
+#include "StringHelper.h"
+#include "TypeDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Wraps the concept of a MARTe2 RealTimeState
+ */
+class GraphvizState : public ReferenceContainer {
+public:
+    CLASS_REGISTER_DECLARATION()
+    GraphvizState() : ReferenceContainer() {
+    }
+    virtual ~GraphvizState() {
+    }
+private:
+    
+};
+CLASS_REGISTER(GraphvizState, "");
+
+/**
+ * Wraps the concept of a MARTe2 RealTimeThread
+ */
+class GraphvizThread : public ReferenceContainer {
+public:
+    CLASS_REGISTER_DECLARATION()
+    GraphvizThread() : ReferenceContainer() {
+    }
+    virtual ~GraphvizThread() {
+    }
+private:
+    
+};
+CLASS_REGISTER(GraphvizThread, "");
+
+/**
+ * Wraps the concept of a MARTe2 DataSource
+ */
+class GraphvizDataSource : public Object {
+public:
+    CLASS_REGISTER_DECLARATION()
+    GraphvizDataSource() : Object() {
+        index = 0u;
+    }
+    virtual ~GraphvizDataSource() {
+    }
+
+    /**
+     * @brief Sets the index of this DataSource in the application dataSourceList (see ApplicationConnectivity).
+     */
+    void SetIndex(const uint32 indexIn) {
+        index = indexIn;
+    }
+
+    uint32 GetIndex() const {
+        return index;
+    }
+
+    void SetClassName(StreamString classNameIn) {
+        className = classNameIn;
+    }
+
+    StreamString GetClassName() const {
+        return className;
+    }
+
+private:
+    StreamString className;    
+    uint32 index;
+};
+CLASS_REGISTER(GraphvizDataSource, "");
+
+
+/**
+ * Wraps the concept of a MARTe2 Function
+ */
+class GraphvizFunction : public Object {
+public:
+    CLASS_REGISTER_DECLARATION()
+    GraphvizFunction() : Object() {
+        inputDataSources = Reference(new ReferenceContainer());
+        outputDataSources = Reference(new ReferenceContainer());
+        index = 0u;
+    }
+    virtual ~GraphvizFunction() {
+    }
+
+    /**
+     * @brief Sets the index of this function in the application functionList (see ApplicationConnectivity).
+     */
+    void SetIndex(const uint32 indexIn) {
+        index = indexIn;
+    }
+
+    uint32 GetIndex() const {
+        return index;
+    }
+
+    void SetQualifiedName(StreamString qualifiedNameIn) {
+        qualifiedName = qualifiedNameIn;
+    }
+
+    StreamString GetQualifiedName() const {
+        return qualifiedName;
+    }
+
+    void SetClassName(StreamString classNameIn) {
+        className = classNameIn;
+    }
+
+    StreamString GetClassName() const {
+        return className;
+    }
+
+    void AddInputDataSource(ReferenceT<GraphvizDataSource> dataSource) {
+        uint32 i;
+        bool found = false;
+        StreamString dataSourceToAddName = dataSource->GetName();
+        for (i=0; (i<inputDataSources->Size()) && (!found); i++) {
+            StreamString dataSourceName = inputDataSources->Get(i)->GetName();
+            found = (dataSourceToAddName == dataSourceName);
+        }
+        if (!found) {
+            inputDataSources->Insert(dataSource);
+        }
+    }
+
+    void AddOutputDataSource(ReferenceT<GraphvizDataSource> dataSource) {
+        uint32 i;
+        bool found = false;
+        StreamString dataSourceToAddName = dataSource->GetName();
+        for (i=0; (i<outputDataSources->Size()) && (!found); i++) {
+            StreamString dataSourceName = outputDataSources->Get(i)->GetName();
+            found = (dataSourceToAddName == dataSourceName);
+        }
+        if (!found) {
+            outputDataSources->Insert(dataSource);
+        }
+    }
+
+    ReferenceT<ReferenceContainer> GetInputDataSources() {
+        return inputDataSources;
+    }
+
+    ReferenceT<ReferenceContainer> GetOutputDataSources() {
+        return outputDataSources;
+    }
+
+private:
+    StreamString className;    
+    StreamString qualifiedName;    
+    ReferenceT<ReferenceContainer> inputDataSources;    
+    ReferenceT<ReferenceContainer> outputDataSources;    
+    uint32 index;
+};
+CLASS_REGISTER(GraphvizFunction, "");
+
+/**
+ * @brief Recursevily adds a MARTe2 function to the existentFunctions list, keeping the fully qualified function name (i.e. keeping the parents path)
+ * @param[out] existentFunctions list where to add the GraphvizFunction to.
+ * @param[in] threadI the RealTimeThead which executes this function.
+ * @param[in] cdb which must point at the +Functions node when it enters here the first time.
+ * @param[out] fullFunctionName the function name including all the path not separated by dots.
+ * @param[out] qualifiedFunctionName the function name including all the path separated by dots.
+ * @return true if all the movements in the ConfigurationDatabase are valid.
+ */
+static bool AddFunction(ReferenceT<ReferenceContainer> existentFunctions, ReferenceT<GraphvizThread> threadI, StreamString functionToAdd, ConfigurationDatabase cdb, StreamString fullFunctionName, StreamString qualifiedFunctionName) {
+    bool ok = cdb.MoveRelative(functionToAdd.Buffer());
+    StreamString className;
+    if (ok) {
+        ok = cdb.Read("Class", className);
+    }
+    if (ok) {
+        if (className == "ReferenceContainer") {
+            uint32 c;
+            uint32 numberOfChildren = cdb.GetNumberOfChildren();
+            StreamString recursiveFunctionName = fullFunctionName;
+            StreamString recursiveQualifiedFunctionName = qualifiedFunctionName;
+            for (c=0; c<numberOfChildren; c++) {
+                fullFunctionName = recursiveFunctionName;
+                qualifiedFunctionName = recursiveQualifiedFunctionName; 
+                StreamString nextFunctionName = cdb.GetChildName(c);
+                if (cdb.MoveRelative(nextFunctionName.Buffer())) {
+                    if(fullFunctionName.Size() > 0) {
+                        fullFunctionName.Printf(".", voidAnyType);
+                        qualifiedFunctionName.Printf(".", voidAnyType);
+                    }
+                    functionToAdd.Seek(1);
+                    fullFunctionName.Printf("%s", functionToAdd);
+                    qualifiedFunctionName.Printf("%s", functionToAdd.Buffer());
+                    //The recursion will make this move again
+                    cdb.MoveToAncestor(1);
+                    ok = AddFunction(existentFunctions, threadI, nextFunctionName, cdb, fullFunctionName, qualifiedFunctionName);
+                }
+            } 
+        }
+        else {
+            //Check if the function already exists in the existentFunctions
+            uint32 f;
+            bool found = false;
+            for (f=0; (f<existentFunctions->Size()) && (!found); f++) {
+                ReferenceT<GraphvizFunction> function = existentFunctions->Get(f);
+                found = (functionToAdd == function->GetName());
+            }
+            if (!found) {
+                ReferenceT<GraphvizFunction> function = Reference(new GraphvizFunction()); 
+                StreamString thisFunctionName = cdb.GetName();
+                thisFunctionName.Seek(1);
+                if(fullFunctionName.Size() > 0) {
+                    fullFunctionName.Printf(".", voidAnyType);
+                    qualifiedFunctionName.Printf(".", voidAnyType);
+                }
+                fullFunctionName.Printf("%s", thisFunctionName);
+                qualifiedFunctionName.Printf("%s", thisFunctionName.Buffer());
+                function->SetName(fullFunctionName.Buffer());
+                function->SetQualifiedName(qualifiedFunctionName);
+                if (ok) {
+                    function->SetClassName(className);
+                    existentFunctions->Insert(function);
+                    threadI->Insert(function);
+                } 
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Checks which data sources interact with the \a function.
+ * @param[in] cdb the ConfigurationDatabase pointing at the RealTimeApplication root.
+ * @param[in] dataSourceList list of existent DataSources
+ * @param[in] function the Functon to query.
+ * @return true if no errors are found while moving to the ConfigurationDatabase subtrees.
+ */
+static bool AddDataSourcesToFunction (ConfigurationDatabase cdb, ReferenceT<ReferenceContainer> dataSourceList, ReferenceT<GraphvizFunction> function) {
+    cdb.MoveRelative("+Functions");
+    bool ok = cdb.MoveRelative(function->GetQualifiedName().Buffer());
+    if (ok) {
+        //Extract from which DataSources this gam reads from/writes to and create as needed
+        if(cdb.MoveRelative("InputSignals")) {
+            uint32 numberOfInputSignals = cdb.GetNumberOfChildren();
+            uint32 n;
+            for (n=0; n<numberOfInputSignals; n++) {
+                StreamString signalName = cdb.GetChildName(n);
+                if (cdb.MoveRelative(signalName.Buffer())) {
+                    StreamString dataSourceName;
+                    if(cdb.Read("DataSource", dataSourceName)) {
+                        //Check if this data source already exists
+                        uint32 d;
+                        ReferenceT<GraphvizDataSource> dataSource;
+                        bool dataSourceExists = false;
+                        for (d=0; (d<dataSourceList->Size()) && (!dataSourceExists); d++) {
+                            dataSource = dataSourceList->Get(d);
+                            StreamString existentDataSourceName = &(dataSource->GetName())[1];
+                            dataSourceExists = (existentDataSourceName == dataSourceName);
+                        }
+                        if (dataSourceExists) {
+                            function->AddInputDataSource(dataSource);
+                        }
+                    }
+                    cdb.MoveToAncestor(1);
+                }
+            }
+            cdb.MoveToAncestor(1);
+        }
+        if(cdb.MoveRelative("OutputSignals")) {
+            uint32 numberOfOutputSignals = cdb.GetNumberOfChildren();
+            uint32 n;
+            for (n=0; n<numberOfOutputSignals; n++) {
+                StreamString signalName = cdb.GetChildName(n);
+                if (cdb.MoveRelative(signalName.Buffer())) {
+                    StreamString dataSourceName;
+                    if(cdb.Read("DataSource", dataSourceName)) {
+                        //Check if this data source already exists
+                        bool dataSourceExists = false;
+                        ReferenceT<GraphvizDataSource> dataSource;
+                        uint32 d;
+                        for (d=0; (d<dataSourceList->Size()) && (!dataSourceExists); d++) {
+                            dataSource = dataSourceList->Get(d);
+                            StreamString existentDataSourceName = &(dataSource->GetName())[1];
+                            dataSourceExists = (existentDataSourceName == dataSourceName);
+                        } 
+                        if (dataSourceExists) {
+                            function->AddOutputDataSource(dataSource);
+                        }
+                    }
+                    cdb.MoveToAncestor(1);
+                }
+            }
+            cdb.MoveToAncestor(1);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Names and content hashes of the children of a ConfigurationDatabase node.
+ * @details Used by the watch mode to find which parts of a configuration changed between two versions of the same file.
+ */
+class ConfigurationSnapshot {
+public:
+    ConfigurationSnapshot() {
+        names = NULL_PTR(StreamString *);
+        hashes = NULL_PTR(uint64 *);
+        numberOfNodes = 0u;
+    }
+
+    ~ConfigurationSnapshot() {
+        Clear();
+    }
+
+    /**
+     * @brief Hashes all the children of the current node of \a cdb.
+     */
+    bool Take(ConfigurationDatabase cdb) {
+        Clear();
+        numberOfNodes = cdb.GetNumberOfChildren();
+        names = new StreamString[numberOfNodes];
+        hashes = new uint64[numberOfNodes];
+        bool ok = true;
+        uint32 i;
+        for (i=0; (i<numberOfNodes) && (ok); i++) {
+            names[i] = cdb.GetChildName(i);
+            hashes[i] = 0u;
+            if (cdb.MoveToChild(i)) {
+                ok = ConfigurationHash::Compute(cdb, hashes[i]);
+                if (ok) {
+                    ok = cdb.MoveToAncestor(1u);
+                }
+            }
+            else {
+                hashes[i] = ConfigurationHash::ComputeLeaf(cdb, names[i].Buffer());
+            }
+        }
+        return ok;
+    }
+
+    uint32 GetNumberOfNodes() const {
+        return numberOfNodes;
+    }
+
+    const char8 *GetNodeName(uint32 idx) const {
+        return names[idx].Buffer();
+    }
+
+    /**
+     * @brief Returns true if \a other has exactly the same children names, in the same order.
+     */
+    bool HasSameNodes(const ConfigurationSnapshot &other) const {
+        bool same = (numberOfNodes == other.numberOfNodes);
+        uint32 i;
+        for (i=0; (i<numberOfNodes) && (same); i++) {
+            same = (names[i] == other.names[i].Buffer());
+        }
+        return same;
+    }
+
+    /**
+     * @brief Returns true if the node \a name does not exist in both snapshots or if its content is different.
+     */
+    bool NodeChanged(const char8 * const name, const ConfigurationSnapshot &previous) const {
+        uint32 idx = Find(name);
+        uint32 previousIdx = previous.Find(name);
+        bool changed = ((idx == numberOfNodes) || (previousIdx == previous.numberOfNodes));
+        if (!changed) {
+            changed = (hashes[idx] != previous.hashes[previousIdx]);
+        }
+        return changed;
+    }
+
+    /**
+     * @brief Returns true if any node, other than \a ignoredNode, was added, removed or changed with respect to \a previous.
+     */
+    bool Changed(const ConfigurationSnapshot &previous, const char8 * const ignoredNode = NULL_PTR(const char8 *)) const {
+        bool changed = !HasSameNodes(previous);
+        uint32 i;
+        for (i=0; (i<numberOfNodes) && (!changed); i++) {
+            bool ignore = false;
+            if (ignoredNode != NULL_PTR(const char8 *)) {
+                ignore = (names[i] == ignoredNode);
+            }
+            if (!ignore) {
+                changed = (hashes[i] != previous.hashes[i]);
+            }
+        }
+        return changed;
+    }
+
+    /**
+     * @brief Exchanges the content of the two snapshots.
+     */
+    void Swap(ConfigurationSnapshot &other) {
+        StreamString *tmpNames = names;
+        uint64 *tmpHashes = hashes;
+        uint32 tmpNumberOfNodes = numberOfNodes;
+        names = other.names;
+        hashes = other.hashes;
+        numberOfNodes = other.numberOfNodes;
+        other.names = tmpNames;
+        other.hashes = tmpHashes;
+        other.numberOfNodes = tmpNumberOfNodes;
+    }
+
+private:
+    uint32 Find(const char8 * const name) const {
+        uint32 idx = numberOfNodes;
+        uint32 i;
+        for (i=0; (i<numberOfNodes) && (idx == numberOfNodes); i++) {
+            if (names[i] == name) {
+                idx = i;
+            }
+        }
+        return idx;
+    }
+
+    void Clear() {
+        if (names != NULL_PTR(StreamString *)) {
+            delete [] names;
+        }
+        if (hashes != NULL_PTR(uint64 *)) {
+            delete [] hashes;
+        }
+        names = NULL_PTR(StreamString *);
+        hashes = NULL_PTR(uint64 *);
+        numberOfNodes = 0u;
+    }
+
+    StreamString *names;
+    uint64 *hashes;
+    uint32 numberOfNodes;
+};
+
+/**
+ * Wraps the concept of a MARTe2 RealTimeApplication and the model (states, functions and data sources) built from it.
+ */
+class GraphvizApplication : public Object {
+public:
+    CLASS_REGISTER_DECLARATION()
+    GraphvizApplication() : Object() {
+        stateList = Reference(new ReferenceContainer());
+        functionList = Reference(new ReferenceContainer());
+        dataSourceList = Reference(new ReferenceContainer());
+    }
+    virtual ~GraphvizApplication() {
+    }
+
+    void SetOutputFilenamePrefix(StreamString outputFilenamePrefixIn) {
+        outputFilenamePrefix = outputFilenamePrefixIn;
+    }
+
+    StreamString GetOutputFilenamePrefix() const {
+        return outputFilenamePrefix;
+    }
+
+    void SetConfiguration(ConfigurationDatabase cdbIn) {
+        cdb = cdbIn;
+    }
+
+    ConfigurationDatabase GetConfiguration() const {
+        return cdb;
+    }
+
+    ReferenceT<ReferenceContainer> GetStates() {
+        return stateList;
+    }
+
+    ReferenceT<ReferenceContainer> GetFunctions() {
+        return functionList;
+    }
+
+    ReferenceT<ReferenceContainer> GetDataSources() {
+        return dataSourceList;
+    }
+
+    /**
+     * @brief Hashes of the application nodes (e.g. +Functions, +Data and +States). Only used by the watch mode.
+     */
+    ConfigurationSnapshot &GetSnapshot() {
+        return snapshot;
+    }
+
+    /**
+     * @brief Hashes of each of the application states. Only used by the watch mode.
+     */
+    ConfigurationSnapshot &GetStatesSnapshot() {
+        return statesSnapshot;
+    }
+
+    /**
+     * @brief Updates the snapshots from the application configuration.
+     */
+    bool TakeSnapshots() {
+        ConfigurationDatabase cdbStates = cdb;
+        bool ok = snapshot.Take(cdb);
+        if (ok) {
+            ok = cdbStates.MoveRelative("+States");
+        }
+        if (ok) {
+            ok = statesSnapshot.Take(cdbStates);
+        }
+        return ok;
+    }
+
+private:
+    StreamString outputFilenamePrefix;
+    ConfigurationDatabase cdb;
+    ConfigurationSnapshot snapshot;
+    ConfigurationSnapshot statesSnapshot;
+    ReferenceT<ReferenceContainer> stateList;
+    ReferenceT<ReferenceContainer> functionList;
+    ReferenceT<ReferenceContainer> dataSourceList;
+};
+CLASS_REGISTER(GraphvizApplication, "");
+
+/**
+ * @brief Adds to \a applicationList one GraphvizApplication for each root node whose Class is RealTimeApplication.
+ * @details If there is more than one application the output files of each application are prefixed with the application name.
+ */
+static bool FindRealTimeApplications(ConfigurationDatabase cdb, StreamString outputFilenamePrefix, ReferenceT<ReferenceContainer> applicationList) {
+    bool ok = cdb.MoveToRoot();
+    uint32 i;
+    uint32 numberOfNodesAfterRoot = cdb.GetNumberOfChildren();
+    for (i=0; (i<numberOfNodesAfterRoot) && (ok); i++) {
+        ok = cdb.MoveToChild(i);
+        StreamString className;
+        if (ok) {
+            if (!cdb.Read("Class", className)) {
+                className = "";
+            }
+            if (className == "RealTimeApplication") {
+                ReferenceT<GraphvizApplication> application = Reference(new GraphvizApplication());
+                StreamString applicationName = cdb.GetName();
+                if ((applicationName[0] == '$') || (applicationName[0] == '+')) {
+                    applicationName = &(applicationName.Buffer()[1]);
+                }
+                application->SetName(applicationName.Buffer());
+                application->SetConfiguration(cdb);
+                applicationList->Insert(application);
+            }
+            ok = cdb.MoveToAncestor(1);
+        }
+    }
+    if (ok) {
+        ok = (applicationList->Size() > 0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not find the RealTimeApplication\n");
+        }
+    }
+    uint32 a;
+    for (a=0; (a<applicationList->Size()) && (ok); a++) {
+        ReferenceT<GraphvizApplication> application = applicationList->Get(a);
+        StreamString applicationPrefix = outputFilenamePrefix;
+        if (applicationList->Size() > 1u) {
+            applicationPrefix.Printf("%s_", application->GetName());
+        }
+        application->SetOutputFilenamePrefix(applicationPrefix);
+    }
+    return ok;
+}
+
+/**
+ * @brief Adds (and links) all the states of the RealTimeApplication to stateList, the functions to functionList and the data sources to the dataSourceList.
+ * @param[in] cdb the ConfigurationDatabase pointing at the RealTimeApplication root.
+ */
+static bool BuildApplicationModel(ConfigurationDatabase cdb, ReferenceT<ReferenceContainer> stateList, ReferenceT<ReferenceContainer> functionList, ReferenceT<ReferenceContainer> dataSourceList) {
+    bool ok = true;
+    ConfigurationDatabase cdbRTApp;
+    //Load all the GAMs
+    if (ok) {
+        cdbRTApp = cdb;
+        //Move to the states
+        ok = cdb.MoveRelative("+States");
+        uint32 numberOfStates = cdb.GetNumberOfChildren();
+        
+        //For each state get the number of threads
+        uint32 s;
+        for (s=0; (s<numberOfStates) && (ok); s++) {
+            StreamString stateName = cdb.GetChildName(s);
+            ConfigurationDatabase cdbState = cdb;
+            if (cdb.MoveRelative(stateName.Buffer())) {
+                ReferenceT<GraphvizState> state = Reference(new GraphvizState());
+                state->SetName(&(stateName.Buffer()[1]));
+                stateList->Insert(state);
+                uint32 t;
+                uint32 numberOfThreads;
+                if (ok) {
+                    ok = cdb.MoveRelative("+Threads");
+                }
+                if (ok) {
+                    numberOfThreads = cdb.GetNumberOfChildren();
+                }
+                ConfigurationDatabase cdbThread = cdb;
+                for (t=0; (t<numberOfThreads) && (ok); t++) {
+                    StreamString threadName = cdb.GetChildName(t);
+                    if(cdb.MoveRelative(threadName.Buffer())) { 
+                        ReferenceT<GraphvizThread> threadI = Reference(new GraphvizThread()); 
+                        threadI->SetName(&(threadName.Buffer()[1]));
+                        state->Insert(threadI);
+                        //Read all the GAMs that are executed by this thread
+                        AnyType functionsType = cdb.GetType("Functions");
+                        ok = !functionsType.IsVoid();
+                        if (ok) {
+                            ok = (functionsType.GetNumberOfDimensions() == 1u);
+                            uint32 numberOfFunctions = functionsType.GetNumberOfElements(0u);
+                            Vector<StreamString> functions(numberOfFunctions);
+                            if (ok) {
+                                ok = cdb.Read("Functions", functions);
+                            }
+                            uint32 f;
+                            for (f=0; (f<numberOfFunctions) && (ok); f++) {
+                                //Find the class name
+                                cdb = cdbRTApp;
+                                cdb.MoveRelative("+Functions");
+                                StreamString functionName;
+                                functionName.Printf("+%s", functions[f].Buffer());
+                                ok = AddFunction(functionList, threadI, functionName.Buffer(), cdb, "", "");
+                            }
+                        }
+                    }
+                    cdb = cdbThread;
+                }
+            } 
+            cdb = cdbState;
+        }
+    }
+    //Create all the data sources
+    cdb = cdbRTApp;
+    ok = cdb.MoveRelative("+Data"); 
+    uint32 c;
+    for (c=0; (c<cdb.GetNumberOfChildren()) && (ok); c++) {
+        StreamString dataSourceName = cdb.GetChildName(c);
+        if (cdb.MoveRelative(dataSourceName.Buffer())) {
+            ReferenceT<GraphvizDataSource> dataSource = Reference(new GraphvizDataSource());
+            StreamString className;
+            if (ok) {
+                ok = cdb.Read("Class", className);
+            }
+            dataSource->SetName(dataSourceName.Buffer());
+            dataSource->SetClassName(className.Buffer());
+            dataSourceList->Insert(dataSource);
+            cdb.MoveToAncestor(1);
+        }
+    }
+    //Link the data sources to the functions
+    uint32 f; 
+    for (f=0; (f<functionList->Size()) && (ok); f++) {
+        ReferenceT<GraphvizFunction> function = functionList->Get(f);
+        ok = AddDataSourcesToFunction(cdbRTApp, dataSourceList, function);
+    }
+    
+    return ok; 
+}
+
+/**
+ * @brief Dense model of which functions read from and write to which DataSources, and of which functions are executed by each state and thread.
+ * @details The functions and the DataSources are identified by their index in the application functionList and dataSourceList, so
+ * that the connectivity questions (e.g. the DataSources used by a state, or shared by two states) are answered with word-parallel
+ * set operations and each DataSource is only found once.
+ */
+class ApplicationConnectivity {
+public:
+    ApplicationConnectivity() {
+        reads = NULL_PTR(BitSet *);
+        writes = NULL_PTR(BitSet *);
+        stateFunctions = NULL_PTR(BitSet *);
+        threadFunctions = NULL_PTR(BitSet *);
+        firstThread = NULL_PTR(uint32 *);
+        numberOfFunctions = 0u;
+        numberOfDataSources = 0u;
+        numberOfStates = 0u;
+    }
+
+    ~ApplicationConnectivity() {
+        delete [] reads;
+        delete [] writes;
+        delete [] stateFunctions;
+        delete [] threadFunctions;
+        delete [] firstThread;
+    }
+
+    /**
+     * @brief Builds the model from the lists filled by BuildApplicationModel. Sets the index of each function and DataSource.
+     */
+    bool Build(ReferenceT<ReferenceContainer> stateList, ReferenceT<ReferenceContainer> functionList, ReferenceT<ReferenceContainer> dataSourceList) {
+        numberOfFunctions = functionList->Size();
+        numberOfDataSources = dataSourceList->Size();
+        numberOfStates = stateList->Size();
+        bool ok = true;
+        uint32 d;
+        for (d=0; (d<numberOfDataSources) && (ok); d++) {
+            ReferenceT<GraphvizDataSource> dataSource = dataSourceList->Get(d);
+            ok = dataSource.IsValid();
+            if (ok) {
+                dataSource->SetIndex(d);
+            }
+        }
+        reads = new BitSet[numberOfFunctions];
+        writes = new BitSet[numberOfFunctions];
+        uint32 f;
+        for (f=0; (f<numberOfFunctions) && (ok); f++) {
+            ReferenceT<GraphvizFunction> function = functionList->Get(f);
+            ok = function.IsValid();
+            if (ok) {
+                function->SetIndex(f);
+                reads[f].SetSize(numberOfDataSources);
+                writes[f].SetSize(numberOfDataSources);
+                ReferenceT<ReferenceContainer> inputs = function->GetInputDataSources();
+                ReferenceT<ReferenceContainer> outputs = function->GetOutputDataSources();
+                uint32 i;
+                for (i=0; i<inputs->Size(); i++) {
+                    ReferenceT<GraphvizDataSource> dataSource = inputs->Get(i);
+                    reads[f].Set(dataSource->GetIndex());
+                }
+                for (i=0; i<outputs->Size(); i++) {
+                    ReferenceT<GraphvizDataSource> dataSource = outputs->Get(i);
+                    writes[f].Set(dataSource->GetIndex());
+                }
+            }
+        }
+        //The threads of all the states are stored contiguously, starting at firstThread[s]
+        firstThread = new uint32[numberOfStates + 1u];
+        uint32 s;
+        uint32 numberOfThreads = 0u;
+        for (s=0; (s<numberOfStates) && (ok); s++) {
+            ReferenceT<GraphvizState> state = stateList->Get(s);
+            ok = state.IsValid();
+            firstThread[s] = numberOfThreads;
+            if (ok) {
+                numberOfThreads += state->Size();
+            }
+        }
+        firstThread[numberOfStates] = numberOfThreads;
+        stateFunctions = new BitSet[numberOfStates];
+        threadFunctions = new BitSet[numberOfThreads];
+        for (s=0; (s<numberOfStates) && (ok); s++) {
+            ReferenceT<GraphvizState> state = stateList->Get(s);
+            stateFunctions[s].SetSize(numberOfFunctions);
+            uint32 t;
+            for (t=0; (t<state->Size()) && (ok); t++) {
+                ReferenceT<GraphvizThread> threadI = state->Get(t);
+                ok = threadI.IsValid();
+                BitSet &members = threadFunctions[firstThread[s] + t];
+                members.SetSize(numberOfFunctions);
+                for (f=0; (f<threadI->Size()) && (ok); f++) {
+                    ReferenceT<GraphvizFunction> function = threadI->Get(f);
+                    ok = function.IsValid();
+                    if (ok) {
+                        members.Set(function->GetIndex());
+                    }
+                }
+                stateFunctions[s].Or(members);
+            }
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Gets the DataSources read by the function with index \a functionIndex.
+     */
+    const BitSet &GetReads(const uint32 functionIndex) const {
+        return reads[functionIndex];
+    }
+
+    /**
+     * @brief Gets the DataSources written by the function with index \a functionIndex.
+     */
+    const BitSet &GetWrites(const uint32 functionIndex) const {
+        return writes[functionIndex];
+    }
+
+    /**
+     * @brief Gets the functions executed by the state with index \a stateIndex.
+     */
+    const BitSet &GetStateFunctions(const uint32 stateIndex) const {
+        return stateFunctions[stateIndex];
+    }
+
+    /**
+     * @brief Gets the functions executed by the thread \a threadIndex of the state with index \a stateIndex.
+     */
+    const BitSet &GetThreadFunctions(const uint32 stateIndex, const uint32 threadIndex) const {
+        return threadFunctions[firstThread[stateIndex] + threadIndex];
+    }
+
+    /**
+     * @brief Gets the DataSources read or written by any function of the state with index \a stateIndex.
+     */
+    void GetStateDataSources(const uint32 stateIndex, BitSet &dataSources) const {
+        dataSources.SetSize(numberOfDataSources);
+        uint32 f = 0u;
+        while (stateFunctions[stateIndex].Next(f)) {
+            dataSources.Or(reads[f]);
+            dataSources.Or(writes[f]);
+            f++;
+        }
+    }
+
+    /**
+     * @brief Gets the DataSources which are used by both states \a stateIndex1 and \a stateIndex2.
+     */
+    void GetSharedDataSources(const uint32 stateIndex1, const uint32 stateIndex2, BitSet &dataSources) const {
+        BitSet other;
+        GetStateDataSources(stateIndex1, dataSources);
+        GetStateDataSources(stateIndex2, other);
+        dataSources.And(other);
+    }
+
+    /**
+     * @brief Gets the DataSources which are never used by the state \a stateIndex.
+     */
+    void GetUnusedDataSources(const uint32 stateIndex, BitSet &dataSources) const {
+        GetStateDataSources(stateIndex, dataSources);
+        dataSources.Invert();
+    }
+
+    /**
+     * @brief Gets the DataSources which are used by more than one state.
+     */
+    void GetDataSourcesUsedByManyStates(BitSet &dataSources) const {
+        BitSet usedBefore(numberOfDataSources);
+        BitSet used;
+        dataSources.SetSize(numberOfDataSources);
+        uint32 s;
+        for (s=0; s<numberOfStates; s++) {
+            GetStateDataSources(s, used);
+            BitSet usedAgain = used;
+            usedAgain.And(usedBefore);
+            dataSources.Or(usedAgain);
+            usedBefore.Or(used);
+        }
+    }
+
+private:
+    BitSet *reads;
+    BitSet *writes;
+    BitSet *stateFunctions;
+    BitSet *threadFunctions;
+    uint32 *firstThread;
+    uint32 numberOfFunctions;
+    uint32 numberOfDataSources;
+    uint32 numberOfStates;
+};
+
+/**
+ * @brief Creates a list with the elements of \a list whose index is set in \a selection (in the \a list order).
+ */
+static ReferenceT<ReferenceContainer> SelectFromList(ReferenceT<ReferenceContainer> list, const BitSet &selection) {
+    ReferenceT<ReferenceContainer> selected = Reference(new ReferenceContainer());
+    uint32 i = 0u;
+    while (selection.Next(i)) {
+        selected->Insert(list->Get(i));
+        i++;
+    }
+    return selected;
+}
+
+/**
+ * @brief Gets the value of the string leaf \a leafName of the current node, without copying it.
+ * @return the string stored in the ConfigurationDatabase or NULL if the leaf does not exist or is not a string.
+ */
+static const char8 *GetStringLeaf(ConfigurationDatabase &cdb, const char8 * const leafName) {
+    const char8 *value = NULL_PTR(const char8 *);
+    AnyType leaf = cdb.GetType(leafName);
+    if (!leaf.IsVoid()) {
+        if (leaf.GetNumberOfDimensions() == 0u) {
+            TypeDescriptor td = leaf.GetTypeDescriptor();
+            if (td.type == CCString) {
+                value = static_cast<const char8 *>(leaf.GetDataPointer());
+            }
+            else if (td.type == SString) {
+                value = static_cast<StreamString *>(leaf.GetDataPointer())->Buffer();
+            }
+            else {
+                //Not a string
+            }
+        }
+    }
+    return value;
+}
+
+/**
+ * @brief Gets the name of the current node without the leading + or $.
+ */
+static const char8 *GetNodeName(ConfigurationDatabase &cdb) {
+    const char8 *name = cdb.GetName();
+    if (name != NULL_PTR(const char8 *)) {
+        if ((name[0] == '+') || (name[0] == '$')) {
+            name = &name[1];
+        }
+    }
+    return name;
+}
+
+//The default font size of all the nodes. Each style may be changed with an external style configuration file (see LoadGraphvizStyles).
+#define GRAPHVIZ_FONT_SIZE 12
+
+/**
+ * @brief The Graphviz node attributes shared by all the nodes of a given kind (function, data source, object or state).
+ * @details The attributes are printed once, as node defaults, for each graph/subgraph, so that each node only has to print its label.
+ */
+class GraphvizNodeStyle {
+public:
+    GraphvizNodeStyle(const char8 * const shapeIn, const char8 * const styleIn, const char8 * const fillColorIn, const char8 * const colorIn) {
+        shape = shapeIn;
+        style = styleIn;
+        fillColor = fillColorIn;
+        color = colorIn;
+        fontSize = GRAPHVIZ_FONT_SIZE;
+    }
+
+    /**
+     * @brief Reads the optional Shape, Style, FillColor, Color and FontSize leafs from the node \a kind of \a cdb.
+     * @details The strings are not copied, i.e. \a cdb must outlive this style.
+     * @return false if the node exists but the FontSize is not valid.
+     */
+    bool Load(ConfigurationDatabase &cdb, const char8 * const kind) {
+        bool ok = true;
+        if (cdb.MoveRelative(kind)) {
+            const char8 *value = GetStringLeaf(cdb, "Shape");
+            if (value != NULL_PTR(const char8 *)) {
+                shape = value;
+            }
+            value = GetStringLeaf(cdb, "Style");
+            if (value != NULL_PTR(const char8 *)) {
+                style = value;
+            }
+            value = GetStringLeaf(cdb, "FillColor");
+            if (value != NULL_PTR(const char8 *)) {
+                fillColor = value;
+            }
+            value = GetStringLeaf(cdb, "Color");
+            if (value != NULL_PTR(const char8 *)) {
+                color = value;
+            }
+            if (!cdb.GetType("FontSize").IsVoid()) {
+                ok = cdb.Read("FontSize", fontSize);
+            }
+            (void) cdb.MoveToAncestor(1u);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Prints the node defaults statement.
+     */
+    bool PrintDefaults(BufferedStreamI &graph) const {
+        bool ok = graph.Printf("%s", "node [");
+        if (StringHelper::Length(shape) > 0u) {
+            ok &= graph.Printf("shape=%s, ", shape);
+        }
+        ok &= graph.Printf("style=\"%s\", fillcolor=\"%s\", color=\"%s\", fontsize=%d]\n", style, fillColor, color, fontSize);
+        return ok;
+    }
+
+    /**
+     * @brief Opens an anonymous subgraph (which does not change the layout) and prints the node defaults in it.
+     */
+    bool PrintOpenBlock(BufferedStreamI &graph) const {
+        bool ok = graph.Printf("%s", "{\n");
+        ok &= PrintDefaults(graph);
+        return ok;
+    }
+
+    uint32 GetFontSize() const {
+        return fontSize;
+    }
+
+private:
+    const char8 *shape;
+    const char8 *style;
+    const char8 *fillColor;
+    const char8 *color;
+    uint32 fontSize;
+};
+
+static GraphvizNodeStyle functionStyle("record", "filled", "white", "blue");
+static GraphvizNodeStyle dataSourceStyle("record", "filled", "white", "darkgreen");
+static GraphvizNodeStyle objectStyle("record", "filled", "white", "black");
+static GraphvizNodeStyle stateStyle("", "filled", "white", "red");
+
+/**
+ * Protects the styles: they are only loaded when no export is reading them (numberOfStyleReaders is zero).
+ */
+static FastPollingMutexSem stylesMux;
+static uint32 numberOfStyleReaders = 0u;
+
+/**
+ * @brief Registers an export, so that the styles cannot be loaded until EndStylesRead is called.
+ */
+static void BeginStylesRead() {
+    (void) stylesMux.FastLock();
+    numberOfStyleReaders++;
+    stylesMux.FastUnLock();
+}
+
+/**
+ * @brief Unregisters an export registered with BeginStylesRead.
+ */
+static void EndStylesRead() {
+    (void) stylesMux.FastLock();
+    numberOfStyleReaders--;
+    stylesMux.FastUnLock();
+}
+
+/**
+ * @brief Prints the label of a node with a name and a class (functions, data sources and objects). The other attributes are the node defaults.
+ */
+static void GraphvizNodeLabel(BufferedStreamI &graph, const char8 *const name, const char8 *const className) {
+    graph.Printf("[label=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\">%s <BR/>(%s)</TD></TR></TABLE>>]", name, className);
+}
+
+static void GraphvizStateLabel(BufferedStreamI &graph, const char8 *const stateName, uint32 numberOfEnterActions, const char8* const actionList) {
+    if (numberOfEnterActions == 0) {
+        graph.Printf("[label=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\">%s</TD></TR></TABLE>>]", stateName);
+    }
+    else {
+        graph.Printf("[label=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\">%s</TD></TR><TR><TD> / ENTER </TD></TR><TR><TD>%s</TD></TR></TABLE>>]", stateName, actionList);
+    }
+}
+
+static void GraphvizObjectSummaryLabel(BufferedStreamI &graph, const char8 *const objName, const char8 *const className, uint32 numberOfObjects) {
+    graph.Printf("[style=\"filled,dashed\", label=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\">%s <BR/>(%s)</TD></TR><TR><TD>[+%d objects]</TD></TR></TABLE>>]", objName, className, numberOfObjects);
+}
+
+static void GraphvizObjectGroupLabel(BufferedStreamI &graph, const char8 *const className, uint32 numberOfObjects) {
+    graph.Printf("[style=\"filled,dashed\", label=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\">%d x <BR/>(%s)</TD></TR></TABLE>>]", numberOfObjects, className);
+}
+
+/**
+ * @brief Lists in Graphviz format all the functions that belong to a given state in the configuration file.
+ */
+static bool ListFunctionsGraph(BufferedStreamI &graph, ReferenceT<GraphvizState> state) {
+    uint32 t;
+    bool ok = state.IsValid();
+    if (ok) {
+        ok = functionStyle.PrintOpenBlock(graph);
+    }
+    for (t=0; (t<state->Size()) && (ok); t++) {
+        ReferenceT<GraphvizThread> threadI = state->Get(t);
+        uint32 f;
+        ok = threadI.IsValid(); 
+        for (f=0; (f<threadI->Size()) && (ok); f++) {
+            ReferenceT<GraphvizFunction> function = threadI->Get(f);
+            StreamString stateName = state->GetName();
+            StreamString threadName = threadI->GetName();
+            StreamString uniqueFunctionName;
+            uniqueFunctionName.Printf("\"%s.%s.%s\"", stateName.Buffer(), threadName.Buffer(), function->GetName());
+            ok = graph.Printf("%s ", uniqueFunctionName.Buffer());
+            GraphvizNodeLabel(graph, function->GetName(), function->GetClassName().Buffer());
+            ok &= graph.Printf("\n", voidAnyType);
+        }
+    }
+    if (ok) {
+        ok = graph.Printf("%s", "}\n");
+    }
+    return ok;
+}
+
+/**
+ * @brief Creates a Graphviz cluster with all the states, threads and functions with-in.
+ */
+static bool CreateStateClusterGraph(BufferedStreamI &graph, ReferenceT<GraphvizState> state) {
+    bool ok = graph.Printf("subgraph cluster_%s {\n", state->GetName());
+    if (ok) {
+        ok = graph.Printf("label = \"State: %s\"\n", state->GetName());
+    }
+    if (ok) {
+        ok = state.IsValid();
+    }
+    uint32 t;
+    for (t=0; (t<state->Size()) && (ok); t++) {
+        ReferenceT<GraphvizThread> threadI = state->Get(t);
+        ok = graph.Printf("subgraph cluster_%s_%s {\n", state->GetName(), threadI->GetName());
+        ok &= graph.Printf("label = \"Thread: %s\"\n", threadI->GetName());
+        ok &= graph.Printf("color= \"%s\"\n", "red");
+        StreamString executionList;
+        uint32 f; 
+        for (f=0; (f<threadI->Size()) && (ok); f++) {
+            ReferenceT<GraphvizFunction> function = threadI->Get(f);
+            ok = function.IsValid();
+            if (ok) {
+                StreamString stateName = state->GetName();
+                StreamString threadName = threadI->GetName();
+                StreamString uniqueFunctionName;
+                ok = uniqueFunctionName.Printf("\"%s.%s.%s\"", stateName.Buffer(), threadName.Buffer(), function->GetName());
+                if(executionList.Size() != 0) {
+                    ok &= executionList.Printf("->", voidAnyType);
+                }
+                ok &= executionList.Printf("%s", uniqueFunctionName.Buffer());
+            }
+        }
+        ok &= graph.Printf("%s\n", executionList.Buffer());
+        ok &= graph.Printf("%s", "}\n");
+    }
+    if (ok) {
+        ok = graph.Printf("%s", "}\n");
+    }
+    return ok;
+}
+
+/**
+ * @brief Lists in Graphviz format all the data sources from the configuration file.
+ */
+static bool ListDataSourcesGraph(BufferedStreamI &graph, ReferenceT<ReferenceContainer> dataSourceList) {
+    //Create the dataSource clusters
+    bool ok = dataSourceStyle.PrintOpenBlock(graph);
+    uint32 s;
+    for (s=0; (s<dataSourceList->Size()) && (ok); s++) {
+        ReferenceT<GraphvizDataSource> dataSource = dataSourceList->Get(s);
+        ok = dataSource.IsValid();
+        ok &= graph.Printf("\"%s\" ", dataSource->GetName());
+        GraphvizNodeLabel(graph, dataSource->GetName(), dataSource->GetClassName().Buffer());
+        ok &= graph.Printf("\n", voidAnyType);
+    }
+    if (ok) {
+        ok = graph.Printf("%s", "}\n");
+    }
+    return ok;
+}
+
+/**
+ * @brief Exports all the states, threads with-in states and functions in a graph named %sRTApp.gv (outputFilenamePrefix.Buffer())
+ */
+static bool ExportRTAppGraph(GraphOutput &output, StreamString outputFilenamePrefix, ReferenceT<ReferenceContainer> stateList, ReferenceT<ReferenceContainer> functionList, ReferenceT<ReferenceContainer> dataSourceList) {
+    StreamString outputFilename;
+    outputFilename.Printf("%sRTApp.gv", outputFilenamePrefix.Buffer());
+    StreamString graph;
+    bool ok = true;
+    if (ok) {
+        graph.Printf("%s", "digraph G {\n");
+        graph.Printf("%s", "rankdir=LR\n");
+        graph.Printf("%s", "concentrate=true\n");
+    }
+   
+    //List all the functions
+    uint32 s; 
+    for (s=0; (s<stateList->Size()) && (ok); s++) {
+        ReferenceT<GraphvizState> state = stateList->Get(s);
+        ok = ListFunctionsGraph(graph, state); 
+    }
+    //Create the state/thread clusters
+    for (s=0; (s<stateList->Size()) && (ok); s++) {
+        ReferenceT<GraphvizState> state = stateList->Get(s);
+        ok = CreateStateClusterGraph(graph, state);
+    }
+    if (ok) {
+        ok = graph.Printf("subgraph cluster_DataSources {\n", voidAnyType);
+        ok &= graph.Printf("label = \"Data Sources\"\n", voidAnyType);
+        ok &= ListDataSourcesGraph(graph, dataSourceList);
+        ok &= graph.Printf("%s", "}\n");
+    }
+    if (ok) {
+        graph.Printf("%s", "}\n");
+    }
+    if (ok) {
+        ok = output.Write(outputFilename.Buffer(), graph);
+    }
+    return ok;
+}
+
+/**
+ * @brief For a given state, connects the functions of this state to the respective data sources.
+ * @details The edges are written to \a edges, so that the data sources can be declared (with their node defaults) before being used.
+ */
+static bool ConnectFunctionsToDataSources (StreamString &edges, ReferenceT<GraphvizState> state, ReferenceT<ReferenceContainer> dataSourceList, const ApplicationConnectivity &connectivity) {
+    bool ok = true;
+    uint32 t; 
+    for (t=0; (t<state->Size()) && (ok); t++) {
+        ReferenceT<GraphvizThread> threadI = state->Get(t);
+        ok = threadI.IsValid();
+        uint32 f;
+        for (f=0; (f<threadI->Size()) && (ok); f++) {
+            ReferenceT<GraphvizFunction> function = threadI->Get(f);
+            StreamString stateName = state->GetName();
+            StreamString threadName = threadI->GetName();
+            StreamString uniqueFunctionName;
+            uniqueFunctionName.Printf("\"%s.%s.%s\"", stateName.Buffer(), threadName.Buffer(), function->GetName());
+            uint32 d = 0u;
+            while (connectivity.GetReads(function->GetIndex()).Next(d)) {
+                edges.Printf("\"%s\"->%s\n", dataSourceList->Get(d)->GetName(), uniqueFunctionName.Buffer());
+                d++;
+            }
+            d = 0u;
+            while (connectivity.GetWrites(function->GetIndex()).Next(d)) {
+                edges.Printf("%s->\"%s\"\n", uniqueFunctionName.Buffer(), dataSourceList->Get(d)->GetName());
+                d++;
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Creates the graph %sState%s.gv (outputFilenamePrefix.Buffer(), state->GetName()) and adds the connections between the functions belonging to this state and the data sources.
+ */
+static bool ExportRTStateGraph(GraphOutput &output, StreamString outputFilenamePrefix, ReferenceT<GraphvizState> state, const uint32 stateIndex, ReferenceT<ReferenceContainer> dataSourceList, const ApplicationConnectivity &connectivity) {
+    bool ok = state.IsValid();
+    StreamString outputFilename;
+    if (ok) {
+        outputFilename.Printf("%sState%s.gv", outputFilenamePrefix.Buffer(), state->GetName());
+    }
+    StreamString graph;
+    if (ok) {
+        graph.Printf("%s", "digraph G {\n");
+        graph.Printf("%s", "rankdir=LR\n");
+        graph.Printf("%s", "concentrate=true\n");
+    }
+    if (ok) {
+        ok = ListFunctionsGraph(graph, state); 
+    }
+    if (ok) {
+        ok = CreateStateClusterGraph(graph, state);
+    }
+    StreamString edges;
+    if (ok) {
+        ok = ConnectFunctionsToDataSources(edges, state, dataSourceList, connectivity);
+    }
+    if (ok) {
+        //Each connected data source is only declared once
+        BitSet connected;
+        connectivity.GetStateDataSources(stateIndex, connected);
+        ok = ListDataSourcesGraph(graph, SelectFromList(dataSourceList, connected));
+    }
+    if (ok) {
+        ok = graph.Printf("%s", edges.Buffer());
+    }
+    if (ok) {
+        graph.Printf("%s", "}\n");
+        ok = output.Write(outputFilename.Buffer(), graph);
+    }
+    return ok;
+}
+
+/**
+ * @brief Creates one graph for each state, named %sState%s.gv (outputFilenamePrefix.Buffer(), state->GetName()).
+ * @see ExportRTStateGraph
+ */
+static bool ExportRTStatesGraph(GraphOutput &output, StreamString outputFilenamePrefix, ReferenceT<ReferenceContainer> stateList, ReferenceT<ReferenceContainer> functionList, ReferenceT<ReferenceContainer> dataSourceList) {
+    ApplicationConnectivity connectivity;
+    bool ok = connectivity.Build(stateList, functionList, dataSourceList);
+    //For each state
+    uint32 s; 
+    for (s=0; (s<stateList->Size()) && (ok); s++) {
+        ok = ExportRTStateGraph(output, outputFilenamePrefix, stateList->Get(s), s, dataSourceList, connectivity);
+    }
+    return ok;
+}
+
+/**
+ * @brief Compact, read-only, description of a MARTe2 StateMachine read directly from a ConfigurationDatabase.
+ * @details The StateMachineEvent and Message objects are not instantiated. All the strings point at the
+ * ConfigurationDatabase memory, which must outlive the table. The only allocations are the three arrays below, which are
+ * sized in a first pass over the configuration.
+ */
+class StateMachineTable {
+public:
+    /**
+     * A Message triggered by an event (or by the ENTER of a state).
+     */
+    struct Action {
+        const char8 *name;
+        const char8 *destination;
+        const char8 *function;
+    };
+
+    /**
+     * A StateMachineEvent of a given state.
+     */
+    struct Transition {
+        const char8 *eventName;
+        const char8 *nextState;
+        const char8 *nextStateError;
+        uint32 firstAction;
+        uint32 numberOfActions;
+    };
+
+    /**
+     * A state of the StateMachine.
+     */
+    struct State {
+        const char8 *name;
+        uint32 firstEnterAction;
+        uint32 numberOfEnterActions;
+        uint32 firstTransition;
+        uint32 numberOfTransitions;
+    };
+
+    StateMachineTable() {
+        states = NULL_PTR(State *);
+        transitions = NULL_PTR(Transition *);
+        actions = NULL_PTR(Action *);
+        numberOfStates = 0u;
+        numberOfTransitions = 0u;
+        numberOfActions = 0u;
+    }
+
+    ~StateMachineTable() {
+        if (states != NULL_PTR(State *)) {
+            delete [] states;
+        }
+        if (transitions != NULL_PTR(Transition *)) {
+            delete [] transitions;
+        }
+        if (actions != NULL_PTR(Action *)) {
+            delete [] actions;
+        }
+    }
+
+    /**
+     * @brief Loads the table from \a cdb, which must point at the StateMachine node.
+     * @return true if the table was not already loaded and all the movements in the ConfigurationDatabase are valid.
+     */
+    bool Load(ConfigurationDatabase &cdb) {
+        bool ok = (states == NULL_PTR(State *));
+        //First pass only counts
+        if (ok) {
+            ok = Walk(cdb, false);
+        }
+        if (ok) {
+            if (numberOfStates > 0u) {
+                states = new State[numberOfStates];
+            }
+            if (numberOfTransitions > 0u) {
+                transitions = new Transition[numberOfTransitions];
+            }
+            if (numberOfActions > 0u) {
+                actions = new Action[numberOfActions];
+            }
+            ok = Walk(cdb, true);
+        }
+        return ok;
+    }
+
+    uint32 GetNumberOfStates() const {
+        return numberOfStates;
+    }
+
+    const State &GetState(const uint32 s) const {
+        return states[s];
+    }
+
+    const Transition &GetTransition(const uint32 t) const {
+        return transitions[t];
+    }
+
+    const Action &GetAction(const uint32 a) const {
+        return actions[a];
+    }
+
+    /**
+     * @brief Checks if a state named \a stateName exists.
+     */
+    bool StateExists(const char8 * const stateName) const {
+        bool found = false;
+        uint32 s;
+        for (s=0u; (s<numberOfStates) && (!found) && (stateName != NULL_PTR(const char8 *)); s++) {
+            found = (StringHelper::Compare(states[s].name, stateName) == 0);
+        }
+        return found;
+    }
+
+private:
+    /**
+     * @brief Adds (or only counts, if \a fill is false) all the sub-nodes of the current node as actions.
+     */
+    bool AddActions(ConfigurationDatabase &cdb, const bool fill, uint32 &firstAction, uint32 &nActions) {
+        bool ok = true;
+        firstAction = numberOfActions;
+        nActions = 0u;
+        uint32 numberOfChildren = cdb.GetNumberOfChildren();
+        uint32 a;
+        for (a=0u; (a<numberOfChildren) && (ok); a++) {
+            if (cdb.MoveRelative(cdb.GetChildName(a))) {
+                if (fill) {
+                    actions[numberOfActions].name = GetNodeName(cdb);
+                    actions[numberOfActions].destination = GetStringLeaf(cdb, "Destination");
+                    actions[numberOfActions].function = GetStringLeaf(cdb, "Function");
+                }
+                numberOfActions++;
+                nActions++;
+                ok = cdb.MoveToAncestor(1u);
+            }
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Walks the StateMachine states and events. If \a fill is false the elements are only counted.
+     */
+    bool Walk(ConfigurationDatabase &cdb, const bool fill) {
+        bool ok = true;
+        numberOfStates = 0u;
+        numberOfTransitions = 0u;
+        numberOfActions = 0u;
+        uint32 nStates = cdb.GetNumberOfChildren();
+        uint32 s;
+        for (s=0u; (s<nStates) && (ok); s++) {
+            if (cdb.MoveRelative(cdb.GetChildName(s))) {
+                State *state = NULL_PTR(State *);
+                if (fill) {
+                    state = &states[numberOfStates];
+                    state->name = GetNodeName(cdb);
+                    state->firstEnterAction = 0u;
+                    state->numberOfEnterActions = 0u;
+                    state->firstTransition = numberOfTransitions;
+                    state->numberOfTransitions = 0u;
+                }
+                numberOfStates++;
+                uint32 nEvents = cdb.GetNumberOfChildren();
+                uint32 e;
+                for (e=0u; (e<nEvents) && (ok); e++) {
+                    if (cdb.MoveRelative(cdb.GetChildName(e))) {
+                        const char8 *eventName = GetNodeName(cdb);
+                        const char8 *className = GetStringLeaf(cdb, "Class");
+                        if (StringHelper::Compare(eventName, "ENTER") == 0) {
+                            uint32 firstAction;
+                            uint32 nActions;
+                            ok = AddActions(cdb, fill, firstAction, nActions);
+                            if (fill) {
+                                state->firstEnterAction = firstAction;
+                                state->numberOfEnterActions = nActions;
+                            }
+                        }
+                        else if ((className != NULL_PTR(const char8 *)) && (StringHelper::Compare(className, "StateMachineEvent") == 0)) {
+                            Transition *transition = NULL_PTR(Transition *);
+                            if (fill) {
+                                transition = &transitions[numberOfTransitions];
+                                transition->eventName = eventName;
+                                transition->nextState = GetStringLeaf(cdb, "NextState");
+                                transition->nextStateError = GetStringLeaf(cdb, "NextStateError");
+                                state->numberOfTransitions++;
+                            }
+                            numberOfTransitions++;
+                            uint32 firstAction;
+                            uint32 nActions;
+                            ok = AddActions(cdb, fill, firstAction, nActions);
+                            if (fill) {
+                                transition->firstAction = firstAction;
+                                transition->numberOfActions = nActions;
+                            }
+                        }
+                        else {
+                            //Not an event
+                        }
+                        if (ok) {
+                            ok = cdb.MoveToAncestor(1u);
+                        }
+                    }
+                }
+                if (ok) {
+                    ok = cdb.MoveToAncestor(1u);
+                }
+            }
+        }
+        return ok;
+    }
+
+    State *states;
+    Transition *transitions;
+    Action *actions;
+    uint32 numberOfStates;
+    uint32 numberOfTransitions;
+    uint32 numberOfActions;
+};
+
+/**
+ * @brief Exports a MARTe2 state machine in a graph named %sStateMachine.gv (outputFilenamePrefix.Buffer())
+ */
+static bool ExportStateMachine(GraphOutput &output, StreamString outputFilenamePrefix, ConfigurationDatabase &cdb) {
+    //Look for a StateMachine
+    uint32 i;
+    bool found = false;
+    bool ok = cdb.MoveToRoot();
+    uint32 numberOfNodesAfterRoot = cdb.GetNumberOfChildren(); 
+    for (i=0; (i<numberOfNodesAfterRoot) && (ok) && (!found); i++) {
+        ok = cdb.MoveToChild(i);
+        StreamString className;
+        if (ok) {
+            ok = cdb.Read("Class", className);
+        }
+        if (ok) {
+            found = (className == "StateMachine");
+            if (!found) {
+                ok = cdb.MoveToAncestor(1);
+            }
+        }
+    }
+    bool stateMachineExists = found;
+    if (stateMachineExists) {
+        //The StateMachine is read directly from the configuration (no StateMachineEvent/Message is instantiated)
+        StateMachineTable stateMachine;
+        if (ok) {
+            ok = stateMachine.Load(cdb);
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to read the StateMachine\n");
+            }
+        }
+
+        StreamString outputFilename;
+        if (ok) {
+            outputFilename.Printf("%sStateMachine.gv", outputFilenamePrefix.Buffer());
+        }
+        StreamString graph;
+        if (ok) {
+            graph.Printf("%s", "digraph G {\n");
+            graph.Printf("%s", "rankdir=TD\n");
+            graph.Printf("%d", "nodesep=2.5\n");
+            stateStyle.PrintDefaults(graph);
+            graph.Printf("edge [fontsize=%d]\n", stateStyle.GetFontSize());
+        }
+        uint32 numberOfStates = 0;
+        uint32 s;
+        //List all the states
+        if (ok) {
+            numberOfStates = stateMachine.GetNumberOfStates();
+            for (s=0; (s<numberOfStates) && (ok); s++) {
+                const StateMachineTable::State &state = stateMachine.GetState(s);
+                //Check if the state has an ENTER action list
+                StreamString actionList;
+                uint32 a;
+                for (a=0; a<state.numberOfEnterActions; a++) {
+                    ok &= actionList.Printf("%d. %s <BR/>", (a + 1), stateMachine.GetAction(state.firstEnterAction + a).name);
+                }
+                ok = graph.Printf("\"%s\" ", state.name);
+                GraphvizStateLabel(graph, state.name, state.numberOfEnterActions, actionList.Buffer());
+                ok &= graph.Printf("\n", voidAnyType);
+            }
+        }
+        //Connect the states
+        if (ok) {
+            for (s=0; (s<numberOfStates) && (ok); s++) {
+                const StateMachineTable::State &state = stateMachine.GetState(s);
+                uint32 e;
+                for (e=0; (e<state.numberOfTransitions) && (ok); e++) {
+                    const StateMachineTable::Transition &event = stateMachine.GetTransition(state.firstTransition + e);
+                    //Get the destination
+                    const char8 *nextState = (event.nextState != NULL_PTR(const char8 *)) ? event.nextState : "";
+                    uint32 numberOfActions = event.numberOfActions;
+                    if (numberOfActions > 0) {
+                        ok = graph.Printf("\"%s\"->\"%s\" [label= <<TABLE border=\"0\" cellborder=\"0\"><TR><TD ROWSPAN=\"%d\">%s</TD>", state.name, nextState, numberOfActions, event.eventName);
+                        ok = graph.Printf("<TD ALIGN=\"CENTER\" ROWSPAN=\"%d\"> / </TD>", numberOfActions);
+                        ok = graph.Printf("<TD ALIGN=\"LEFT\">1. %s </TD></TR>", stateMachine.GetAction(event.firstAction).name);
+                        uint32 a;
+                        for (a=1; a<numberOfActions; a++) {
+                            ok &= graph.Printf("<TR><TD ALIGN=\"LEFT\">%d. %s </TD></TR>", (a + 1), stateMachine.GetAction(event.firstAction + a).name);
+                        }
+                    }
+                    else {
+                        ok = graph.Printf("\"%s\"->\"%s\" [label= <<TABLE border=\"0\" cellborder=\"0\"><TR><TD>%s</TD></TR>", state.name, nextState, event.eventName);
+                    }
+                    ok = graph.Printf("</TABLE>>]\n", voidAnyType);
+                }
+            }
+        }
+        if (ok) {
+            graph.Printf("%s", "}\n");
+            ok = output.Write(outputFilename.Buffer(), graph);
+        }
+    } 
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "No state machine defined");
+    }
+
+    return ok;
+}
+
+/**
+ * @brief Number of nodes and of objects (i.e. nodes with a Class) of every subtree of a ConfigurationDatabase node, indexed in depth-first pre-order.
+ * @details Computed once before exporting, so that the collapse/group decisions do not require walking the subtrees again.
+ */
+class ObjectSubtreeSizes {
+public:
+    ObjectSubtreeSizes() {
+        subtreeNodes = NULL_PTR(uint32 *);
+        subtreeObjects = NULL_PTR(uint32 *);
+        numberOfNodes = 0u;
+    }
+
+    ~ObjectSubtreeSizes() {
+        if (subtreeNodes != NULL_PTR(uint32 *)) {
+            delete [] subtreeNodes;
+        }
+        if (subtreeObjects != NULL_PTR(uint32 *)) {
+            delete [] subtreeObjects;
+        }
+    }
+
+    /**
+     * @brief Computes the sizes of all the subtrees of the current node of \a cdb (which has index 0).
+     */
+    void Compute(ConfigurationDatabase &cdb) {
+        numberOfNodes = CountNodes(cdb);
+        subtreeNodes = new uint32[numberOfNodes];
+        subtreeObjects = new uint32[numberOfNodes];
+        uint32 index = 0u;
+        uint32 nodes;
+        uint32 objects;
+        Fill(cdb, index, nodes, objects);
+    }
+
+    /**
+     * @brief Gets the number of nodes (including itself) of the subtree at \a index.
+     */
+    uint32 GetNumberOfNodes(const uint32 index) const {
+        return (index < numberOfNodes) ? subtreeNodes[index] : 1u;
+    }
+
+    /**
+     * @brief Gets the number of objects below (not including) the node at \a index.
+     */
+    uint32 GetNumberOfObjects(const uint32 index) const {
+        return (index < numberOfNodes) ? subtreeObjects[index] : 0u;
+    }
+
+private:
+    uint32 CountNodes(ConfigurationDatabase &cdb) {
+        uint32 nodes = 1u;
+        uint32 numberOfChildren = cdb.GetNumberOfChildren();
+        uint32 i;
+        for (i=0u; i<numberOfChildren; i++) {
+            if (cdb.MoveRelative(cdb.GetChildName(i))) {
+                nodes += CountNodes(cdb);
+                cdb.MoveToAncestor(1u);
+            }
+        }
+        return nodes;
+    }
+
+    void Fill(ConfigurationDatabase &cdb, uint32 &index, uint32 &nodes, uint32 &objects) {
+        uint32 myIndex = index;
+        index++;
+        nodes = 1u;
+        objects = 0u;
+        uint32 numberOfChildren = cdb.GetNumberOfChildren();
+        uint32 i;
+        for (i=0u; i<numberOfChildren; i++) {
+            if (cdb.MoveRelative(cdb.GetChildName(i))) {
+                uint32 childNodes;
+                uint32 childObjects;
+                if (GetStringLeaf(cdb, "Class") != NULL_PTR(const char8 *)) {
+                    objects++;
+                }
+                Fill(cdb, index, childNodes, childObjects);
+                nodes += childNodes;
+                objects += childObjects;
+                cdb.MoveToAncestor(1u);
+            }
+        }
+        subtreeNodes[myIndex] = nodes;
+        subtreeObjects[myIndex] = objects;
+    }
+
+    uint32 *subtreeNodes;
+    uint32 *subtreeObjects;
+    uint32 numberOfNodes;
+};
+
+/**
+ * @brief Appends \a name to \a uniqueName replacing any sequence of - and : with a single _ (leading sequences of an empty
+ * \a uniqueName are removed).
+ * @param[in,out] separator true if the previous name appended ended with a sequence of - and :. A trailing sequence is not written,
+ * but carried in \a separator, so that the names appended one after the other are sanitised as their concatenation.
+ */
+static void AppendUniqueName(StreamString &uniqueName, const char8 * const name, bool &separator) {
+    uint32 i;
+    for (i=0u; name[i] != '\0'; i++) {
+        if ((name[i] == '-') || (name[i] == ':')) {
+            separator = true;
+        }
+        else {
+            if ((separator) && (uniqueName.Size() > 0u)) {
+                uniqueName += "_";
+            }
+            separator = false;
+            uniqueName += name[i];
+        }
+    }
+}
+
+/**
+ * @brief Exports all the configuraion file objects in a filed named %sObjects.gv (outputFilenamePrefix.Buffer())
+ * @param[in] sizes the subtree sizes computed from the node where the export starts.
+ * @param[in] lod the level of detail to apply.
+ * @param[in,out] index the pre-order index (in \a sizes) of the current node. Updated to the index of the next node to export.
+ * @param[in] depth the depth of the current node (1 for the node where the export starts).
+ * @param[in] uniqueName the unique (Graphviz friendly) name of the parent.
+ * @param[in] separator true if the name of the parent ends with a sequence of - and : (see AppendUniqueName).
+ */
+static bool ExportObjects(BufferedStreamI &graph, ConfigurationDatabase &cdb, const ObjectSubtreeSizes &sizes, const ObjectsLevelOfDetail &lod, uint32 &index, uint32 depth, StreamString uniqueName = "", bool separator = false) {
+    bool ok = true;
+    uint32 myIndex = index;
+    index++;
+    //Number of children
+    uint32 numberOfChildren = cdb.GetNumberOfChildren();
+    uint32 i;
+    bool isLeaf = true;
+    StreamString className;
+    if (!cdb.Read("Class", className)) {
+        className = "";
+    }
+    StreamString objName = cdb.GetName();
+    if (objName[0] == '+') {
+        objName = &(objName.Buffer())[1];
+    }
+    else if (objName[0] == '$') {
+        objName = &(objName.Buffer())[1];
+    }
+    bool clusterCreated = false;
+    //The parent name is already sanitised, so that only the new part has to be
+    AppendUniqueName(uniqueName, objName.Buffer(), separator);
+    uint32 numberOfObjects = sizes.GetNumberOfObjects(myIndex);
+    bool collapse = false;
+    if ((className.Size() > 0u) && (numberOfObjects > 0u)) {
+        if (lod.maxDepth > 0u) {
+            collapse = (depth >= lod.maxDepth);
+        }
+        if (lod.collapseThreshold > 0u) {
+            collapse = (collapse) || (numberOfObjects > lod.collapseThreshold);
+        }
+    }
+    if (collapse) {
+        //Skip the whole subtree
+        index = myIndex + sizes.GetNumberOfNodes(myIndex);
+        ok = graph.Printf("%s ", uniqueName.Buffer());
+        GraphvizObjectSummaryLabel(graph, objName.Buffer(), className.Buffer(), numberOfObjects);
+        ok &= graph.Printf("\n", voidAnyType);
+    }
+    else {
+        //Find which child classes are repeated enough times to be grouped
+        const char8 **groupClassNames = NULL_PTR(const char8 **);
+        uint32 *groupCounts = NULL_PTR(uint32 *);
+        bool *groupExported = NULL_PTR(bool *);
+        uint32 numberOfGroups = 0u;
+        if ((lod.groupThreshold > 1u) && (numberOfChildren >= lod.groupThreshold)) {
+            groupClassNames = new const char8*[numberOfChildren];
+            groupCounts = new uint32[numberOfChildren];
+            groupExported = new bool[numberOfChildren];
+            uint32 childIndex = index;
+            for(i=0; i<numberOfChildren; i++) {
+                if (cdb.MoveRelative(cdb.GetChildName(i))) {
+                    const char8 *childClassName = GetStringLeaf(cdb, "Class");
+                    if ((childClassName != NULL_PTR(const char8 *)) && (sizes.GetNumberOfObjects(childIndex) == 0u)) {
+                        uint32 g;
+                        bool found = false;
+                        for (g=0u; (g<numberOfGroups) && (!found); g++) {
+                            found = (StringHelper::Compare(groupClassNames[g], childClassName) == 0);
+                            if (found) {
+                                groupCounts[g]++;
+                            }
+                        }
+                        if (!found) {
+                            groupClassNames[numberOfGroups] = childClassName;
+                            groupCounts[numberOfGroups] = 1u;
+                            groupExported[numberOfGroups] = false;
+                            numberOfGroups++;
+                        }
+                    }
+                    childIndex += sizes.GetNumberOfNodes(childIndex);
+                    cdb.MoveToAncestor(1);
+                }
+            }
+        }
+        for(i=0; i<numberOfChildren; i++) {
+            if (cdb.MoveRelative(cdb.GetChildName(i))) {
+                StreamString childClassName;
+                if (!cdb.Read("Class", childClassName)) {
+                    childClassName = "";
+                }
+                if (childClassName.Size() > 0) {
+                    isLeaf = false;
+                    if (!clusterCreated) {
+                        if(objName.Size() > 0) {
+                            graph.Printf("subgraph cluster_%s {\nlabel=<<TABLE border=\"0\" cellborder=\"0\"><TR><TD width=\"60\" height=\"60\"><font point-size=\"%d\">%s <BR/>(%s)</font></TD></TR></TABLE>>\n", uniqueName.Buffer(), objectStyle.GetFontSize(), objName.Buffer(), className.Buffer());
+                            clusterCreated = true;
+                        }
+                    }
+                }
+                bool grouped = false;
+                if ((childClassName.Size() > 0) && (sizes.GetNumberOfObjects(index) == 0u)) {
+                    uint32 g;
+                    for (g=0u; (g<numberOfGroups) && (!grouped); g++) {
+                        if (childClassName == groupClassNames[g]) {
+                            grouped = (groupCounts[g] >= lod.groupThreshold);
+                            if ((grouped) && (!groupExported[g])) {
+                                StreamString groupName = uniqueName;
+                                groupName += "__";
+                                bool groupSeparator = false;
+                                AppendUniqueName(groupName, groupClassNames[g], groupSeparator);
+                                ok = graph.Printf("%s ", groupName.Buffer());
+                                GraphvizObjectGroupLabel(graph, groupClassNames[g], groupCounts[g]);
+                                ok &= graph.Printf("\n", voidAnyType);
+                                groupExported[g] = true;
+                            }
+                        }
+                    }
+                }
+                if (grouped) {
+                    index += sizes.GetNumberOfNodes(index);
+                }
+                else {
+                    ExportObjects(graph, cdb, sizes, lod, index, depth + 1u, uniqueName.Buffer(), separator);
+                }
+                cdb.MoveToAncestor(1);
+            }
+        }
+        if (groupClassNames != NULL_PTR(const char8 **)) {
+            delete [] groupClassNames;
+            delete [] groupCounts;
+            delete [] groupExported;
+        }
+        if (clusterCreated) {
+            graph.Printf("}\n", voidAnyType);
+        }
+        if (isLeaf) {
+            if (className.Size() > 0) {
+                ok = graph.Printf("%s ", uniqueName.Buffer(), objName.Buffer());
+                GraphvizNodeLabel(graph, objName.Buffer(), className.Buffer());
+                ok &= graph.Printf("\n", voidAnyType);
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Appends \a text to \a document as a JSON string (i.e. quoted and escaped).
+ */
+static void PrintModelJsonString(StreamString &document, const char8 * const text) {
+    (void) document.Printf("%s", "\"");
+    uint32 i;
+    for (i=0u; text[i] != '\0'; i++) {
+        if ((text[i] == '"') || (text[i] == '\\')) {
+            (void) document.Printf("\\%c", text[i]);
+        }
+        else if (static_cast<uint8>(text[i]) < 0x20u) {
+            (void) document.Printf("\\u%04x", static_cast<uint32>(static_cast<uint8>(text[i])));
+        }
+        else {
+            (void) document.Printf("%c", text[i]);
+        }
+    }
+    (void) document.Printf("%s", "\"");
+}
+
+/**
+ * @brief Appends \a text to \a document escaped as XML attribute or element text.
+ */
+static void PrintModelXmlString(StreamString &document, const char8 * const text) {
+    uint32 i;
+    for (i=0u; text[i] != '\0'; i++) {
+        if (text[i] == '&') {
+            (void) document.Printf("%s", "&amp;");
+        }
+        else if (text[i] == '<') {
+            (void) document.Printf("%s", "&lt;");
+        }
+        else if (text[i] == '>') {
+            (void) document.Printf("%s", "&gt;");
+        }
+        else if (text[i] == '"') {
+            (void) document.Printf("%s", "&quot;");
+        }
+        else {
+            (void) document.Printf("%c", text[i]);
+        }
+    }
+}
+
+/**
+ * @brief Returns true if \a function is the first of the \a functionList with its qualified name.
+ * @details A function executed by several threads may be listed more than once, but it is a single element of the model.
+ */
+static bool IsFirstModelFunction(ReferenceT<ReferenceContainer> functionList, const uint32 functionIndex) {
+    ReferenceT<GraphvizFunction> function = functionList->Get(functionIndex);
+    StreamString qualifiedName = function->GetQualifiedName();
+    bool first = true;
+    uint32 f;
+    for (f=0u; (f<functionIndex) && (first); f++) {
+        ReferenceT<GraphvizFunction> previous = functionList->Get(f);
+        first = !(previous->GetQualifiedName() == qualifiedName);
+    }
+    return first;
+}
+
+/**
+ * @brief A signal read or written by a function, resolved as in the RealTimeApplication: the properties that are not
+ * defined in the function are read from the DataSource signal with the same name (or Alias).
+ */
+struct ModelSignal {
+    StreamString name;
+    StreamString dataSourceName;
+    StreamString type;
+    uint32 numberOfElements;
+    /**
+     * Zero if the type is not a basic type (e.g. a structure).
+     */
+    uint32 byteSize;
+};
+
+/**
+ * @brief Resolves the signal at the current node of \a cdbSignal.
+ * @param[in] cdbRTApp the ConfigurationDatabase pointing at the RealTimeApplication root.
+ * @return false if the signal has no DataSource.
+ */
+static bool ResolveModelSignal(ConfigurationDatabase cdbSignal, ConfigurationDatabase cdbRTApp, ModelSignal &signal) {
+    signal.name = cdbSignal.GetName();
+    bool ok = cdbSignal.Read("DataSource", signal.dataSourceName);
+    StreamString alias = signal.name;
+    if (ok) {
+        (void) cdbSignal.Read("Alias", alias);
+        signal.type = "";
+        signal.numberOfElements = 0u;
+        (void) cdbSignal.Read("Type", signal.type);
+        (void) cdbSignal.Read("NumberOfElements", signal.numberOfElements);
+        StreamString dataSourceSignalPath;
+        (void) dataSourceSignalPath.Printf("+Data.+%s.Signals.%s", signal.dataSourceName.Buffer(), alias.Buffer());
+        if (cdbRTApp.MoveRelative(dataSourceSignalPath.Buffer())) {
+            if (signal.type.Size() == 0u) {
+                (void) cdbRTApp.Read("Type", signal.type);
+            }
+            if (signal.numberOfElements == 0u) {
+                (void) cdbRTApp.Read("NumberOfElements", signal.numberOfElements);
+            }
+        }
+        if (signal.numberOfElements == 0u) {
+            signal.numberOfElements = 1u;
+        }
+        signal.byteSize = 0u;
+        if (signal.type.Size() > 0u) {
+            TypeDescriptor td = TypeDescriptor::GetTypeDescriptorFromTypeName(signal.type.Buffer());
+            if (!td.isStructuredData) {
+                signal.byteSize = signal.numberOfElements * (td.numberOfBits / 8u);
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Appends to \a document the signals of the \a signalsNode (InputSignals or OutputSignals) of the \a function.
+ * @details Signals without DataSource, or with a DataSource that does not exist, are not part of the model.
+ */
+static bool PrintModelSignals(StreamString &document, const ApplicationModelFormat format, ConfigurationDatabase cdbRTApp, ReferenceT<ReferenceContainer> dataSourceList, ReferenceT<GraphvizFunction> function, const char8 * const signalsNode, uint32 &numberOfSignals) {
+    ConfigurationDatabase cdb = cdbRTApp;
+    StreamString path;
+    (void) path.Printf("+Functions.%s.%s", function->GetQualifiedName().Buffer(), signalsNode);
+    bool ok = true;
+    bool isInput = (StringHelper::Compare(signalsNode, "InputSignals") == 0);
+    if (cdb.MoveRelative(path.Buffer())) {
+        uint32 n;
+        for (n=0u; (n<cdb.GetNumberOfChildren()) && (ok); n++) {
+            ModelSignal signal;
+            ok = cdb.MoveToChild(n);
+            bool exists = false;
+            if (ok) {
+                exists = ResolveModelSignal(cdb, cdbRTApp, signal);
+                ok = cdb.MoveToAncestor(1u);
+            }
+            if (exists) {
+                StreamString dataSourceNodeName;
+                (void) dataSourceNodeName.Printf("+%s", signal.dataSourceName.Buffer());
+                ReferenceT<GraphvizDataSource> dataSource = dataSourceList->Find(dataSourceNodeName.Buffer());
+                exists = dataSource.IsValid();
+            }
+            if ((ok) && (exists)) {
+                StreamString id;
+                (void) id.Printf("signal:%s.%s.%s", function->GetName(), signalsNode, signal.name.Buffer());
+                StreamString functionId;
+                (void) functionId.Printf("function:%s", function->GetName());
+                StreamString dataSourceId;
+                (void) dataSourceId.Printf("datasource:%s", signal.dataSourceName.Buffer());
+                if (format == ApplicationModelJson) {
+                    (void) document.Printf("%s", (numberOfSignals > 0u) ? ",\n{\"id\":" : "\n{\"id\":");
+                    PrintModelJsonString(document, id.Buffer());
+                    (void) document.Printf("%s", ",\"function\":");
+                    PrintModelJsonString(document, functionId.Buffer());
+                    (void) document.Printf("%s", ",\"dataSource\":");
+                    PrintModelJsonString(document, dataSourceId.Buffer());
+                    (void) document.Printf(",\"direction\":\"%s\",\"name\":", isInput ? "input" : "output");
+                    PrintModelJsonString(document, signal.name.Buffer());
+                    (void) document.Printf("%s", ",\"type\":");
+                    PrintModelJsonString(document, signal.type.Buffer());
+                    (void) document.Printf(",\"elements\":%u,\"bytes\":%u}", signal.numberOfElements, signal.byteSize);
+                }
+                else {
+                    //The edges follow the data: from the DataSource to the function for the inputs and the other way around for the outputs
+                    (void) document.Printf("%s", "<edge id=\"");
+                    PrintModelXmlString(document, id.Buffer());
+                    (void) document.Printf("%s", "\" source=\"");
+                    PrintModelXmlString(document, isInput ? dataSourceId.Buffer() : functionId.Buffer());
+                    (void) document.Printf("%s", "\" target=\"");
+                    PrintModelXmlString(document, isInput ? functionId.Buffer() : dataSourceId.Buffer());
+                    (void) document.Printf("\"><data key=\"kind\">signal</data><data key=\"direction\">%s</data><data key=\"name\">", isInput ? "input" : "output");
+                    PrintModelXmlString(document, signal.name.Buffer());
+                    (void) document.Printf("%s", "</data><data key=\"type\">");
+                    PrintModelXmlString(document, signal.type.Buffer());
+                    (void) document.Printf("</data><data key=\"elements\">%u</data><data key=\"bytes\">%u</data></edge>\n", signal.numberOfElements, signal.byteSize);
+                }
+                numberOfSignals++;
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Serialises the model of the \a application, as described in ConfigurationGraphs::Export, into a document named
+ * %sModel.json or %sModel.graphml (application->GetOutputFilenamePrefix()).
+ * @details The ids are derived from the names, so that they are stable across exports: state:S, thread:S.T, function:F, datasource:D
+ * and signal:F.InputSignals.X (or OutputSignals).
+ */
+static bool ExportApplicationModel(GraphOutput &output, const ApplicationModelFormat format, ReferenceT<GraphvizApplication> application) {
+    bool isJson = (format == ApplicationModelJson);
+    StreamString outputFilename;
+    (void) outputFilename.Printf("%sModel.%s", application->GetOutputFilenamePrefix().Buffer(), isJson ? "json" : "graphml");
+    ReferenceT<ReferenceContainer> stateList = application->GetStates();
+    ReferenceT<ReferenceContainer> functionList = application->GetFunctions();
+    ReferenceT<ReferenceContainer> dataSourceList = application->GetDataSources();
+    StreamString document;
+    if (isJson) {
+        (void) document.Printf("%s", "{\"application\":");
+        PrintModelJsonString(document, application->GetName());
+        (void) document.Printf("%s", ",\n\"states\":[");
+    }
+    else {
+        (void) document.Printf("%s", "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+        (void) document.Printf("%s", "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n");
+        const char8 * const keys[][3] = { {"kind", "all", "string"}, {"name", "all", "string"}, {"qualifiedName", "node", "string"}, {"class", "node", "string"},
+                {"order", "edge", "int"}, {"direction", "edge", "string"}, {"type", "edge", "string"}, {"elements", "edge", "int"}, {"bytes", "edge", "int"} };
+        uint32 k;
+        for (k=0u; k<(sizeof(keys) / sizeof(keys[0])); k++) {
+            (void) document.Printf("<key id=\"%s\" for=\"%s\" attr.name=\"%s\" attr.type=\"%s\"/>\n", keys[k][0], keys[k][1], keys[k][0], keys[k][2]);
+        }
+        (void) document.Printf("%s", "<graph id=\"");
+        PrintModelXmlString(document, application->GetName());
+        (void) document.Printf("%s", "\" edgedefault=\"directed\">\n");
+    }
+    //The states and their threads (with the functions in order of execution)
+    bool ok = true;
+    uint32 s;
+    for (s=0u; (s<stateList->Size()) && (ok); s++) {
+        ReferenceT<GraphvizState> state = stateList->Get(s);
+        ok = state.IsValid();
+        StreamString stateId;
+        if (ok) {
+            (void) stateId.Printf("state:%s", state->GetName());
+            if (isJson) {
+                (void) document.Printf("%s", (s > 0u) ? ",\n{\"id\":" : "\n{\"id\":");
+                PrintModelJsonString(document, stateId.Buffer());
+                (void) document.Printf("%s", ",\"name\":");
+                PrintModelJsonString(document, state->GetName());
+                (void) document.Printf("%s", ",\"threads\":[");
+            }
+            else {
+                (void) document.Printf("%s", "<node id=\"");
+                PrintModelXmlString(document, stateId.Buffer());
+                (void) document.Printf("%s", "\"><data key=\"kind\">state</data><data key=\"name\">");
+                PrintModelXmlString(document, state->GetName());
+                (void) document.Printf("%s", "</data></node>\n");
+            }
+        }
+        uint32 t;
+        for (t=0u; (t<state->Size()) && (ok); t++) {
+            ReferenceT<GraphvizThread> threadI = state->Get(t);
+            ok = threadI.IsValid();
+            StreamString threadId;
+            if (ok) {
+                (void) threadId.Printf("thread:%s.%s", state->GetName(), threadI->GetName());
+                if (isJson) {
+                    (void) document.Printf("%s", (t > 0u) ? ",{\"id\":" : "{\"id\":");
+                    PrintModelJsonString(document, threadId.Buffer());
+                    (void) document.Printf("%s", ",\"name\":");
+                    PrintModelJsonString(document, threadI->GetName());
+                    (void) document.Printf("%s", ",\"functions\":[");
+                }
+                else {
+                    (void) document.Printf("%s", "<node id=\"");
+                    PrintModelXmlString(document, threadId.Buffer());
+                    (void) document.Printf("%s", "\"><data key=\"kind\">thread</data><data key=\"name\">");
+                    PrintModelXmlString(document, threadI->GetName());
+                    (void) document.Printf("%s", "</data></node>\n<edge source=\"");
+                    PrintModelXmlString(document, stateId.Buffer());
+                    (void) document.Printf("%s", "\" target=\"");
+                    PrintModelXmlString(document, threadId.Buffer());
+                    (void) document.Printf("%s", "\"><data key=\"kind\">runs</data></edge>\n");
+                }
+            }
+            uint32 f;
+            for (f=0u; (f<threadI->Size()) && (ok); f++) {
+                ReferenceT<GraphvizFunction> function = threadI->Get(f);
+                ok = function.IsValid();
+                if (ok) {
+                    StreamString functionId;
+                    (void) functionId.Printf("function:%s", function->GetName());
+                    if (isJson) {
+                        if (f > 0u) {
+                            (void) document.Printf("%s", ",");
+                        }
+                        PrintModelJsonString(document, functionId.Buffer());
+                    }
+                    else {
+                        (void) document.Printf("%s", "<edge source=\"");
+                        PrintModelXmlString(document, threadId.Buffer());
+                        (void) document.Printf("%s", "\" target=\"");
+                        PrintModelXmlString(document, functionId.Buffer());
+                        (void) document.Printf("\"><data key=\"kind\">executes</data><data key=\"order\">%u</data></edge>\n", f);
+                    }
+                }
+            }
+            if ((ok) && (isJson)) {
+                (void) document.Printf("%s", "]}");
+            }
+        }
+        if ((ok) && (isJson)) {
+            (void) document.Printf("%s", "]}");
+        }
+    }
+    //The functions
+    if ((ok) && (isJson)) {
+        (void) document.Printf("%s", "],\n\"functions\":[");
+    }
+    uint32 numberOfFunctions = 0u;
+    uint32 f;
+    for (f=0u; (f<functionList->Size()) && (ok); f++) {
+        ReferenceT<GraphvizFunction> function = functionList->Get(f);
+        ok = function.IsValid();
+        if ((ok) && (IsFirstModelFunction(functionList, f))) {
+            StreamString functionId;
+            (void) functionId.Printf("function:%s", function->GetName());
+            if (isJson) {
+                (void) document.Printf("%s", (numberOfFunctions > 0u) ? ",\n{\"id\":" : "\n{\"id\":");
+                PrintModelJsonString(document, functionId.Buffer());
+                (void) document.Printf("%s", ",\"name\":");
+                PrintModelJsonString(document, function->GetName());
+                (void) document.Printf("%s", ",\"qualifiedName\":");
+                PrintModelJsonString(document, function->GetQualifiedName().Buffer());
+                (void) document.Printf("%s", ",\"class\":");
+                PrintModelJsonString(document, function->GetClassName().Buffer());
+                (void) document.Printf("%s", "}");
+            }
+            else {
+                (void) document.Printf("%s", "<node id=\"");
+                PrintModelXmlString(document, functionId.Buffer());
+                (void) document.Printf("%s", "\"><data key=\"kind\">function</data><data key=\"name\">");
+                PrintModelXmlString(document, function->GetName());
+                (void) document.Printf("%s", "</data><data key=\"qualifiedName\">");
+                PrintModelXmlString(document, function->GetQualifiedName().Buffer());
+                (void) document.Printf("%s", "</data><data key=\"class\">");
+                PrintModelXmlString(document, function->GetClassName().Buffer());
+                (void) document.Printf("%s", "</data></node>\n");
+            }
+            numberOfFunctions++;
+        }
+    }
+    //The data sources
+    if ((ok) && (isJson)) {
+        (void) document.Printf("%s", "],\n\"dataSources\":[");
+    }
+    uint32 d;
+    for (d=0u; (d<dataSourceList->Size()) && (ok); d++) {
+        ReferenceT<GraphvizDataSource> dataSource = dataSourceList->Get(d);
+        ok = dataSource.IsValid();
+        if (ok) {
+            //The DataSource node names start with a +
+            const char8 * const dataSourceName = &(dataSource->GetName()[1]);
+            StreamString dataSourceId;
+            (void) dataSourceId.Printf("datasource:%s", dataSourceName);
+            if (isJson) {
+                (void) document.Printf("%s", (d > 0u) ? ",\n{\"id\":" : "\n{\"id\":");
+                PrintModelJsonString(document, dataSourceId.Buffer());
+                (void) document.Printf("%s", ",\"name\":");
+                PrintModelJsonString(document, dataSourceName);
+                (void) document.Printf("%s", ",\"class\":");
+                PrintModelJsonString(document, dataSource->GetClassName().Buffer());
+                (void) document.Printf("%s", "}");
+            }
+            else {
+                (void) document.Printf("%s", "<node id=\"");
+                PrintModelXmlString(document, dataSourceId.Buffer());
+                (void) document.Printf("%s", "\"><data key=\"kind\">datasource</data><data key=\"name\">");
+                PrintModelXmlString(document, dataSourceName);
+                (void) document.Printf("%s", "</data><data key=\"class\">");
+                PrintModelXmlString(document, dataSource->GetClassName().Buffer());
+                (void) document.Printf("%s", "</data></node>\n");
+            }
+        }
+    }
+    //The signals, as edges between the functions and the data sources
+    if ((ok) && (isJson)) {
+        (void) document.Printf("%s", "],\n\"signals\":[");
+    }
+    uint32 numberOfSignals = 0u;
+    for (f=0u; (f<functionList->Size()) && (ok); f++) {
+        if (IsFirstModelFunction(functionList, f)) {
+            ReferenceT<GraphvizFunction> function = functionList->Get(f);
+            ok = PrintModelSignals(document, format, application->GetConfiguration(), dataSourceList, function, "InputSignals", numberOfSignals);
+            if (ok) {
+                ok = PrintModelSignals(document, format, application->GetConfiguration(), dataSourceList, function, "OutputSignals", numberOfSignals);
+            }
+        }
+    }
+    if (ok) {
+        if (isJson) {
+            (void) document.Printf("%s", "]}\n");
+        }
+        else {
+            (void) document.Printf("%s", "</graph>\n</graphml>\n");
+        }
+        ok = output.Write(outputFilename.Buffer(), document);
+    }
+    return ok;
+}
+
+/**
+ * @brief Style and script of the explorer page. The fragments are loaded with script elements (and not with requests) so that the
+ * explorer also works when opened from the local files.
+ */
+static const char8 * const explorerPageHead =
+        "<style>\n"
+        "body{font-family:sans-serif;margin:1em}a{text-decoration:none}\n"
+        ".states{display:flex;flex-wrap:wrap;gap:1em}.state{border:1px solid #888;border-radius:6px;padding:0 1em}\n"
+        ".chain{display:flex;flex-wrap:wrap;list-style:none;padding:0;gap:0.5em}.chain li{border:1px solid #36c;border-radius:4px;padding:0.3em}\n"
+        ".chain li+li:before{content:'\\2192';margin-right:0.5em}.io{font-size:small}.selected{background:#fd6}\n"
+        ".ds{display:flex;gap:2em;align-items:center}.node{border:2px solid #c63;border-radius:50%;padding:1em}\n"
+        "#results{max-height:20em;overflow:auto}#view{border-top:1px solid #888;margin-top:1em}\n"
+        "</style>\n"
+        "<script>\n"
+        "var MARTe2Explorer = (function () {\n"
+        "    var fragments = {};\n"
+        "    var requested = {};\n"
+        "    var entries = [];\n"
+        "    function show() {\n"
+        "        var hash = window.location.hash.substring(1);\n"
+        "        try { hash = decodeURIComponent(hash); } catch (e) { }\n"
+        "        var separator = hash.indexOf('/');\n"
+        "        var id = (separator < 0) ? hash : hash.substring(0, separator);\n"
+        "        var anchor = (separator < 0) ? '' : hash.substring(separator + 1);\n"
+        "        if (fragments.hasOwnProperty(id)) {\n"
+        "            var view = document.getElementById('view');\n"
+        "            view.innerHTML = fragments[id];\n"
+        "            var target = document.getElementById('f:' + anchor);\n"
+        "            if (target === null) {\n"
+        "                target = view;\n"
+        "            }\n"
+        "            else {\n"
+        "                target.className += ' selected';\n"
+        "            }\n"
+        "            target.scrollIntoView();\n"
+        "        }\n"
+        "        else if ((id.length > 0) && (!requested.hasOwnProperty(id))) {\n"
+        "            requested[id] = true;\n"
+        "            var script = document.createElement('script');\n"
+        "            script.src = MARTe2ExplorerBase + 'Explorer_' + id + '.js';\n"
+        "            document.head.appendChild(script);\n"
+        "        }\n"
+        "    }\n"
+        "    function addResult(results, entry) {\n"
+        "        var item = document.createElement('li');\n"
+        "        var link = document.createElement('a');\n"
+        "        link.href = '#' + entry[3];\n"
+        "        link.textContent = entry[1];\n"
+        "        item.appendChild(link);\n"
+        "        item.appendChild(document.createTextNode(' ' + entry[2]));\n"
+        "        results.appendChild(item);\n"
+        "    }\n"
+        "    function search(text) {\n"
+        "        var key = text.toLowerCase();\n"
+        "        var results = document.getElementById('results');\n"
+        "        var maxResults = 50;\n"
+        "        var n = 0;\n"
+        "        var i;\n"
+        "        results.innerHTML = '';\n"
+        "        if (key.length > 0) {\n"
+        "            //The entries are sorted by key, so that the names starting with the text are found with a binary search\n"
+        "            var low = 0;\n"
+        "            var high = entries.length;\n"
+        "            while (low < high) {\n"
+        "                var middle = (low + high) >> 1;\n"
+        "                if (entries[middle][0] < key) {\n"
+        "                    low = middle + 1;\n"
+        "                }\n"
+        "                else {\n"
+        "                    high = middle;\n"
+        "                }\n"
+        "            }\n"
+        "            for (i = low; (i < entries.length) && (n < maxResults) && (entries[i][0].lastIndexOf(key, 0) === 0); i++, n++) {\n"
+        "                addResult(results, entries[i]);\n"
+        "            }\n"
+        "            for (i = 0; (i < entries.length) && (n < maxResults); i++) {\n"
+        "                if (entries[i][0].indexOf(key) > 0) {\n"
+        "                    addResult(results, entries[i]);\n"
+        "                    n++;\n"
+        "                }\n"
+        "            }\n"
+        "        }\n"
+        "    }\n"
+        "    window.addEventListener('hashchange', show);\n"
+        "    window.addEventListener('load', show);\n"
+        "    return {\n"
+        "        fragment: function (id, html) { fragments[id] = html; show(); },\n"
+        "        index: function (list) { entries = list; },\n"
+        "        search: search\n"
+        "    };\n"
+        "})();\n"
+        "</script>\n";
+
+/**
+ * @brief An entry of the search index of the explorer.
+ */
+struct ExplorerIndexEntry {
+    /**
+     * The lower case name.
+     */
+    StreamString key;
+    StreamString name;
+    const char8 *kind;
+    /**
+     * The fragment (and the function in the fragment) to show.
+     */
+    StreamString location;
+};
+
+/**
+ * @brief Orders the ExplorerIndexEntry pointers by key (qsort).
+ */
+static int CompareExplorerIndexEntries(const void *a, const void *b) {
+    const ExplorerIndexEntry *entryA = *static_cast<ExplorerIndexEntry * const *>(a);
+    const ExplorerIndexEntry *entryB = *static_cast<ExplorerIndexEntry * const *>(b);
+    int32 ret = StringHelper::Compare(entryA->key.Buffer(), entryB->key.Buffer());
+    if (ret == 0) {
+        ret = StringHelper::Compare(entryA->location.Buffer(), entryB->location.Buffer());
+    }
+    return ret;
+}
+
+/**
+ * @brief Sets the fields of \a entry. The key is the \a name in lower case.
+ */
+static void SetExplorerIndexEntry(ExplorerIndexEntry &entry, const char8 * const name, const char8 * const kind, const StreamString &location) {
+    entry.name = name;
+    entry.kind = kind;
+    entry.location = location;
+    entry.key = "";
+    uint32 i;
+    for (i=0u; name[i] != '\0'; i++) {
+        (void) entry.key.Printf("%c", static_cast<char8>(tolower(static_cast<uint8>(name[i]))));
+    }
+}
+
+/**
+ * @brief Writes the fragment \a html, with id \a fragmentId, as the script %sExplorer_%s.js (outputFilenamePrefix, fragmentId).
+ */
+static bool WriteExplorerFragment(GraphOutput &output, StreamString outputFilenamePrefix, const StreamString &fragmentId, const StreamString &html) {
+    StreamString outputFilename;
+    (void) outputFilename.Printf("%sExplorer_%s.js", outputFilenamePrefix.Buffer(), fragmentId.Buffer());
+    StreamString script;
+    (void) script.Printf("MARTe2Explorer.fragment(\"%s\", ", fragmentId.Buffer());
+    PrintModelJsonString(script, html.Buffer());
+    (void) script.Printf("%s", ");\n");
+    return output.Write(outputFilename.Buffer(), script);
+}
+
+/**
+ * @brief Exports the \a application as an HTML page, named %sExplorer.html (application->GetOutputFilenamePrefix()), which can be browsed
+ * without laying out the whole application.
+ * @details The page only has the states and their threads. The functions executed by each thread (in order, with the DataSources that
+ * they read and write) and the functions that read and write each DataSource are precomputed fragments, written as the scripts
+ * %sExplorer_Ts_t.js and %sExplorer_Dd.js, which are only loaded when shown. The names of the threads, functions and DataSources
+ * are indexed, sorted in lower case, in %sExplorerIndex.js.
+ */
+static bool ExportApplicationExplorer(GraphOutput &output, ReferenceT<GraphvizApplication> application) {
+    StreamString outputFilenamePrefix = application->GetOutputFilenamePrefix();
+    ReferenceT<ReferenceContainer> stateList = application->GetStates();
+    ReferenceT<ReferenceContainer> functionList = application->GetFunctions();
+    ReferenceT<ReferenceContainer> dataSourceList = application->GetDataSources();
+    ApplicationConnectivity connectivity;
+    bool ok = connectivity.Build(stateList, functionList, dataSourceList);
+    //The page loads the fragments relative to its own directory
+    const char8 *outputBasename = StringHelper::SearchLastChar(outputFilenamePrefix.Buffer(), '/');
+    if (outputBasename == NULL_PTR(const char8 *)) {
+        outputBasename = outputFilenamePrefix.Buffer();
+    }
+    else {
+        outputBasename = &outputBasename[1];
+    }
+    StreamString page;
+    (void) page.Printf("%s", "<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n<title>");
+    PrintModelXmlString(page, application->GetName());
+    (void) page.Printf("%s", "</title>\n<script>\nvar MARTe2ExplorerBase = ");
+    PrintModelJsonString(page, outputBasename);
+    (void) page.Printf("%s;\n</script>\n%s<script src=\"", explorerPageHead);
+    PrintModelXmlString(page, outputBasename);
+    (void) page.Printf("%s", "ExplorerIndex.js\"></script>\n</head>\n<body>\n<h1>");
+    PrintModelXmlString(page, application->GetName());
+    (void) page.Printf("%s", "</h1>\n<input type=\"search\" placeholder=\"Search\" oninput=\"MARTe2Explorer.search(this.value)\">\n<ul id=\"results\"></ul>\n<div class=\"states\">\n");
+    //One index entry for each thread, for each function in each thread and for each DataSource
+    uint32 numberOfEntries = dataSourceList->Size();
+    uint32 s;
+    for (s=0u; (s<stateList->Size()) && (ok); s++) {
+        ReferenceT<GraphvizState> state = stateList->Get(s);
+        ok = state.IsValid();
+        uint32 t;
+        for (t=0u; (t<state->Size()) && (ok); t++) {
+            ReferenceT<GraphvizThread> threadI = state->Get(t);
+            ok = threadI.IsValid();
+            if (ok) {
+                numberOfEntries += 1u + threadI->Size();
+            }
+        }
+    }
+    ExplorerIndexEntry *entries = new ExplorerIndexEntry[numberOfEntries];
+    uint32 numberOfIndexedEntries = 0u;
+    //The states and their threads, with the fragment of each thread
+    for (s=0u; (s<stateList->Size()) && (ok); s++) {
+        ReferenceT<GraphvizState> state = stateList->Get(s);
+        (void) page.Printf("%s", "<div class=\"state\"><h2>");
+        PrintModelXmlString(page, state->GetName());
+        (void) page.Printf("%s", "</h2><ul>\n");
+        uint32 t;
+        for (t=0u; (t<state->Size()) && (ok); t++) {
+            ReferenceT<GraphvizThread> threadI = state->Get(t);
+            StreamString fragmentId;
+            (void) fragmentId.Printf("T%u_%u", s, t);
+            StreamString threadName;
+            (void) threadName.Printf("%s.%s", state->GetName(), threadI->GetName());
+            SetExplorerIndexEntry(entries[numberOfIndexedEntries], threadName.Buffer(), "thread", fragmentId);
+            numberOfIndexedEntries++;
+            (void) page.Printf("<li><a href=\"#%s\">", fragmentId.Buffer());
+            PrintModelXmlString(page, threadI->GetName());
+            (void) page.Printf("</a> (%u functions)</li>\n", threadI->Size());
+            StreamString html;
+            (void) html.Printf("%s", "<h2>");
+            PrintModelXmlString(html, threadName.Buffer());
+            (void) html.Printf("%s", "</h2><ol class=\"chain\">\n");
+            uint32 f;
+            for (f=0u; (f<threadI->Size()) && (ok); f++) {
+                ReferenceT<GraphvizFunction> function = threadI->Get(f);
+                ok = function.IsValid();
+                if (ok) {
+                    StreamString location;
+                    (void) location.Printf("%s/%s", fragmentId.Buffer(), function->GetName());
+                    StreamString functionName;
+                    (void) functionName.Printf("%s (%s)", function->GetName(), threadName.Buffer());
+                    SetExplorerIndexEntry(entries[numberOfIndexedEntries], functionName.Buffer(), "function", location);
+                    numberOfIndexedEntries++;
+                    (void) html.Printf("%s", "<li id=\"f:");
+                    PrintModelXmlString(html, function->GetName());
+                    (void) html.Printf("%s", "\"><b>");
+                    PrintModelXmlString(html, function->GetName());
+                    (void) html.Printf("%s", "</b> <i>");
+                    PrintModelXmlString(html, function->GetClassName().Buffer());
+                    (void) html.Printf("%s", "</i><div class=\"io\">reads");
+                    uint32 d = 0u;
+                    while (connectivity.GetReads(function->GetIndex()).Next(d)) {
+                        (void) html.Printf(" <a href=\"#D%u\">", d);
+                        PrintModelXmlString(html, &(dataSourceList->Get(d)->GetName()[1]));
+                        (void) html.Printf("%s", "</a>");
+                        d++;
+                    }
+                    (void) html.Printf("%s", "<br>writes");
+                    d = 0u;
+                    while (connectivity.GetWrites(function->GetIndex()).Next(d)) {
+                        (void) html.Printf(" <a href=\"#D%u\">", d);
+                        PrintModelXmlString(html, &(dataSourceList->Get(d)->GetName()[1]));
+                        (void) html.Printf("%s", "</a>");
+                        d++;
+                    }
+                    (void) html.Printf("%s", "</div></li>\n");
+                }
+            }
+            if (ok) {
+                (void) html.Printf("%s", "</ol>\n");
+                ok = WriteExplorerFragment(output, outputFilenamePrefix, fragmentId, html);
+            }
+        }
+        (void) page.Printf("%s", "</ul></div>\n");
+    }
+    //The DataSources, with the fragment of each DataSource
+    (void) page.Printf("%s", "</div>\n<h2>Data Sources</h2>\n<ul>\n");
+    uint32 d;
+    for (d=0u; (d<dataSourceList->Size()) && (ok); d++) {
+        ReferenceT<GraphvizDataSource> dataSource = dataSourceList->Get(d);
+        ok = dataSource.IsValid();
+        StreamString fragmentId;
+        (void) fragmentId.Printf("D%u", d);
+        StreamString html;
+        if (ok) {
+            const char8 * const dataSourceName = &(dataSource->GetName()[1]);
+            SetExplorerIndexEntry(entries[numberOfIndexedEntries], dataSourceName, "datasource", fragmentId);
+            numberOfIndexedEntries++;
+            (void) page.Printf("<li><a href=\"#%s\">", fragmentId.Buffer());
+            PrintModelXmlString(page, dataSourceName);
+            (void) page.Printf("%s", "</a> <i>");
+            PrintModelXmlString(page, dataSource->GetClassName().Buffer());
+            (void) page.Printf("%s", "</i></li>\n");
+            (void) html.Printf("%s", "<h2>");
+            PrintModelXmlString(html, dataSourceName);
+            (void) html.Printf("%s", " <i>");
+            PrintModelXmlString(html, dataSource->GetClassName().Buffer());
+            (void) html.Printf("%s", "</i></h2><div class=\"ds\">\n");
+        }
+        //The functions writing to the DataSource on the left and the ones reading from it on the right
+        uint32 direction;
+        for (direction=0u; (direction<2u) && (ok); direction++) {
+            (void) html.Printf("<div><h3>%s</h3><ul>\n", (direction == 0u) ? "Written by" : "Read by");
+            for (s=0u; (s<stateList->Size()) && (ok); s++) {
+                ReferenceT<GraphvizState> state = stateList->Get(s);
+                uint32 t;
+                for (t=0u; (t<state->Size()) && (ok); t++) {
+                    ReferenceT<GraphvizThread> threadI = state->Get(t);
+                    uint32 f;
+                    for (f=0u; (f<threadI->Size()) && (ok); f++) {
+                        ReferenceT<GraphvizFunction> function = threadI->Get(f);
+                        const BitSet &accesses = (direction == 0u) ? connectivity.GetWrites(function->GetIndex()) : connectivity.GetReads(function->GetIndex());
+                        if (accesses.Test(d)) {
+                            (void) html.Printf("<li><a href=\"#T%u_%u/", s, t);
+                            PrintModelXmlString(html, function->GetName());
+                            (void) html.Printf("%s", "\">");
+                            PrintModelXmlString(html, function->GetName());
+                            (void) html.Printf("%s", "</a> (");
+                            PrintModelXmlString(html, state->GetName());
+                            (void) html.Printf("%s", ".");
+                            PrintModelXmlString(html, threadI->GetName());
+                            (void) html.Printf("%s", ")</li>\n");
+                        }
+                    }
+                }
+            }
+            (void) html.Printf("%s", "</ul></div>\n");
+            if (direction == 0u) {
+                (void) html.Printf("%s", "<div class=\"node\">");
+                PrintModelXmlString(html, &(dataSource->GetName()[1]));
+                (void) html.Printf("%s", "</div>\n");
+            }
+        }
+        if (ok) {
+            (void) html.Printf("%s", "</div>\n");
+            ok = WriteExplorerFragment(output, outputFilenamePrefix, fragmentId, html);
+        }
+    }
+    if (ok) {
+        (void) page.Printf("%s", "</ul>\n<div id=\"view\"></div>\n</body>\n</html>\n");
+        StreamString outputFilename;
+        (void) outputFilename.Printf("%sExplorer.html", outputFilenamePrefix.Buffer());
+        ok = output.Write(outputFilename.Buffer(), page);
+    }
+    //The search index, sorted by key so that the page can search the names by prefix
+    if (ok) {
+        ExplorerIndexEntry **sortedEntries = new ExplorerIndexEntry*[numberOfIndexedEntries + 1u];
+        uint32 e;
+        for (e=0u; e<numberOfIndexedEntries; e++) {
+            sortedEntries[e] = &entries[e];
+        }
+        qsort(sortedEntries, numberOfIndexedEntries, sizeof(ExplorerIndexEntry *), &CompareExplorerIndexEntries);
+        StreamString index;
+        (void) index.Printf("%s", "MARTe2Explorer.index([");
+        for (e=0u; e<numberOfIndexedEntries; e++) {
+            (void) index.Printf("%s", (e > 0u) ? ",\n[" : "\n[");
+            PrintModelJsonString(index, sortedEntries[e]->key.Buffer());
+            (void) index.Printf("%s", ",");
+            PrintModelJsonString(index, sortedEntries[e]->name.Buffer());
+            (void) index.Printf(",\"%s\",", sortedEntries[e]->kind);
+            PrintModelJsonString(index, sortedEntries[e]->location.Buffer());
+            (void) index.Printf("%s", "]");
+        }
+        (void) index.Printf("%s", "]);\n");
+        delete [] sortedEntries;
+        StreamString outputFilename;
+        (void) outputFilename.Printf("%sExplorerIndex.js", outputFilenamePrefix.Buffer());
+        ok = output.Write(outputFilename.Buffer(), index);
+    }
+    delete [] entries;
+    return ok;
+}
+
+/**
+ * @brief The RealTimeApplications to be exported and where to.
+ */
+struct ApplicationsExport {
+    ReferenceContainer *applicationList;
+    GraphOutput *output;
+    ApplicationModelFormat modelFormat;
+    bool explorer;
+};
+
+/**
+ * @brief Builds the model of the RealTimeApplication with index \a jobIndex in the applicationList of the ApplicationsExport (\a context) and exports its RTApp and State graphs
+ * (and its serialised model and explorer, if requested).
+ */
+static bool ExportApplicationJob(void * const context, const uint32 jobIndex) {
+    ApplicationsExport *applicationsExport = static_cast<ApplicationsExport *>(context);
+    ReferenceT<GraphvizApplication> application = applicationsExport->applicationList->Get(jobIndex);
+    bool ok = application.IsValid();
+    if (ok) {
+        ok = BuildApplicationModel(application->GetConfiguration(), application->GetStates(), application->GetFunctions(), application->GetDataSources());
+    }
+    if (ok) {
+        ok = ExportRTAppGraph(*applicationsExport->output, application->GetOutputFilenamePrefix(), application->GetStates(), application->GetFunctions(), application->GetDataSources());
+    }
+    if (ok) {
+        ok = ExportRTStatesGraph(*applicationsExport->output, application->GetOutputFilenamePrefix(), application->GetStates(), application->GetFunctions(), application->GetDataSources());
+    }
+    if ((ok) && (applicationsExport->modelFormat != ApplicationModelNone)) {
+        ok = ExportApplicationModel(*applicationsExport->output, applicationsExport->modelFormat, application);
+    }
+    if ((ok) && (applicationsExport->explorer)) {
+        ok = ExportApplicationExplorer(*applicationsExport->output, application);
+    }
+    if ((!ok) && (application.IsValid())) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to export the RealTimeApplication %s\n", application->GetName());
+    }
+    return ok;
+}
+
+/**
+ * @brief Adds an element named \a name to \a list, unless one with the same name already exists.
+ */
+static void AddUniqueName(ReferenceT<ReferenceContainer> list, StreamString name) {
+    uint32 i;
+    bool found = false;
+    for (i=0; (i<list->Size()) && (!found); i++) {
+        StreamString existentName = list->Get(i)->GetName();
+        found = (existentName == name);
+    }
+    if (!found) {
+        ReferenceT<ReferenceContainer> element = Reference(new ReferenceContainer());
+        element->SetName(name.Buffer());
+        list->Insert(element);
+    }
+}
+
+/**
+ * @brief Recursively collects all the Message destinations under the current node of \a cdb as edges from \a senderName to the destination root object.
+ * @param[out] messageEdges list of unique edges, where each element name is the Graphviz edge.
+ * @param[out] participants list of unique root object names which either send or receive messages.
+ */
+static void CollectMessageDestinations(ConfigurationDatabase &cdb, StreamString senderName, ReferenceT<ReferenceContainer> messageEdges, ReferenceT<ReferenceContainer> participants) {
+    StreamString className;
+    if (!cdb.Read("Class", className)) {
+        className = "";
+    }
+    if (className == "Message") {
+        StreamString destination;
+        if (cdb.Read("Destination", destination)) {
+            StreamString function;
+            if (!cdb.Read("Function", function)) {
+                function = "";
+            }
+            //Only the root object of the destination is relevant (e.g. TestApp.Functions.GAM1 -> TestApp)
+            (void) destination.Seek(0LLU);
+            StreamString destinationRoot;
+            char8 term;
+            (void) destination.GetToken(destinationRoot, ".", term);
+            StreamString edge;
+            edge.Printf("\"%s\"->\"%s\" [label=\"%s\"]", senderName.Buffer(), destinationRoot.Buffer(), function.Buffer());
+            AddUniqueName(messageEdges, edge);
+            AddUniqueName(participants, senderName);
+            AddUniqueName(participants, destinationRoot);
+        }
+    }
+    uint32 numberOfChildren = cdb.GetNumberOfChildren();
+    uint32 i;
+    for (i=0; i<numberOfChildren; i++) {
+        if (cdb.MoveRelative(cdb.GetChildName(i))) {
+            CollectMessageDestinations(cdb, senderName, messageEdges, participants);
+            cdb.MoveToAncestor(1);
+        }
+    }
+}
+
+/**
+ * @brief Exports the DataSources that are shared between RealTimeApplications (same name) and all the message destinations in a graph named %sApplications.gv (outputFilenamePrefix.Buffer())
+ */
+static bool ExportApplicationsGraph(GraphOutput &output, StreamString outputFilenamePrefix, ReferenceT<ReferenceContainer> applicationList, ConfigurationDatabase cdb) {
+    StreamString outputFilename;
+    outputFilename.Printf("%sApplications.gv", outputFilenamePrefix.Buffer());
+    StreamString graph;
+    bool ok = true;
+    if (ok) {
+        graph.Printf("%s", "digraph G {\n");
+        graph.Printf("%s", "rankdir=LR\n");
+        objectStyle.PrintDefaults(graph);
+    }
+    //The applications
+    uint32 a;
+    for (a=0; (a<applicationList->Size()) && (ok); a++) {
+        ReferenceT<GraphvizApplication> application = applicationList->Get(a);
+        ok = graph.Printf("\"%s\" ", application->GetName());
+        GraphvizNodeLabel(graph, application->GetName(), "RealTimeApplication");
+        ok &= graph.Printf("\n", voidAnyType);
+    }
+    //The shared data sources
+    if (ok) {
+        ok = graph.Printf("subgraph cluster_SharedDataSources {\n", voidAnyType);
+        ok &= graph.Printf("label = \"Shared Data Sources\"\n", voidAnyType);
+        ok &= dataSourceStyle.PrintDefaults(graph);
+    }
+    StreamString sharedEdges;
+    ReferenceT<ReferenceContainer> sharedDataSources = Reference(new ReferenceContainer());
+    for (a=0; (a<applicationList->Size()) && (ok); a++) {
+        ReferenceT<GraphvizApplication> application = applicationList->Get(a);
+        ReferenceT<ReferenceContainer> dataSourceList = application->GetDataSources();
+        uint32 s;
+        for (s=0; (s<dataSourceList->Size()) && (ok); s++) {
+            ReferenceT<GraphvizDataSource> dataSource = dataSourceList->Get(s);
+            StreamString dataSourceName = dataSource->GetName();
+            bool shared = false;
+            uint32 b;
+            for (b=0; (b<applicationList->Size()) && (!shared); b++) {
+                if (b != a) {
+                    ReferenceT<GraphvizApplication> otherApplication = applicationList->Get(b);
+                    ReferenceT<ReferenceContainer> otherDataSourceList = otherApplication->GetDataSources();
+                    uint32 o;
+                    for (o=0; (o<otherDataSourceList->Size()) && (!shared); o++) {
+                        StreamString otherDataSourceName = otherDataSourceList->Get(o)->GetName();
+                        shared = (otherDataSourceName == dataSourceName);
+                    }
+                }
+            }
+            if (shared) {
+                uint32 numberOfSharedDataSources = sharedDataSources->Size();
+                AddUniqueName(sharedDataSources, dataSourceName);
+                if (sharedDataSources->Size() > numberOfSharedDataSources) {
+                    ok = graph.Printf("\"DataSource.%s\" ", dataSource->GetName());
+                    GraphvizNodeLabel(graph, dataSource->GetName(), dataSource->GetClassName().Buffer());
+                    ok &= graph.Printf("\n", voidAnyType);
+                }
+                ok &= sharedEdges.Printf("\"%s\"->\"DataSource.%s\" [dir=none, style=dashed]\n", application->GetName(), dataSource->GetName());
+            }
+        }
+    }
+    if (ok) {
+        ok = graph.Printf("%s", "}\n");
+        ok &= graph.Printf("%s", sharedEdges.Buffer());
+    }
+    //The message destinations
+    ReferenceT<ReferenceContainer> messageEdges = Reference(new ReferenceContainer());
+    ReferenceT<ReferenceContainer> participants = Reference(new ReferenceContainer());
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    uint32 numberOfNodesAfterRoot = cdb.GetNumberOfChildren();
+    uint32 i;
+    for (i=0; (i<numberOfNodesAfterRoot) && (ok); i++) {
+        StreamString senderName = cdb.GetChildName(i);
+        if (cdb.MoveRelative(senderName.Buffer())) {
+            if ((senderName[0] == '$') || (senderName[0] == '+')) {
+                senderName = &(senderName.Buffer()[1]);
+            }
+            CollectMessageDestinations(cdb, senderName, messageEdges, participants);
+            ok = cdb.MoveToRoot();
+        }
+    }
+    uint32 p;
+    for (p=0; (p<participants->Size()) && (ok); p++) {
+        StreamString participantName = participants->Get(p)->GetName();
+        bool isApplication = false;
+        for (a=0; (a<applicationList->Size()) && (!isApplication); a++) {
+            isApplication = (participantName == applicationList->Get(a)->GetName());
+        }
+        if (!isApplication) {
+            StreamString className = "";
+            StreamString nodeName;
+            ok = cdb.MoveToRoot();
+            nodeName.Printf("+%s", participantName.Buffer());
+            bool exists = cdb.MoveRelative(nodeName.Buffer());
+            if (!exists) {
+                nodeName = "";
+                nodeName.Printf("$%s", participantName.Buffer());
+                exists = cdb.MoveRelative(nodeName.Buffer());
+            }
+            if (exists) {
+                if (!cdb.Read("Class", className)) {
+                    className = "";
+                }
+            }
+            ok &= graph.Printf("\"%s\" ", participantName.Buffer());
+            GraphvizNodeLabel(graph, participantName.Buffer(), className.Buffer());
+            ok &= graph.Printf("\n", voidAnyType);
+        }
+    }
+    uint32 e;
+    for (e=0; (e<messageEdges->Size()) && (ok); e++) {
+        ok = graph.Printf("%s\n", messageEdges->Get(e)->GetName());
+    }
+    if (ok) {
+        graph.Printf("%s", "}\n");
+        ok = output.Write(outputFilename.Buffer(), graph);
+    }
+    return ok;
+}
+
+/**
+ * @brief Exports the objects of the root node with index \a rootIndex in a graph named %sObjects_%d.gv (outputFilenamePrefix.Buffer(), rootIndex).
+ */
+static bool ExportObjectsGraph(GraphOutput &output, StreamString outputFilenamePrefix, ConfigurationDatabase cdb, uint32 rootIndex, const ObjectsLevelOfDetail &objectsLevelOfDetail) {
+    bool ok = cdb.MoveToRoot();
+    if (ok) {
+        ok = cdb.MoveToChild(rootIndex);
+    }
+    StreamString outputFilename;
+    if (ok) {
+        outputFilename.Printf("%sObjects_%d.gv", outputFilenamePrefix.Buffer(), rootIndex);
+    }
+    StreamString graph;
+    if (ok) {
+        graph.Printf("%s", "digraph G {\n");
+        graph.Printf("%s", "bgcolor=white\n");
+        objectStyle.PrintDefaults(graph);
+        ObjectSubtreeSizes sizes;
+        sizes.Compute(cdb);
+        uint32 index = 0u;
+        ok = ExportObjects(graph, cdb, sizes, objectsLevelOfDetail, index, 1u);
+        graph.Printf("%s", "}\n");
+    }
+    if (ok) {
+        ok = output.Write(outputFilename.Buffer(), graph);
+    }
+    return ok;
+}
+
+/**
+ * @brief Exports all the graphs of the configuration \a cdb into \a output, named with the \a outputFilenamePrefix.
+ * @param[out] applicationList where the models of all the RealTimeApplications are added to.
+ * @param[in] modelFormat the format of the serialised model of each RealTimeApplication (ApplicationModelNone for none).
+ * @param[in] explorer if true the explorer of each RealTimeApplication is also exported.
+ */
+static bool ExportConfiguration(GraphOutput &output, ConfigurationDatabase cdb, StreamString outputFilenamePrefix, const ObjectsLevelOfDetail &objectsLevelOfDetail, ReferenceT<ReferenceContainer> applicationList, const ApplicationModelFormat modelFormat, const bool explorer) {
+    bool ok = FindRealTimeApplications(cdb, outputFilenamePrefix, applicationList);
+    if (ok) {
+        //The applications are independent from each other, so that each is modelled and exported in its own thread
+        ApplicationsExport applicationsExport;
+        applicationsExport.applicationList = applicationList.operator->();
+        applicationsExport.output = &output;
+        applicationsExport.modelFormat = modelFormat;
+        applicationsExport.explorer = explorer;
+        ParallelJobRunner runner;
+        ok = runner.Run(&ExportApplicationJob, &applicationsExport, applicationList->Size());
+    }
+    if (ok) {
+        if (applicationList->Size() > 1u) {
+            ok = ExportApplicationsGraph(output, outputFilenamePrefix, applicationList, cdb);
+        }
+    }
+    if (ok) {
+        ok = ExportStateMachine(output, outputFilenamePrefix, cdb);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+        uint32 numberOfNodesAfterRoot = cdb.GetNumberOfChildren();
+        //Generate one Objects file for each sub-root node, otherwise it is a mess!
+        uint32 i;
+        for (i=0; (i<numberOfNodesAfterRoot) && (ok); i++) {
+            ok = ExportObjectsGraph(output, outputFilenamePrefix, cdb, i, objectsLevelOfDetail);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Prints the names of all the elements of \a list as a cdb vector named \a leafName.
+ */
+static void PrintNameVector(StreamString &response, const char8 * const leafName, ReferenceT<ReferenceContainer> list) {
+    (void) response.Printf("            %s = {", leafName);
+    uint32 i;
+    for (i=0; i<list->Size(); i++) {
+        (void) response.Printf(" \"%s\"", list->Get(i)->GetName());
+    }
+    (void) response.Printf("%s", " }\n");
+}
+
+/**
+ * @brief Takes the snapshots of all the applications of \a list, used to find which parts of each application change between updates.
+ */
+static bool TakeApplicationSnapshots(ReferenceT<ReferenceContainer> list) {
+    bool ok = true;
+    uint32 a;
+    for (a=0; (a<list->Size()) && (ok); a++) {
+        ReferenceT<GraphvizApplication> application = list->Get(a);
+        ok = application->TakeSnapshots();
+    }
+    return ok;
+}
+
+/**
+ * @brief Returns true if any root node of \a cdb is a StateMachine (i.e. if a StateMachine.gv is exported).
+ */
+static bool HasStateMachine(ConfigurationDatabase cdb) {
+    bool found = false;
+    bool ok = cdb.MoveToRoot();
+    uint32 numberOfNodesAfterRoot = cdb.GetNumberOfChildren();
+    uint32 i;
+    for (i=0; (i<numberOfNodesAfterRoot) && (ok) && (!found); i++) {
+        //Leaves are skipped
+        if (cdb.MoveToChild(i)) {
+            StreamString className;
+            if (cdb.Read("Class", className)) {
+                found = (className == "StateMachine");
+            }
+            ok = cdb.MoveToAncestor(1u);
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Gives to \a output an empty graph named \a name (see ConfigurationGraphs::ListOutputs).
+ */
+static bool ListOutput(GraphOutput &output, const StreamString &name) {
+    StreamString graph;
+    return output.Write(name.Buffer(), graph);
+}
+
+/**
+ * @brief Gives to \a output the names of the graphs of the \a application (see ExportApplicationJob), whose model must be built.
+ */
+static bool ListApplicationOutputs(GraphOutput &output, ReferenceT<GraphvizApplication> application, const ApplicationModelFormat modelFormat, const bool explorer) {
+    StreamString outputFilenamePrefix = application->GetOutputFilenamePrefix();
+    ReferenceT<ReferenceContainer> stateList = application->GetStates();
+    StreamString name;
+    (void) name.Printf("%sRTApp.gv", outputFilenamePrefix.Buffer());
+    bool ok = ListOutput(output, name);
+    uint32 s;
+    for (s=0u; (s<stateList->Size()) && (ok); s++) {
+        name = "";
+        (void) name.Printf("%sState%s.gv", outputFilenamePrefix.Buffer(), stateList->Get(s)->GetName());
+        ok = ListOutput(output, name);
+    }
+    if ((ok) && (modelFormat != ApplicationModelNone)) {
+        name = "";
+        (void) name.Printf("%sModel.%s", outputFilenamePrefix.Buffer(), (modelFormat == ApplicationModelJson) ? "json" : "graphml");
+        ok = ListOutput(output, name);
+    }
+    if ((ok) && (explorer)) {
+        for (s=0u; (s<stateList->Size()) && (ok); s++) {
+            ReferenceT<GraphvizState> state = stateList->Get(s);
+            uint32 t;
+            for (t=0u; (t<state->Size()) && (ok); t++) {
+                name = "";
+                (void) name.Printf("%sExplorer_T%u_%u.js", outputFilenamePrefix.Buffer(), s, t);
+                ok = ListOutput(output, name);
+            }
+        }
+        uint32 d;
+        for (d=0u; (d<application->GetDataSources()->Size()) && (ok); d++) {
+            name = "";
+            (void) name.Printf("%sExplorer_D%u.js", outputFilenamePrefix.Buffer(), d);
+            ok = ListOutput(output, name);
+        }
+        if (ok) {
+            name = "";
+            (void) name.Printf("%sExplorer.html", outputFilenamePrefix.Buffer());
+            ok = ListOutput(output, name);
+        }
+        if (ok) {
+            name = "";
+            (void) name.Printf("%sExplorerIndex.js", outputFilenamePrefix.Buffer());
+            ok = ListOutput(output, name);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief An application to be re-exported by an IncrementalGraphExport and its previous version (invalid if the application is new).
+ */
+struct ApplicationUpdate {
+    ReferenceT<GraphvizApplication> application;
+    ReferenceT<GraphvizApplication> previous;
+    GraphOutput *output;
+    ApplicationModelFormat modelFormat;
+    bool explorer;
+};
+
+/**
+ * @brief Builds the model of the application with index \a jobIndex of the ApplicationUpdate array (\a context) and exports its RTApp graph
+ * (and its serialised model and explorer, if requested) and the graphs of the states that changed. All the states are exported if any application node, other than +States, changed.
+ */
+static bool UpdateApplicationJob(void * const context, const uint32 jobIndex) {
+    ApplicationUpdate *update = &(static_cast<ApplicationUpdate *>(context)[jobIndex]);
+    ReferenceT<GraphvizApplication> application = update->application;
+    ReferenceT<GraphvizApplication> previous = update->previous;
+    bool ok = BuildApplicationModel(application->GetConfiguration(), application->GetStates(), application->GetFunctions(), application->GetDataSources());
+    if (ok) {
+        ok = ExportRTAppGraph(*update->output, application->GetOutputFilenamePrefix(), application->GetStates(), application->GetFunctions(), application->GetDataSources());
+    }
+    if ((ok) && (update->modelFormat != ApplicationModelNone)) {
+        ok = ExportApplicationModel(*update->output, update->modelFormat, application);
+    }
+    if ((ok) && (update->explorer)) {
+        ok = ExportApplicationExplorer(*update->output, application);
+    }
+    ApplicationConnectivity connectivity;
+    if (ok) {
+        ok = connectivity.Build(application->GetStates(), application->GetFunctions(), application->GetDataSources());
+    }
+    bool allStates = !previous.IsValid();
+    if (!allStates) {
+        allStates = application->GetSnapshot().Changed(previous->GetSnapshot(), "+States");
+    }
+    uint32 s;
+    for (s=0; (s<application->GetStates()->Size()) && (ok); s++) {
+        ReferenceT<GraphvizState> state = application->GetStates()->Get(s);
+        bool exportState = allStates;
+        if (!exportState) {
+            StreamString stateNodeName;
+            stateNodeName.Printf("+%s", state->GetName());
+            exportState = application->GetStatesSnapshot().NodeChanged(stateNodeName.Buffer(), previous->GetStatesSnapshot());
+        }
+        if (exportState) {
+            ok = ExportRTStateGraph(*update->output, application->GetOutputFilenamePrefix(), state, s, application->GetDataSources(), connectivity);
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to export the RealTimeApplication %s\n", application->GetName());
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+GraphOutput::~GraphOutput() {
+}
+
+bool GraphOutput::Remove(const char8 * const name) {
+    (void) name;
+    return true;
+}
+
+GraphFileOutput::GraphFileOutput(const bool compressIn) {
+    compress = compressIn;
+}
+
+GraphFileOutput::~GraphFileOutput() {
+}
+
+bool GraphFileOutput::Write(const char8 * const name, StreamString &graph) {
+    bool ok;
+    if (compress) {
+        StreamString filename;
+        (void) filename.Printf("%s.gz", name);
+        Directory d(filename.Buffer());
+        d.Delete();
+        int32 outputFd = ConfigurationStream::OpenOutput(filename.Buffer());
+        ok = (outputFd >= 0);
+        if (ok) {
+            //The graph is already printed, it is compressed by the exporting job while the other jobs print their graphs
+            ok = CompressedStream::Compress(graph.Buffer(), static_cast<uint32>(graph.Size()), outputFd);
+            if (!ConfigurationStream::Close(outputFd)) {
+                ok = false;
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to open file %s\n", filename.Buffer());
+        }
+    }
+    else {
+        //Delete any existent output file
+        Directory d(name);
+        d.Delete();
+        File outputFile;
+        ok = outputFile.Open(name, BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+        if (ok) {
+            uint32 writeSize = static_cast<uint32>(graph.Size());
+            ok = outputFile.Write(graph.Buffer(), writeSize);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to open file %s\n", name);
+        }
+        if (ok) {
+            ok = outputFile.Flush();
+        }
+        if (outputFile.IsOpen()) {
+            if (!outputFile.Close()) {
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+bool GraphFileOutput::Remove(const char8 * const name) {
+    StreamString filename;
+    (void) filename.Printf("%s%s", name, compress ? ".gz" : "");
+    Directory d(filename.Buffer());
+    bool ok = true;
+    if (d.Exists()) {
+        ok = d.Delete();
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to remove file %s\n", filename.Buffer());
+        }
+    }
+    return ok;
+}
+
+GraphMemoryOutput::GraphMemoryOutput() {
+    numberOfGraphs = 0u;
+    capacity = 16u;
+    names = new StreamString[capacity];
+    graphs = new StreamString[capacity];
+}
+
+GraphMemoryOutput::~GraphMemoryOutput() {
+    delete [] names;
+    delete [] graphs;
+}
+
+bool GraphMemoryOutput::Write(const char8 * const name, StreamString &graph) {
+    bool ok = (mux.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        if (numberOfGraphs == capacity) {
+            StreamString *newNames = new StreamString[capacity * 2u];
+            StreamString *newGraphs = new StreamString[capacity * 2u];
+            uint32 i;
+            for (i = 0u; i < numberOfGraphs; i++) {
+                newNames[i] = names[i];
+                newGraphs[i] = graphs[i];
+            }
+            delete [] names;
+            delete [] graphs;
+            names = newNames;
+            graphs = newGraphs;
+            capacity *= 2u;
+        }
+        names[numberOfGraphs] = name;
+        graphs[numberOfGraphs] = graph;
+        numberOfGraphs++;
+        mux.FastUnLock();
+    }
+    return ok;
+}
+
+uint32 GraphMemoryOutput::GetNumberOfGraphs() const {
+    return numberOfGraphs;
+}
+
+const char8 *GraphMemoryOutput::GetName(const uint32 i) const {
+    return names[i].Buffer();
+}
+
+const StreamString &GraphMemoryOutput::GetGraph(const uint32 i) const {
+    return graphs[i];
+}
+
+GraphNameList::GraphNameList(GraphOutput * const outputIn) {
+    output = outputIn;
+    numberOfGraphs = 0u;
+    capacity = 16u;
+    names = new StreamString[capacity];
+}
+
+GraphNameList::~GraphNameList() {
+    delete [] names;
+}
+
+bool GraphNameList::Write(const char8 * const name, StreamString &graph) {
+    bool ok = true;
+    if (output != NULL_PTR(GraphOutput *)) {
+        ok = output->Write(name, graph);
+    }
+    if (ok) {
+        ok = (mux.FastLock() == ErrorManagement::NoError);
+    }
+    if (ok) {
+        if (numberOfGraphs == capacity) {
+            StreamString *newNames = new StreamString[capacity * 2u];
+            uint32 i;
+            for (i = 0u; i < numberOfGraphs; i++) {
+                newNames[i] = names[i];
+            }
+            delete [] names;
+            names = newNames;
+            capacity *= 2u;
+        }
+        //The applications are exported in parallel, so that the names are sorted to always be listed in the same order
+        uint32 position = numberOfGraphs;
+        while ((position > 0u) && (StringHelper::Compare(names[position - 1u].Buffer(), name) > 0)) {
+            names[position] = names[position - 1u];
+            position--;
+        }
+        names[position] = name;
+        numberOfGraphs++;
+        mux.FastUnLock();
+    }
+    return ok;
+}
+
+bool GraphNameList::Remove(const char8 * const name) {
+    bool ok = true;
+    if (output != NULL_PTR(GraphOutput *)) {
+        ok = output->Remove(name);
+    }
+    return ok;
+}
+
+uint32 GraphNameList::GetNumberOfGraphs() const {
+    return numberOfGraphs;
+}
+
+const char8 *GraphNameList::GetName(const uint32 i) const {
+    return names[i].Buffer();
+}
+
+IncrementalGraphExport::IncrementalGraphExport(StreamString outputFilenamePrefixIn, const ObjectsLevelOfDetail &objectsLevelOfDetailIn, GraphOutput &outputIn, const ApplicationModelFormat modelFormatIn, const bool explorerIn) :
+        output(outputIn) {
+    outputFilenamePrefix = outputFilenamePrefixIn;
+    objectsLevelOfDetail = objectsLevelOfDetailIn;
+    modelFormat = modelFormatIn;
+    explorer = explorerIn;
+    snapshot = new ConfigurationSnapshot();
+    applicationList = Reference(new ReferenceContainer());
+    outputNames = NULL_PTR(GraphNameList *);
+    exported = false;
+}
+
+IncrementalGraphExport::~IncrementalGraphExport() {
+    delete snapshot;
+    if (outputNames != NULL_PTR(GraphNameList *)) {
+        delete outputNames;
+    }
+}
+
+bool IncrementalGraphExport::Update(ConfigurationDatabase newCdb) {
+    ConfigurationSnapshot newSnapshot;
+    bool ok = newCdb.MoveToRoot();
+    if (ok) {
+        ok = newSnapshot.Take(newCdb);
+    }
+    //Any node added, removed or moved changes the names of the output files, so that everything is exported again
+    bool exportAll = ((!exported) || (!newSnapshot.HasSameNodes(*snapshot)));
+    ReferenceT<ReferenceContainer> newApplicationList = Reference(new ReferenceContainer());
+    BeginStylesRead();
+    if ((ok) && (!exportAll)) {
+        ok = FindRealTimeApplications(newCdb, outputFilenamePrefix, newApplicationList);
+        if (ok) {
+            ok = TakeApplicationSnapshots(newApplicationList);
+        }
+        if (ok) {
+            //So does a state or an application added, removed or renamed
+            exportAll = !HasSameOutputs(newCdb, newApplicationList);
+        }
+        if ((ok) && (!exportAll)) {
+            ok = ExportChanges(newCdb, newSnapshot, newApplicationList);
+        }
+    }
+    if ((ok) && (exportAll)) {
+        newApplicationList = Reference(new ReferenceContainer());
+        GraphNameList *newOutputNames = new GraphNameList(&output);
+        ok = ExportConfiguration(*newOutputNames, newCdb, outputFilenamePrefix, objectsLevelOfDetail, newApplicationList, modelFormat, explorer);
+        if (ok) {
+            ok = TakeApplicationSnapshots(newApplicationList);
+        }
+        if (ok) {
+            ok = RemoveStaleOutputs(newOutputNames);
+        }
+        else {
+            delete newOutputNames;
+        }
+    }
+    EndStylesRead();
+    if (ok) {
+        exported = true;
+        cdb = newCdb;
+        snapshot->Swap(newSnapshot);
+        applicationList = newApplicationList;
+    }
+    return ok;
+}
+
+bool IncrementalGraphExport::HasSameOutputs(ConfigurationDatabase newCdb, ReferenceT<ReferenceContainer> newApplicationList) {
+    bool same = (newApplicationList->Size() == applicationList->Size());
+    uint32 a;
+    for (a=0; (a<newApplicationList->Size()) && (same); a++) {
+        ReferenceT<GraphvizApplication> application = newApplicationList->Get(a);
+        ReferenceT<GraphvizApplication> previous = applicationList->Find(application->GetName());
+        same = previous.IsValid();
+        if (same) {
+            same = (application->GetOutputFilenamePrefix() == previous->GetOutputFilenamePrefix());
+        }
+        if (same) {
+            same = application->GetStatesSnapshot().HasSameNodes(previous->GetStatesSnapshot());
+        }
+    }
+    if (same) {
+        same = (HasStateMachine(newCdb) == HasStateMachine(cdb));
+    }
+    return same;
+}
+
+bool IncrementalGraphExport::RemoveStaleOutputs(GraphNameList * const newOutputNames) {
+    bool ok = true;
+    if (outputNames != NULL_PTR(GraphNameList *)) {
+        //Both lists are sorted
+        uint32 n = 0u;
+        uint32 i;
+        for (i=0u; i<outputNames->GetNumberOfGraphs(); i++) {
+            const char8 *name = outputNames->GetName(i);
+            int32 comparison = 1;
+            while ((n < newOutputNames->GetNumberOfGraphs()) && (comparison > 0)) {
+                comparison = StringHelper::Compare(name, newOutputNames->GetName(n));
+                if (comparison > 0) {
+                    n++;
+                }
+            }
+            if (comparison != 0) {
+                if (!output.Remove(name)) {
+                    ok = false;
+                }
+            }
+        }
+        delete outputNames;
+    }
+    outputNames = newOutputNames;
+    return ok;
+}
+
+bool IncrementalGraphExport::ExportChanges(ConfigurationDatabase newCdb, ConfigurationSnapshot &newSnapshot, ReferenceT<ReferenceContainer> newApplicationList) {
+    bool ok = true;
+    bool changed = false;
+    bool stateMachineChanged = false;
+    uint32 i;
+    for (i=0; (i<newSnapshot.GetNumberOfNodes()) && (ok); i++) {
+        if (newSnapshot.NodeChanged(newSnapshot.GetNodeName(i), *snapshot)) {
+            changed = true;
+            ok = ExportObjectsGraph(output, outputFilenamePrefix, newCdb, i, objectsLevelOfDetail);
+            StreamString className;
+            if ((ok) && (newCdb.MoveToChild(i))) {
+                if (newCdb.Read("Class", className)) {
+                    stateMachineChanged = stateMachineChanged || (className == "StateMachine");
+                }
+                ok = newCdb.MoveToAncestor(1u);
+            }
+        }
+    }
+    uint32 numberOfApplications = newApplicationList->Size();
+    ApplicationUpdate *updates = new ApplicationUpdate[numberOfApplications];
+    uint32 numberOfUpdates = 0u;
+    uint32 a;
+    for (a=0; (a<numberOfApplications) && (ok); a++) {
+        ReferenceT<GraphvizApplication> application = newApplicationList->Get(a);
+        ReferenceT<GraphvizApplication> previous = applicationList->Find(application->GetName());
+        bool applicationChanged = !previous.IsValid();
+        if (!applicationChanged) {
+            applicationChanged = application->GetSnapshot().Changed(previous->GetSnapshot());
+        }
+        if (!applicationChanged) {
+            //The output prefixes are the same, as the root nodes did not change
+            applicationChanged = !(application->GetOutputFilenamePrefix() == previous->GetOutputFilenamePrefix());
+        }
+        if (applicationChanged) {
+            updates[numberOfUpdates].application = application;
+            updates[numberOfUpdates].previous = previous;
+            updates[numberOfUpdates].output = &output;
+            updates[numberOfUpdates].modelFormat = modelFormat;
+            updates[numberOfUpdates].explorer = explorer;
+            numberOfUpdates++;
+        }
+        else {
+            //Reuse the model of the previous version
+            ok = newApplicationList->Delete(application);
+            if (ok) {
+                ok = newApplicationList->Insert(previous, static_cast<int32>(a));
+            }
+        }
+    }
+    if ((ok) && (numberOfUpdates > 0u)) {
+        ParallelJobRunner runner;
+        ok = runner.Run(&UpdateApplicationJob, updates, numberOfUpdates);
+    }
+    delete [] updates;
+    if ((ok) && (changed) && (newApplicationList->Size() > 1u)) {
+        ok = ExportApplicationsGraph(output, outputFilenamePrefix, newApplicationList, newCdb);
+    }
+    if ((ok) && (stateMachineChanged)) {
+        ok = ExportStateMachine(output, outputFilenamePrefix, newCdb);
+    }
+    return ok;
+}
+
+namespace ConfigurationGraphs {
+
+bool LoadStyles(ConfigurationDatabase &cdb) {
+    (void) stylesMux.FastLock();
+    bool exporting = (numberOfStyleReaders > 0u);
+    bool ok = (!exporting);
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = functionStyle.Load(cdb, "Function");
+    }
+    if (ok) {
+        ok = dataSourceStyle.Load(cdb, "DataSource");
+    }
+    if (ok) {
+        ok = objectStyle.Load(cdb, "Object");
+    }
+    if (ok) {
+        ok = stateStyle.Load(cdb, "State");
+    }
+    stylesMux.FastUnLock();
+    if (exporting) {
+        REPORT_ERROR_STATIC(ErrorManagement::IllegalOperation, "The styles cannot be loaded while exporting\n");
+    }
+    else if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid style configuration\n");
+    }
+    else {
+        //Loaded
+    }
+    return ok;
+}
+
+bool Export(ConfigurationDatabase cdb, StreamString outputFilenamePrefix, const ObjectsLevelOfDetail &objectsLevelOfDetail, GraphOutput &output, const ApplicationModelFormat modelFormat, const bool explorer) {
+    ReferenceT<ReferenceContainer> applicationList = Reference(new ReferenceContainer());
+    BeginStylesRead();
+    bool ok = ExportConfiguration(output, cdb, outputFilenamePrefix, objectsLevelOfDetail, applicationList, modelFormat, explorer);
+    EndStylesRead();
+    return ok;
+}
+
+bool ListOutputs(ConfigurationDatabase cdb, StreamString outputFilenamePrefix, GraphOutput &output, const ApplicationModelFormat modelFormat, const bool explorer) {
+    ReferenceT<ReferenceContainer> applicationList = Reference(new ReferenceContainer());
+    bool ok = FindRealTimeApplications(cdb, outputFilenamePrefix, applicationList);
+    uint32 a;
+    for (a=0u; (a<applicationList->Size()) && (ok); a++) {
+        ReferenceT<GraphvizApplication> application = applicationList->Get(a);
+        ok = BuildApplicationModel(application->GetConfiguration(), application->GetStates(), application->GetFunctions(), application->GetDataSources());
+        if (ok) {
+            ok = ListApplicationOutputs(output, application, modelFormat, explorer);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to model the RealTimeApplication %s\n", application->GetName());
+        }
+    }
+    StreamString name;
+    if ((ok) && (applicationList->Size() > 1u)) {
+        (void) name.Printf("%sApplications.gv", outputFilenamePrefix.Buffer());
+        ok = ListOutput(output, name);
+    }
+    if ((ok) && (HasStateMachine(cdb))) {
+        name = "";
+        (void) name.Printf("%sStateMachine.gv", outputFilenamePrefix.Buffer());
+        ok = ListOutput(output, name);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        uint32 numberOfNodesAfterRoot = cdb.GetNumberOfChildren();
+        uint32 i;
+        for (i=0u; (i<numberOfNodesAfterRoot) && (ok); i++) {
+            name = "";
+            (void) name.Printf("%sObjects_%d.gv", outputFilenamePrefix.Buffer(), i);
+            ok = ListOutput(output, name);
+        }
+    }
+    return ok;
+}
+
+bool Analyse(ConfigurationDatabase cdb, StreamString &response) {
+    ReferenceT<ReferenceContainer> applicationList = Reference(new ReferenceContainer()); 
+    bool ok = FindRealTimeApplications(cdb, "", applicationList);
+    uint32 a;
+    for (a=0; (a<applicationList->Size()) && (ok); a++) {
+        ReferenceT<GraphvizApplication> application = applicationList->Get(a);
+        ok = BuildApplicationModel(application->GetConfiguration(), application->GetStates(), application->GetFunctions(), application->GetDataSources());
+        ApplicationConnectivity connectivity;
+        if (ok) {
+            ok = connectivity.Build(application->GetStates(), application->GetFunctions(), application->GetDataSources());
+        }
+        if (ok) {
+            (void) response.Printf("+%s = {\n", application->GetName());
+            (void) response.Printf("%s", "    +States = {\n");
+            uint32 s;
+            for (s=0; s<application->GetStates()->Size(); s++) {
+                ReferenceT<GraphvizState> state = application->GetStates()->Get(s);
+                (void) response.Printf("        +%s = {\n", state->GetName());
+                PrintNameVector(response, "Threads", state);
+                BitSet dataSources;
+                connectivity.GetStateDataSources(s, dataSources);
+                PrintNameVector(response, "DataSources", SelectFromList(application->GetDataSources(), dataSources));
+                connectivity.GetUnusedDataSources(s, dataSources);
+                PrintNameVector(response, "UnusedDataSources", SelectFromList(application->GetDataSources(), dataSources));
+                (void) response.Printf("%s", "        }\n");
+            }
+            (void) response.Printf("%s", "    }\n");
+            (void) response.Printf("%s", "    Functions = {");
+            uint32 f;
+            for (f=0; f<application->GetFunctions()->Size(); f++) {
+                ReferenceT<GraphvizFunction> function = application->GetFunctions()->Get(f);
+                (void) response.Printf(" \"%s\"", function->GetQualifiedName().Buffer());
+            }
+            (void) response.Printf("%s", " }\n");
+            (void) response.Printf("%s", "    DataSources = {");
+            uint32 d;
+            for (d=0; d<application->GetDataSources()->Size(); d++) {
+                (void) response.Printf(" \"%s\"", application->GetDataSources()->Get(d)->GetName());
+            }
+            (void) response.Printf("%s", " }\n");
+            BitSet shared;
+            connectivity.GetDataSourcesUsedByManyStates(shared);
+            ReferenceT<ReferenceContainer> sharedDataSources = SelectFromList(application->GetDataSources(), shared);
+            (void) response.Printf("%s", "    SharedDataSources = {");
+            for (d=0; d<sharedDataSources->Size(); d++) {
+                (void) response.Printf(" \"%s\"", sharedDataSources->Get(d)->GetName());
+            }
+            (void) response.Printf("%s", " }\n");
+            (void) response.Printf("%s", "}\n");
+        }
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,286 @@
+/**
+ * @file ConfigurationGraphs.h
+ * @brief Header file for the ConfigurationGraphs classes and functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the ConfigurationGraphs classes and functions.
+ */
+
+#ifndef CONFIGURATIONGRAPHS_H_
+#define CONFIGURATIONGRAPHS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+#include "FastPollingMutexSem.h"
+#include "ReferenceContainer.h"
+#include "ReferenceT.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Level of detail of the Objects graphs. A value of zero disables the corresponding option.
+ */
+struct ObjectsLevelOfDetail {
+    /**
+     * Objects deeper than this are summarised in their ancestor at this depth (the root object has depth 1).
+     */
+    uint32 maxDepth;
+    /**
+     * Objects with more than this number of descendant objects are drawn as a single summary node.
+     */
+    uint32 collapseThreshold;
+    /**
+     * Sibling objects without descendant objects and sharing the same class are drawn as a single node if there are at least this number of them.
+     * Zero disables the grouping and one is not valid (the tools reject it).
+     */
+    uint32 groupThreshold;
+};
+
+/**
+ * @brief Format of the serialised model of each RealTimeApplication (see ConfigurationGraphs::Export).
+ */
+enum ApplicationModelFormat {
+    ApplicationModelNone,
+    ApplicationModelJson,
+    ApplicationModelGraphML
+};
+
+/**
+ * @brief Destination of the exported Graphviz graphs.
+ * @details The graphs of different RealTimeApplications are exported in parallel, so that Write may be called concurrently (always with different names).
+ */
+class GraphOutput {
+public:
+    virtual ~GraphOutput();
+
+    /**
+     * @brief Stores the \a graph named \a name (e.g. PrefixRTApp.gv).
+     * @details \a graph may be consumed (e.g. swapped) by the implementation.
+     */
+    virtual bool Write(const char8 * const name, StreamString &graph) = 0;
+
+    /**
+     * @brief Removes the graph named \a name, written by a previous export, which is no longer produced.
+     * @details By default nothing is removed.
+     */
+    virtual bool Remove(const char8 * const name);
+};
+
+/**
+ * @brief Writes each graph into the file with its name, replacing any existent file.
+ */
+class GraphFileOutput : public GraphOutput {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] compressIn if true each graph is gzip compressed into the file with its name followed by .gz.
+     */
+    GraphFileOutput(const bool compressIn = false);
+
+    virtual ~GraphFileOutput();
+
+    virtual bool Write(const char8 * const name, StreamString &graph);
+
+    virtual bool Remove(const char8 * const name);
+
+private:
+    /**
+     * True if the graphs are compressed.
+     */
+    bool compress;
+};
+
+/**
+ * @brief Keeps all the graphs in memory, in the order in which they were written.
+ */
+class GraphMemoryOutput : public GraphOutput {
+public:
+    GraphMemoryOutput();
+
+    virtual ~GraphMemoryOutput();
+
+    virtual bool Write(const char8 * const name, StreamString &graph);
+
+    /**
+     * @brief Returns the number of graphs written.
+     */
+    uint32 GetNumberOfGraphs() const;
+
+    /**
+     * @brief Returns the name of the graph with index \a i.
+     */
+    const char8 *GetName(const uint32 i) const;
+
+    /**
+     * @brief Returns the graph with index \a i.
+     */
+    const StreamString &GetGraph(const uint32 i) const;
+
+private:
+    StreamString *names;
+    StreamString *graphs;
+    uint32 numberOfGraphs;
+    uint32 capacity;
+    FastPollingMutexSem mux;
+};
+
+/**
+ * @brief Records the (sorted) names of the graphs and forwards the graphs to another output, if any.
+ * @details Without another output nothing is written, i.e. it only lists the graphs that would be exported.
+ */
+class GraphNameList : public GraphOutput {
+public:
+    /**
+     * @brief Constructor. \a outputIn (if not NULL) must outlive this object.
+     */
+    GraphNameList(GraphOutput * const outputIn = NULL_PTR(GraphOutput *));
+
+    virtual ~GraphNameList();
+
+    virtual bool Write(const char8 * const name, StreamString &graph);
+
+    /**
+     * @brief Forwards the removal to the other output, if any.
+     */
+    virtual bool Remove(const char8 * const name);
+
+    /**
+     * @brief Returns the number of graphs written.
+     */
+    uint32 GetNumberOfGraphs() const;
+
+    /**
+     * @brief Returns the name with index \a i, in byte-wise order.
+     */
+    const char8 *GetName(const uint32 i) const;
+
+private:
+    GraphOutput *output;
+    StreamString *names;
+    uint32 numberOfGraphs;
+    uint32 capacity;
+    FastPollingMutexSem mux;
+};
+
+class ConfigurationSnapshot;
+
+/**
+ * @brief Keeps the last exported configuration, and the models of its applications, in memory and only exports again the graphs affected by a change.
+ */
+class IncrementalGraphExport {
+public:
+    /**
+     * @brief Constructor. The graphs are named with the \a outputFilenamePrefixIn and written into \a outputIn, which must outlive this object.
+     * @param[in] modelFormatIn the format of the serialised models of the applications that changed (see ConfigurationGraphs::Export).
+     * @param[in] explorerIn if true the explorers of the applications that changed are also exported (see ConfigurationGraphs::Export).
+     */
+    IncrementalGraphExport(StreamString outputFilenamePrefixIn, const ObjectsLevelOfDetail &objectsLevelOfDetailIn, GraphOutput &outputIn, const ApplicationModelFormat modelFormatIn = ApplicationModelNone, const bool explorerIn = false);
+
+    ~IncrementalGraphExport();
+
+    /**
+     * @brief Exports the graphs of \a newCdb that changed since the last update (all the graphs in the first update).
+     * @details If the update fails the previous configuration is kept. If the names of the graphs change (e.g. a state or a root node
+     * was added, removed or renamed) all the graphs are exported and the ones which are no longer produced are removed from the output.
+     */
+    bool Update(ConfigurationDatabase newCdb);
+
+private:
+    /**
+     * @brief Returns true if \a newCdb, whose root nodes are the same as the ones of the last exported configuration, produces the
+     * same graph names (same applications, same states and StateMachine).
+     */
+    bool HasSameOutputs(ConfigurationDatabase newCdb, ReferenceT<ReferenceContainer> newApplicationList);
+
+    /**
+     * @brief Removes from the output the graphs of the last complete export which are not in \a newOutputNames, which then replaces them.
+     */
+    bool RemoveStaleOutputs(GraphNameList * const newOutputNames);
+
+    /**
+     * @brief Exports the Objects graphs of the root nodes that changed, the StateMachine if it changed, and the applications that changed.
+     * @details Unchanged applications keep their previous model, which is moved to \a newApplicationList.
+     */
+    bool ExportChanges(ConfigurationDatabase newCdb, ConfigurationSnapshot &newSnapshot, ReferenceT<ReferenceContainer> newApplicationList);
+
+    StreamString outputFilenamePrefix;
+    ObjectsLevelOfDetail objectsLevelOfDetail;
+    ApplicationModelFormat modelFormat;
+    bool explorer;
+    GraphOutput &output;
+    ConfigurationDatabase cdb;
+    ConfigurationSnapshot *snapshot;
+    ReferenceT<ReferenceContainer> applicationList;
+    GraphNameList *outputNames;
+    bool exported;
+};
+
+/**
+ * @brief Model of the MARTe2 RealTimeApplications of a configuration (states, threads, functions and the data sources they read and write)
+ * and its export as Graphviz graphs.
+ */
+namespace ConfigurationGraphs {
+
+/**
+ * @brief Loads the Function, DataSource, Object and State styles from \a cdb (which must outlive all the exports).
+ * @details The styles are shared by all the exports, so that they are never changed while exporting.
+ * @return false if the styles are not valid or if any export is running (in which case the styles are not changed).
+ */
+bool LoadStyles(ConfigurationDatabase &cdb);
+
+/**
+ * @brief Exports all the graphs of the configuration \a cdb into \a output, named with the \a outputFilenamePrefix.
+ * @details The graphs are: PrefixRTApp.gv and PrefixState*.gv for each RealTimeApplication (prefixed with the application name if there is
+ * more than one), PrefixApplications.gv (if there is more than one application), PrefixStateMachine.gv and PrefixObjects_*.gv for each root node.
+ * If \a modelFormat is not ApplicationModelNone, the resolved model of each RealTimeApplication is also written, in the same pass, as PrefixModel.json
+ * or PrefixModel.graphml: the states, their threads and the functions executed by each thread (in order), the functions (with their class and
+ * qualified name), the data sources and one edge for each signal between a function and a data source (with its type, number of elements and size in bytes).
+ * The ids of the elements are derived from their names, so that they do not change between exports.
+ * If \a explorer is true each RealTimeApplication is also exported as the HTML page PrefixExplorer.html, which only shows the states and their
+ * threads and loads, on demand, the precomputed fragments (PrefixExplorer_*.js) with the functions of a thread or the functions around a data source.
+ * The names of the threads, functions and data sources are indexed in PrefixExplorerIndex.js. All the links are relative, so that the page works offline.
+ */
+bool Export(ConfigurationDatabase cdb, StreamString outputFilenamePrefix, const ObjectsLevelOfDetail &objectsLevelOfDetail, GraphOutput &output, const ApplicationModelFormat modelFormat = ApplicationModelNone, const bool explorer = false);
+
+/**
+ * @brief Gives to \a output (typically a GraphNameList) an empty graph with each of the names that Export would write, without printing any graph.
+ * @details Only the models of the applications are built, as their states, threads and data sources name the graphs. The level of detail of the
+ * Objects graphs does not change their names.
+ */
+bool ListOutputs(ConfigurationDatabase cdb, StreamString outputFilenamePrefix, GraphOutput &output, const ApplicationModelFormat modelFormat = ApplicationModelNone, const bool explorer = false);
+
+/**
+ * @brief Writes, in cdb syntax, the states, threads, functions and data sources of each RealTimeApplication in \a cdb,
+ * the data sources used (and never used) by each state and the data sources shared by several states.
+ */
+bool Analyse(ConfigurationDatabase cdb, StreamString &response);
+
+}
+
+}
+
+#endif /* CONFIGURATIONGRAPHS_H_ */
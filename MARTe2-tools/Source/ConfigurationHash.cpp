@@ -0,0 +1,77 @@
+/**
+ * @file ConfigurationHash.cpp
+ * @brief Source file for the ConfigurationHash functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the ConfigurationHash functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationHash.h"
+#include "HashFunction.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace ConfigurationHash {
+
+uint64 ComputeLeaf(ConfigurationDatabase &cdb, const char8 * const leafName) {
+    //Hashing the printed value makes the hash independent from how the value is stored (e.g. type of the parsed numbers)
+    StreamString value;
+    (void) value.Printf("%!", cdb.GetType(leafName));
+    return HashFunction::Fnv1a(value.Buffer(), static_cast<uint32>(value.Size()));
+}
+
+bool Compute(ConfigurationDatabase &cdb, uint64 &hash) {
+    bool ok = true;
+    hash = HashFunction::FNV1A_OFFSET_BASIS;
+    uint32 numberOfChildren = cdb.GetNumberOfChildren();
+    uint32 i;
+    for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+        const char8 * const childName = cdb.GetChildName(i);
+        hash = HashFunction::Fnv1a(childName, StringHelper::Length(childName) + 1u, hash);
+        if (cdb.MoveToChild(i)) {
+            uint64 childHash = 0u;
+            ok = Compute(cdb, childHash);
+            if (ok) {
+                hash = HashFunction::Combine(hash, childHash);
+                ok = cdb.MoveToAncestor(1u);
+            }
+        }
+        else {
+            hash = HashFunction::Combine(hash, ComputeLeaf(cdb, childName));
+        }
+    }
+    return ok;
+}
+
+}
+
+}
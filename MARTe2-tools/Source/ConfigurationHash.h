@@ -0,0 +1,64 @@
+/**
+ * @file ConfigurationHash.h
+ * @brief Header file for the ConfigurationHash functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the ConfigurationHash functions.
+ */
+
+#ifndef CONFIGURATIONHASH_H_
+#define CONFIGURATIONHASH_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Content hashes of ConfigurationDatabase subtrees.
+ */
+namespace ConfigurationHash {
+
+/**
+ * @brief Computes the hash of the subtree below the current node of \a cdb.
+ * @details The hash covers the names and the order of all the nodes and leaves, and the printed value of each leaf. The name of the
+ * current node itself is not included, so that two nodes with the same content have the same hash, regardless of where they are.
+ * @param[in] cdb the ConfigurationDatabase pointing at the node to hash. On return it points at the same node.
+ * @param[out] hash the subtree hash.
+ * @return true if all the movements in the ConfigurationDatabase are valid.
+ */
+bool Compute(ConfigurationDatabase &cdb, uint64 &hash);
+
+/**
+ * @brief Computes the hash of the printed value of the leaf \a leafName of the current node of \a cdb.
+ */
+uint64 ComputeLeaf(ConfigurationDatabase &cdb, const char8 * const leafName);
+
+}
+
+}
+
+#endif /* CONFIGURATIONHASH_H_ */
@@ -0,0 +1,184 @@
+/**
+ * @file ConfigurationHashTree.cpp
+ * @brief Source file for class ConfigurationHashTree
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ConfigurationHashTree (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationHashTree.h"
+#include "HashFunction.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ConfigurationHashTree::ConfigurationHashTree() {
+    nodes = NULL_PTR(Node *);
+    numberOfNodes = 0u;
+    nextFree = 0u;
+}
+
+ConfigurationHashTree::~ConfigurationHashTree() {
+    if (nodes != NULL_PTR(Node *)) {
+        delete [] nodes;
+    }
+}
+
+uint32 ConfigurationHashTree::Count(ConfigurationDatabase &cdb) {
+    uint32 n = 1u;
+    uint32 numberOfChildren = cdb.GetNumberOfChildren();
+    uint32 i;
+    for (i = 0u; i < numberOfChildren; i++) {
+        if (cdb.MoveToChild(i)) {
+            n += Count(cdb);
+            (void) cdb.MoveToAncestor(1u);
+        }
+        else {
+            n++;
+        }
+    }
+    return n;
+}
+
+bool ConfigurationHashTree::Fill(ConfigurationDatabase &cdb, const uint32 idx) {
+    bool ok = true;
+    uint32 numberOfChildren = cdb.GetNumberOfChildren();
+    uint32 first = nextFree;
+    nextFree += numberOfChildren;
+    nodes[idx].firstChild = first;
+    nodes[idx].numberOfChildren = numberOfChildren;
+    nodes[idx].leaf = false;
+    //Same hash as ConfigurationHash::Compute
+    uint64 hash = HashFunction::FNV1A_OFFSET_BASIS;
+    uint32 i;
+    for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+        uint32 c = first + i;
+        nodes[c].name = cdb.GetChildName(i);
+        nodes[c].parent = idx;
+        nodes[c].firstChild = numberOfNodes;
+        nodes[c].numberOfChildren = 0u;
+        if (cdb.MoveToChild(i)) {
+            ok = Fill(cdb, c);
+            if (ok) {
+                ok = cdb.MoveToAncestor(1u);
+            }
+        }
+        else {
+            nodes[c].leaf = true;
+            (void) nodes[c].value.Printf("%!", cdb.GetType(nodes[c].name.Buffer()));
+            nodes[c].hash = HashFunction::Fnv1a(nodes[c].value.Buffer(), static_cast<uint32>(nodes[c].value.Size()));
+        }
+        hash = HashFunction::Fnv1a(nodes[c].name.Buffer(), static_cast<uint32>(nodes[c].name.Size()) + 1u, hash);
+        hash = HashFunction::Combine(hash, nodes[c].hash);
+    }
+    nodes[idx].hash = hash;
+    return ok;
+}
+
+bool ConfigurationHashTree::Build(ConfigurationDatabase &cdb) {
+    if (nodes != NULL_PTR(Node *)) {
+        delete [] nodes;
+    }
+    numberOfNodes = Count(cdb);
+    nodes = new Node[numberOfNodes];
+    nodes[0].name = "";
+    nodes[0].parent = numberOfNodes;
+    nextFree = 1u;
+    return Fill(cdb, 0u);
+}
+
+uint32 ConfigurationHashTree::GetNumberOfNodes() const {
+    return numberOfNodes;
+}
+
+const char8 *ConfigurationHashTree::GetName(const uint32 idx) const {
+    return nodes[idx].name.Buffer();
+}
+
+const char8 *ConfigurationHashTree::GetValue(const uint32 idx) const {
+    return nodes[idx].value.Buffer();
+}
+
+uint64 ConfigurationHashTree::GetHash(const uint32 idx) const {
+    return nodes[idx].hash;
+}
+
+bool ConfigurationHashTree::IsLeaf(const uint32 idx) const {
+    return nodes[idx].leaf;
+}
+
+uint32 ConfigurationHashTree::GetParent(const uint32 idx) const {
+    return nodes[idx].parent;
+}
+
+uint32 ConfigurationHashTree::GetFirstChild(const uint32 idx) const {
+    return nodes[idx].firstChild;
+}
+
+uint32 ConfigurationHashTree::GetNumberOfChildren(const uint32 idx) const {
+    return nodes[idx].numberOfChildren;
+}
+
+uint32 ConfigurationHashTree::FindChild(const uint32 idx, const char8 * const name) const {
+    uint32 found = numberOfNodes;
+    uint32 first = nodes[idx].firstChild;
+    uint32 i;
+    for (i = 0u; (i < nodes[idx].numberOfChildren) && (found == numberOfNodes); i++) {
+        if (nodes[first + i].name == name) {
+            found = first + i;
+        }
+    }
+    return found;
+}
+
+const char8 *ConfigurationHashTree::GetLeafValue(const uint32 idx, const char8 * const name) const {
+    const char8 *value = NULL_PTR(const char8 *);
+    uint32 c = FindChild(idx, name);
+    if (c < numberOfNodes) {
+        if (nodes[c].leaf) {
+            value = nodes[c].value.Buffer();
+        }
+    }
+    return value;
+}
+
+void ConfigurationHashTree::GetPath(const uint32 idx, StreamString &path) const {
+    if (idx > 0u) {
+        if (nodes[idx].parent > 0u) {
+            GetPath(nodes[idx].parent, path);
+            (void) path.Printf("%s", ".");
+        }
+        (void) path.Printf("%s", nodes[idx].name.Buffer());
+    }
+}
+
+}
@@ -0,0 +1,153 @@
+/**
+ * @file ConfigurationHashTree.h
+ * @brief Header file for class ConfigurationHashTree
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ConfigurationHashTree
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CONFIGURATIONHASHTREE_H_
+#define CONFIGURATIONHASHTREE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Read-only copy of a ConfigurationDatabase where each node carries the hash of its subtree (i.e. a Merkle tree).
+ * @details Two subtrees (anywhere in the same or in different trees) with the same hash have, with a very high probability, the same content.
+ * The hash of each node is the same as the one computed by ConfigurationHash::Compute. The nodes are stored in a single array: the
+ * root has index 0 and the children of any node are contiguous. The leaves are stored with their printed value.
+ */
+class ConfigurationHashTree {
+public:
+    /**
+     * @brief Constructor. Builds an empty tree.
+     */
+    ConfigurationHashTree();
+
+    /**
+     * @brief Destructor.
+     */
+    ~ConfigurationHashTree();
+
+    /**
+     * @brief Builds the tree from the current node of \a cdb, which becomes the root (with an empty name).
+     * @return true if all the movements in the ConfigurationDatabase are valid.
+     */
+    bool Build(ConfigurationDatabase &cdb);
+
+    /**
+     * @brief Gets the number of nodes (including the leaves and the root).
+     */
+    uint32 GetNumberOfNodes() const;
+
+    /**
+     * @brief Gets the name of the node \a idx, as in the ConfigurationDatabase (e.g. +Functions).
+     */
+    const char8 *GetName(const uint32 idx) const;
+
+    /**
+     * @brief Gets the printed value of the leaf \a idx (empty for nodes).
+     */
+    const char8 *GetValue(const uint32 idx) const;
+
+    /**
+     * @brief Gets the hash of the subtree of the node \a idx (or of the value of the leaf \a idx).
+     */
+    uint64 GetHash(const uint32 idx) const;
+
+    /**
+     * @brief Returns true if \a idx is a leaf.
+     */
+    bool IsLeaf(const uint32 idx) const;
+
+    /**
+     * @brief Gets the parent of the node \a idx. The parent of the root is GetNumberOfNodes().
+     */
+    uint32 GetParent(const uint32 idx) const;
+
+    /**
+     * @brief Gets the index of the first child of the node \a idx. The other children follow it.
+     */
+    uint32 GetFirstChild(const uint32 idx) const;
+
+    /**
+     * @brief Gets the number of children of the node \a idx.
+     */
+    uint32 GetNumberOfChildren(const uint32 idx) const;
+
+    /**
+     * @brief Gets the child named \a name of the node \a idx. Returns GetNumberOfNodes() if it does not exist.
+     */
+    uint32 FindChild(const uint32 idx, const char8 * const name) const;
+
+    /**
+     * @brief Gets the leaf named \a name of the node \a idx. Returns NULL if it does not exist.
+     */
+    const char8 *GetLeafValue(const uint32 idx, const char8 * const name) const;
+
+    /**
+     * @brief Writes the full path of the node \a idx, with the names separated by dots (e.g. +App.+Functions.+GAM1).
+     */
+    void GetPath(const uint32 idx, StreamString &path) const;
+
+private:
+    /**
+     * One node or leaf.
+     */
+    struct Node {
+        StreamString name;
+        StreamString value;
+        uint64 hash;
+        uint32 parent;
+        uint32 firstChild;
+        uint32 numberOfChildren;
+        bool leaf;
+    };
+
+    /**
+     * @brief Counts the nodes and leaves below the current node of \a cdb.
+     */
+    static uint32 Count(ConfigurationDatabase &cdb);
+
+    /**
+     * @brief Fills the node \a idx, and its subtree, from the current node of \a cdb.
+     */
+    bool Fill(ConfigurationDatabase &cdb, const uint32 idx);
+
+    Node *nodes;
+    uint32 numberOfNodes;
+    uint32 nextFree;
+};
+
+}
+
+#endif /* CONFIGURATIONHASHTREE_H_ */
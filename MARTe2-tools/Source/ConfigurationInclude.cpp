@@ -0,0 +1,736 @@
+/**
+ * @file ConfigurationInclude.cpp
+ * @brief Source file for the ConfigurationInclude functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the ConfigurationInclude functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "BinaryRecord.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationInclude.h"
+#include "ConfigurationSidecar.h"
+#include "Directory.h"
+#include "FastPollingMutexSem.h"
+#include "File.h"
+#include "HashFunction.h"
+#include "MemoryOperationsHelper.h"
+#include "ReferenceContainer.h"
+#include "ReferenceT.h"
+#include "StringHelper.h"
+#include "TypeDescriptor.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Name of the leaf with the fragments to include.
+ */
+static const char8 * const INCLUDE_LEAF = "Include";
+
+/**
+ * The first bytes of a fragment stored in the disk cache.
+ */
+static const char8 * const FRAGMENT_MAGIC = "MCFGFRG";
+
+/**
+ * Size of FRAGMENT_MAGIC (with its terminator).
+ */
+static const uint32 FRAGMENT_MAGIC_SIZE = 8u;
+
+/**
+ * Version of the format of the fragments stored in the disk cache.
+ */
+static const uint32 FRAGMENT_VERSION = 2u;
+
+/**
+ * Kinds of children in a stored fragment: leaves stored as text, nodes and numeric leaves stored with their type.
+ */
+static const uint8 FRAGMENT_LEAF = 0u;
+static const uint8 FRAGMENT_NODE = 1u;
+static const uint8 FRAGMENT_TYPED_LEAF = 2u;
+
+/**
+ * Maximum number of parsed fragments kept in memory.
+ */
+static const uint32 FRAGMENT_CACHE_CAPACITY = 64u;
+
+/**
+ * @brief A file being included, linked to the file which includes it, so that the include cycles are found by walking up the chain.
+ */
+struct IncludeFrame {
+    const char8 *filename;
+    const IncludeFrame *parent;
+    /**
+     * Where the canonical names of the fragments read are listed (NULL if not requested).
+     */
+    StreamString *includedFilenames;
+};
+
+/**
+ * @brief A parsed fragment, identified by the hash of its content and by its format.
+ */
+struct FragmentCacheEntry {
+    uint64 hash;
+    StreamString format;
+    uint64 lastUsed;
+    ConfigurationDatabase cdb;
+};
+
+/**
+ * The parsed fragments (allocated on the first include), of which the least recently used one is evicted when the cache is full.
+ * Their trees are never modified (they are copied before being composed).
+ */
+static FragmentCacheEntry *fragmentCache = NULL_PTR(FragmentCacheEntry *);
+static uint32 fragmentCacheSize = 0u;
+static uint64 fragmentCacheUseCounter = 0u;
+
+/**
+ * The directory of the disk cache (empty if disabled), read from MARTe2_TOOLS_INCLUDE_CACHE on the first include.
+ */
+static StreamString diskCacheDirectory;
+static bool diskCacheDirectoryRead = false;
+
+/**
+ * Protects the fragmentCache and the diskCacheDirectory.
+ */
+static FastPollingMutexSem fragmentCacheMux;
+
+/**
+ * @brief Returns true if \a td is an integer or floating point type, whose leaves are stored with their type and raw bytes.
+ */
+static bool IsNumericType(const TypeDescriptor &td) {
+    bool numeric = (!td.isStructuredData);
+    if (numeric) {
+        numeric = ((td.type == SignedInteger) || (td.type == UnsignedInteger) || (td.type == Float));
+    }
+    if (numeric) {
+        numeric = ((td.numberOfBits == 8u) || (td.numberOfBits == 16u) || (td.numberOfBits == 32u) || (td.numberOfBits == 64u));
+    }
+    return numeric;
+}
+
+/**
+ * @brief Serialises the current node of \a cdb (and all its subtree) into \a stored: the number of children followed, for each child,
+ * by its kind and name and then by its subtree (nodes), by its type name, number of dimensions, rows, columns and raw elements (numeric
+ * leaves, e.g. type casts) or by its number of dimensions, rows, columns and elements as strings (all the other leaves). Keeping the type
+ * of the numeric leaves makes a fragment loaded from the disk cache print (and hash) as the parsed one.
+ */
+static bool StoreNode(ConfigurationDatabase &cdb, StreamString &stored) {
+    uint32 numberOfChildren = cdb.GetNumberOfChildren();
+    BinaryRecord::AppendValue(stored, numberOfChildren);
+    bool ok = true;
+    uint32 i;
+    for (i=0u; (i<numberOfChildren) && (ok); i++) {
+        const char8 *childName = cdb.GetChildName(i);
+        if (cdb.MoveToChild(i)) {
+            BinaryRecord::AppendValue(stored, FRAGMENT_NODE);
+            BinaryRecord::AppendString(stored, childName);
+            ok = StoreNode(cdb, stored);
+            if (ok) {
+                ok = cdb.MoveToAncestor(1u);
+            }
+        }
+        else {
+            AnyType leaf = cdb.GetType(childName);
+            TypeDescriptor td = leaf.GetTypeDescriptor();
+            uint8 numberOfDimensions = leaf.GetNumberOfDimensions();
+            uint32 numberOfColumns = (numberOfDimensions > 0u) ? leaf.GetNumberOfElements(0u) : 1u;
+            uint32 numberOfRows = (numberOfDimensions > 1u) ? leaf.GetNumberOfElements(1u) : 1u;
+            uint32 numberOfElements = numberOfColumns * numberOfRows;
+            if (IsNumericType(td)) {
+                td.isConstant = false;
+                uint32 dataSize = numberOfElements * (td.numberOfBits / 8u);
+                char8 *data = new char8[dataSize];
+                AnyType destination(td, 0u, static_cast<void *>(data));
+                destination.SetNumberOfDimensions(numberOfDimensions);
+                if (numberOfDimensions > 0u) {
+                    destination.SetNumberOfElements(0u, numberOfColumns);
+                }
+                if (numberOfDimensions > 1u) {
+                    destination.SetNumberOfElements(1u, numberOfRows);
+                }
+                ok = cdb.Read(childName, destination);
+                BinaryRecord::AppendValue(stored, FRAGMENT_TYPED_LEAF);
+                BinaryRecord::AppendString(stored, childName);
+                BinaryRecord::AppendString(stored, TypeDescriptor::GetTypeNameFromTypeDescriptor(td));
+                BinaryRecord::AppendValue(stored, numberOfDimensions);
+                BinaryRecord::AppendValue(stored, numberOfRows);
+                BinaryRecord::AppendValue(stored, numberOfColumns);
+                (void) stored.Write(data, dataSize);
+                delete [] data;
+            }
+            else {
+                BinaryRecord::AppendValue(stored, FRAGMENT_LEAF);
+                BinaryRecord::AppendString(stored, childName);
+                ok = BinaryRecord::AppendTextLeaf(cdb, childName, stored);
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Decodes a numeric leaf serialised by StoreNode, from \a reader, into the leaf \a name of the current node of \a cdb.
+ * @return false if \a reader is truncated or corrupted.
+ */
+static bool LoadTypedLeaf(ByteReader &reader, ConfigurationDatabase &cdb, const StreamString &name) {
+    StreamString typeName;
+    uint8 numberOfDimensions = 0u;
+    uint32 numberOfRows = 0u;
+    uint32 numberOfColumns = 0u;
+    bool ok = reader.ReadString(typeName);
+    if (ok) {
+        ok = reader.ReadValue(numberOfDimensions);
+    }
+    if (ok) {
+        ok = reader.ReadValue(numberOfRows);
+    }
+    if (ok) {
+        ok = reader.ReadValue(numberOfColumns);
+    }
+    TypeDescriptor td = InvalidType;
+    if (ok) {
+        td = TypeDescriptor::GetTypeDescriptorFromTypeName(typeName.Buffer());
+        ok = (IsNumericType(td)) && (numberOfDimensions <= 2u);
+    }
+    uint64 numberOfElements = static_cast<uint64>(numberOfRows) * static_cast<uint64>(numberOfColumns);
+    if (ok) {
+        //A scalar has exactly one element and a vector one row
+        ok = ((numberOfDimensions == 0u) && (numberOfElements == 1u)) || ((numberOfDimensions == 1u) && (numberOfRows == 1u)) || (numberOfDimensions == 2u);
+    }
+    if (ok) {
+        //Bounds the number of elements before computing their size
+        ok = (numberOfElements <= reader.GetRemainingSize());
+    }
+    uint64 dataSize = numberOfElements * static_cast<uint64>(td.numberOfBits / 8u);
+    if (ok) {
+        ok = (dataSize <= reader.GetRemainingSize());
+    }
+    if (ok) {
+        //Copied into an aligned buffer
+        uint64 *data = new uint64[static_cast<uint32>((dataSize + 7u) / 8u) + 1u];
+        ok = reader.ReadBytes(data, dataSize);
+        AnyType source(td, 0u, static_cast<const void *>(data));
+        source.SetNumberOfDimensions(numberOfDimensions);
+        if (numberOfDimensions > 0u) {
+            source.SetNumberOfElements(0u, numberOfColumns);
+        }
+        if (numberOfDimensions > 1u) {
+            source.SetNumberOfElements(1u, numberOfRows);
+        }
+        if (ok) {
+            ok = cdb.Write(name.Buffer(), source);
+        }
+        delete [] data;
+    }
+    return ok;
+}
+
+/**
+ * @brief Decodes a subtree serialised by StoreNode, from \a reader, into the current node of \a cdb.
+ * @return false if \a reader is truncated or corrupted.
+ */
+static bool LoadNode(ByteReader &reader, ConfigurationDatabase &cdb) {
+    uint32 numberOfChildren = 0u;
+    bool ok = reader.ReadValue(numberOfChildren);
+    uint32 i;
+    for (i=0u; (i<numberOfChildren) && (ok); i++) {
+        uint8 kind = FRAGMENT_LEAF;
+        StreamString name;
+        ok = reader.ReadValue(kind);
+        if (ok) {
+            ok = reader.ReadString(name);
+        }
+        if ((ok) && (kind == FRAGMENT_NODE)) {
+            ok = cdb.CreateRelative(name.Buffer());
+            if (ok) {
+                ok = LoadNode(reader, cdb);
+            }
+            if (ok) {
+                ok = cdb.MoveToAncestor(1u);
+            }
+        }
+        else if ((ok) && (kind == FRAGMENT_TYPED_LEAF)) {
+            ok = LoadTypedLeaf(reader, cdb, name);
+        }
+        else if ((ok) && (kind == FRAGMENT_LEAF)) {
+            ok = BinaryRecord::ReadTextLeaf(reader, name.Buffer(), cdb);
+        }
+        else {
+            //Truncated or unknown kind
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Loads the fragment \a cachedFilename from the disk cache into \a cdb.
+ * @return false if it does not exist or is not valid (in which case the fragment is parsed).
+ */
+static bool LoadFromDiskCache(const StreamString &cachedFilename, ConfigurationDatabase &cdb) {
+    StreamString content;
+    bool ok = ConfigurationCache::ReadFile(cachedFilename.Buffer(), content);
+    if (ok) {
+        ok = (content.Size() >= (FRAGMENT_MAGIC_SIZE + sizeof(uint32)));
+    }
+    if (ok) {
+        ok = (MemoryOperationsHelper::Compare(content.Buffer(), FRAGMENT_MAGIC, FRAGMENT_MAGIC_SIZE) == 0);
+    }
+    ByteReader reader(content.Buffer(), content.Size(), FRAGMENT_MAGIC_SIZE);
+    uint32 version = 0u;
+    if (ok) {
+        ok = reader.ReadValue(version);
+    }
+    if (ok) {
+        ok = (version == FRAGMENT_VERSION);
+    }
+    if (ok) {
+        ok = LoadNode(reader, cdb);
+    }
+    if (ok) {
+        ok = (reader.GetRemainingSize() == 0u);
+    }
+    if (!ok) {
+        cdb.Purge();
+        (void) cdb.MoveToRoot();
+    }
+    return ok;
+}
+
+/**
+ * @brief Stores the fragment \a cdb in the disk cache as \a cachedFilename.
+ * @details The fragment is written into a temporary file which is then renamed, so that concurrent processes never read a partially
+ * written fragment. Failing to store the fragment is not an error.
+ */
+static void StoreInDiskCache(const StreamString &cachedFilename, ConfigurationDatabase cdb) {
+    StreamString stored;
+    char8 magic[FRAGMENT_MAGIC_SIZE];
+    (void) MemoryOperationsHelper::Set(&magic[0], '\0', FRAGMENT_MAGIC_SIZE);
+    (void) StringHelper::Copy(&magic[0], FRAGMENT_MAGIC);
+    uint32 magicSize = FRAGMENT_MAGIC_SIZE;
+    (void) stored.Write(&magic[0], magicSize);
+    BinaryRecord::AppendValue(stored, FRAGMENT_VERSION);
+    bool ok = cdb.MoveToRoot();
+    if (ok) {
+        ok = StoreNode(cdb, stored);
+    }
+    StreamString temporaryFilename;
+    (void) temporaryFilename.Printf("%s.%d.tmp", cachedFilename.Buffer(), static_cast<int32>(getpid()));
+    File outputFile;
+    if (ok) {
+        ok = outputFile.Open(temporaryFilename.Buffer(), BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+    }
+    if (ok) {
+        uint32 size = static_cast<uint32>(stored.Size());
+        ok = outputFile.Write(stored.Buffer(), size);
+    }
+    if (ok) {
+        ok = outputFile.Flush();
+    }
+    if (outputFile.IsOpen()) {
+        (void) outputFile.Close();
+    }
+    if (ok) {
+        ok = (rename(temporaryFilename.Buffer(), cachedFilename.Buffer()) == 0);
+    }
+    if (!ok) {
+        Directory d(temporaryFilename.Buffer());
+        (void) d.Delete();
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed to store %s in the include cache\n", cachedFilename.Buffer());
+    }
+}
+
+/**
+ * @brief Gets the parsed fragment \a filename, which is only parsed if a fragment with the same content and format was not parsed before
+ * (by this process or, with the disk cache, by any process). \a cdb shares the cached tree, which must not be modified.
+ */
+static bool GetFragment(const char8 * const filename, const char8 * const format, ConfigurationDatabase &cdb) {
+    StreamString content;
+    bool ok = ConfigurationCache::ReadFile(filename, content);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to read %s\n", filename);
+    }
+    uint64 hash = 0u;
+    if (ok) {
+        hash = HashFunction::Fnv1a(content.Buffer(), static_cast<uint32>(content.Size()));
+        ok = (fragmentCacheMux.FastLock() == ErrorManagement::NoError);
+    }
+    bool found = false;
+    StreamString cachedFilename;
+    if (ok) {
+        if (!diskCacheDirectoryRead) {
+            const char8 * const directory = getenv("MARTe2_TOOLS_INCLUDE_CACHE");
+            if (directory != NULL_PTR(const char8 *)) {
+                diskCacheDirectory = directory;
+            }
+            diskCacheDirectoryRead = true;
+        }
+        uint32 i;
+        for (i=0u; (i<fragmentCacheSize) && (!found); i++) {
+            found = ((fragmentCache[i].hash == hash) && (fragmentCache[i].format == format));
+            if (found) {
+                fragmentCacheUseCounter++;
+                fragmentCache[i].lastUsed = fragmentCacheUseCounter;
+                cdb = fragmentCache[i].cdb;
+            }
+        }
+        if (diskCacheDirectory.Size() > 0u) {
+            (void) cachedFilename.Printf("%s/%016llx.%s.mcf", diskCacheDirectory.Buffer(), hash, format);
+        }
+        fragmentCacheMux.FastUnLock();
+    }
+    if ((ok) && (!found) && (cachedFilename.Size() > 0u)) {
+        found = LoadFromDiskCache(cachedFilename, cdb);
+        if (found) {
+            REPORT_ERROR_STATIC(ErrorManagement::Debug, "Loaded %s from the include cache\n", filename);
+        }
+    }
+    if ((ok) && (!found)) {
+        StreamString err;
+        ok = ConfigurationCache::Parse(content, format, cdb, err);
+        if (ok) {
+            if (cachedFilename.Size() > 0u) {
+                StoreInDiskCache(cachedFilename, cdb);
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to parse %s: %s\n", filename, err.Buffer());
+        }
+    }
+    if ((ok) && (!found)) {
+        ok = (fragmentCacheMux.FastLock() == ErrorManagement::NoError);
+        if (ok) {
+            if (fragmentCache == NULL_PTR(FragmentCacheEntry *)) {
+                fragmentCache = new FragmentCacheEntry[FRAGMENT_CACHE_CAPACITY];
+            }
+            uint32 idx = fragmentCacheSize;
+            if (fragmentCacheSize < FRAGMENT_CACHE_CAPACITY) {
+                fragmentCacheSize++;
+            }
+            else {
+                //Evict the least recently used (its tree stays alive while any configuration still shares it)
+                idx = 0u;
+                uint32 i;
+                for (i=1u; i<FRAGMENT_CACHE_CAPACITY; i++) {
+                    if (fragmentCache[i].lastUsed < fragmentCache[idx].lastUsed) {
+                        idx = i;
+                    }
+                }
+            }
+            fragmentCacheUseCounter++;
+            fragmentCache[idx].hash = hash;
+            fragmentCache[idx].format = format;
+            fragmentCache[idx].lastUsed = fragmentCacheUseCounter;
+            fragmentCache[idx].cdb = cdb;
+            fragmentCacheMux.FastUnLock();
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the directory of \a filename (with the trailing separator), empty if it has no directory.
+ */
+static void GetDirectory(const char8 * const filename, StreamString &directory) {
+    directory = "";
+    const char8 *lastSeparator = StringHelper::SearchLastChar(filename, '/');
+    if (lastSeparator != NULL_PTR(const char8 *)) {
+        uint32 directorySize = static_cast<uint32>(lastSeparator - filename) + 1u;
+        (void) directory.Write(filename, directorySize);
+    }
+}
+
+/**
+ * @brief Gets the format of the fragment \a filename from its extension (ignoring .gz): json, xml or, otherwise, \a includingFormat.
+ */
+static const char8 *GetFragmentFormat(const char8 * const filename, const char8 * const includingFormat) {
+    StreamString name = filename;
+    uint32 size = static_cast<uint32>(name.Size());
+    if ((size > 3u) && (StringHelper::Compare(&filename[size - 3u], ".gz") == 0)) {
+        size -= 3u;
+        name = "";
+        (void) name.Write(filename, size);
+    }
+    const char8 *format = includingFormat;
+    if ((size > 5u) && (StringHelper::Compare(&(name.Buffer()[size - 5u]), ".json") == 0)) {
+        format = "json";
+    }
+    else if ((size > 4u) && (StringHelper::Compare(&(name.Buffer()[size - 4u]), ".xml") == 0)) {
+        format = "xml";
+    }
+    else {
+        //Same format as the including file
+    }
+    return format;
+}
+
+/**
+ * @brief Returns true if any node of \a cdb, from its current node, has an Include leaf. On return \a cdb points at the same node.
+ */
+static bool HasIncludes(ConfigurationDatabase &cdb) {
+    bool found = !cdb.GetType(INCLUDE_LEAF).IsVoid();
+    uint32 i;
+    for (i=0u; (i<cdb.GetNumberOfChildren()) && (!found); i++) {
+        if (cdb.MoveToChild(i)) {
+            found = HasIncludes(cdb);
+            (void) cdb.MoveToAncestor(1u);
+        }
+    }
+    return found;
+}
+
+static bool ResolveNode(ConfigurationDatabase &cdb, const IncludeFrame &frame, const StreamString &directory, const char8 * const format);
+
+/**
+ * @brief Adds \a filename, followed by a '\0', to \a includedFilenames (if not NULL) unless it is already there.
+ */
+static void AddIncludedFilename(StreamString * const includedFilenames, const char8 * const filename) {
+    if (includedFilenames != NULL_PTR(StreamString *)) {
+        const char8 *listed = includedFilenames->Buffer();
+        const char8 *end = &listed[includedFilenames->Size()];
+        bool found = false;
+        while ((listed < end) && (!found)) {
+            found = (StringHelper::Compare(listed, filename) == 0);
+            listed = &listed[StringHelper::Length(listed) + 1u];
+        }
+        if (!found) {
+            uint32 writeSize = StringHelper::Length(filename) + 1u;
+            (void) includedFilenames->Write(filename, writeSize);
+        }
+    }
+}
+
+/**
+ * @brief Parses, composes and copies the fragment \a includeName, included by the file of \a frame, into \a fragment.
+ */
+static bool IncludeFragment(const StreamString &includeName, const IncludeFrame &frame, const StreamString &directory, const char8 * const format, ConfigurationDatabase &fragment) {
+    StreamString path;
+    if (includeName[0] == '/') {
+        path = includeName;
+    }
+    else {
+        (void) path.Printf("%s%s", directory.Buffer(), includeName.Buffer());
+    }
+    //The canonical name identifies the file, whatever the path used to include it
+    char8 *canonicalFilename = realpath(path.Buffer(), NULL_PTR(char8 *));
+    bool ok = (canonicalFilename != NULL_PTR(char8 *));
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to find %s, included by %s\n", path.Buffer(), frame.filename);
+    }
+    const IncludeFrame *including = &frame;
+    while ((ok) && (including != NULL_PTR(const IncludeFrame *))) {
+        ok = (StringHelper::Compare(including->filename, canonicalFilename) != 0);
+        including = including->parent;
+    }
+    if ((!ok) && (canonicalFilename != NULL_PTR(char8 *))) {
+        StreamString cycle;
+        (void) cycle.Printf("%s", canonicalFilename);
+        including = &frame;
+        bool closed = false;
+        while ((including != NULL_PTR(const IncludeFrame *)) && (!closed)) {
+            (void) cycle.Printf(" <- %s", including->filename);
+            closed = (StringHelper::Compare(including->filename, canonicalFilename) == 0);
+            including = including->parent;
+        }
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Include cycle %s\n", cycle.Buffer());
+    }
+    if (canonicalFilename != NULL_PTR(char8 *)) {
+        //Also listed if it cannot be parsed, so that a watcher knows that it must be fixed
+        AddIncludedFilename(frame.includedFilenames, canonicalFilename);
+    }
+    const char8 *fragmentFormat = format;
+    ConfigurationDatabase cached;
+    if (ok) {
+        fragmentFormat = GetFragmentFormat(canonicalFilename, format);
+        ok = GetFragment(canonicalFilename, fragmentFormat, cached);
+    }
+    if (ok) {
+        //The cached tree is shared, so that it is copied before being composed
+        ok = cached.MoveToRoot();
+    }
+    if (ok) {
+        ok = cached.Copy(fragment);
+    }
+    if (ok) {
+        ok = fragment.MoveToRoot();
+    }
+    if (ok) {
+        IncludeFrame fragmentFrame;
+        fragmentFrame.filename = canonicalFilename;
+        fragmentFrame.parent = &frame;
+        fragmentFrame.includedFilenames = frame.includedFilenames;
+        StreamString fragmentDirectory;
+        GetDirectory(canonicalFilename, fragmentDirectory);
+        ok = ResolveNode(fragment, fragmentFrame, fragmentDirectory, fragmentFormat);
+    }
+    if (ok) {
+        //The sidecar files of the fragment are also relative to its directory
+        ok = ConfigurationSidecar::Load(fragment, canonicalFilename);
+    }
+    if (canonicalFilename != NULL_PTR(char8 *)) {
+        free(canonicalFilename);
+    }
+    return ok;
+}
+
+/**
+ * @brief Replaces the Include leaves of \a cdb, from its current node, by the fragments that they refer to. On return \a cdb points at the same node.
+ * @param[in] frame the file from which \a cdb was parsed and the files which (recursively) include it.
+ * @param[in] directory the directory of the file from which \a cdb was parsed.
+ * @param[in] format the format of the file from which \a cdb was parsed.
+ */
+static bool ResolveNode(ConfigurationDatabase &cdb, const IncludeFrame &frame, const StreamString &directory, const char8 * const format) {
+    bool ok = true;
+    uint32 i;
+    for (i=0u; (i<cdb.GetNumberOfChildren()) && (ok); i++) {
+        if (cdb.MoveToChild(i)) {
+            ok = ResolveNode(cdb, frame, directory, format);
+            if (ok) {
+                ok = cdb.MoveToAncestor(1u);
+            }
+        }
+    }
+    AnyType includeType = cdb.GetType(INCLUDE_LEAF);
+    if ((ok) && (!includeType.IsVoid())) {
+        uint32 numberOfIncludes = (includeType.GetNumberOfDimensions() == 0u) ? 1u : includeType.GetNumberOfElements(0u);
+        StreamString *includeNames = new StreamString[numberOfIncludes];
+        if (includeType.GetNumberOfDimensions() == 0u) {
+            ok = cdb.Read(INCLUDE_LEAF, includeNames[0]);
+        }
+        else if (includeType.GetNumberOfDimensions() == 1u) {
+            Vector<StreamString> includeNamesVector(includeNames, numberOfIncludes);
+            ok = cdb.Read(INCLUDE_LEAF, includeNamesVector);
+        }
+        else {
+            ok = false;
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The %s of %s shall be a file name or a vector of file names\n", INCLUDE_LEAF, frame.filename);
+        }
+        ReferenceT<ReferenceContainer> node = cdb.GetCurrentNode();
+        //The fragment children to insert, without the ones overridden by the including node or by a previous fragment
+        ReferenceT<ReferenceContainer> included = Reference(new ReferenceContainer());
+        uint32 n;
+        for (n=0u; (n<numberOfIncludes) && (ok); n++) {
+            ConfigurationDatabase fragment;
+            ok = IncludeFragment(includeNames[n], frame, directory, format, fragment);
+            ReferenceT<ReferenceContainer> fragmentRoot;
+            if (ok) {
+                fragmentRoot = fragment.GetCurrentNode();
+                ok = fragmentRoot.IsValid();
+            }
+            uint32 c;
+            for (c=0u; (ok) && (c<fragmentRoot->Size()); c++) {
+                Reference child = fragmentRoot->Get(c);
+                bool overridden = node->Find(child->GetName()).IsValid();
+                if (!overridden) {
+                    overridden = included->Find(child->GetName()).IsValid();
+                }
+                if (!overridden) {
+                    ok = included->Insert(child);
+                }
+            }
+        }
+        delete [] includeNames;
+        //Insert the fragment children in place of the Include leaf
+        ReferenceT<ReferenceContainer> children = Reference(new ReferenceContainer());
+        for (i=0u; (i<node->Size()) && (ok); i++) {
+            ok = children->Insert(node->Get(i));
+        }
+        for (i=0u; (i<children->Size()) && (ok); i++) {
+            ok = node->Delete(children->Get(i));
+        }
+        for (i=0u; (i<children->Size()) && (ok); i++) {
+            Reference child = children->Get(i);
+            if (StringHelper::Compare(child->GetName(), INCLUDE_LEAF) == 0) {
+                uint32 c;
+                for (c=0u; (c<included->Size()) && (ok); c++) {
+                    ok = node->Insert(included->Get(c));
+                }
+            }
+            else {
+                ok = node->Insert(child);
+            }
+        }
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace ConfigurationInclude {
+
+bool Resolve(ConfigurationDatabase &cdb, const char8 * const configurationFilename, const char8 * const format, StreamString * const includedFilenames) {
+    if (includedFilenames != NULL_PTR(StreamString *)) {
+        *includedFilenames = "";
+    }
+    bool ok = cdb.MoveToRoot();
+    if ((ok) && (HasIncludes(cdb))) {
+        StreamString directory;
+        char8 *canonicalFilename = NULL_PTR(char8 *);
+        if (StringHelper::Compare(configurationFilename, "-") != 0) {
+            GetDirectory(configurationFilename, directory);
+            canonicalFilename = realpath(configurationFilename, NULL_PTR(char8 *));
+        }
+        IncludeFrame frame;
+        frame.filename = (canonicalFilename != NULL_PTR(char8 *)) ? canonicalFilename : configurationFilename;
+        frame.parent = NULL_PTR(const IncludeFrame *);
+        frame.includedFilenames = includedFilenames;
+        //The tree of cdb may be shared (e.g. with a ConfigurationCache), so that the composition is done on a copy
+        ConfigurationDatabase composed;
+        ok = cdb.Copy(composed);
+        if (ok) {
+            ok = composed.MoveToRoot();
+        }
+        if (ok) {
+            ok = ResolveNode(composed, frame, directory, format);
+        }
+        if (ok) {
+            cdb = composed;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to compose %s\n", configurationFilename);
+        }
+        if (canonicalFilename != NULL_PTR(char8 *)) {
+            free(canonicalFilename);
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,80 @@
+/**
+ * @file ConfigurationInclude.h
+ * @brief Header file for the ConfigurationInclude functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the ConfigurationInclude functions.
+ */
+
+#ifndef CONFIGURATIONINCLUDE_H_
+#define CONFIGURATIONINCLUDE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Composes a configuration from several files (fragments).
+ * @details A node (or the root) with a leaf named Include has the root contents of the included fragment (or fragments, if it is
+ * a vector) inserted in place of the leaf:
+ * <pre>
+ * Include = { "common/WebRoot.cfg" "common/StateMachine.cfg" }
+ * $App = {
+ *     Class = RealTimeApplication
+ *     +Data = {
+ *         Include = "common/Timings.cfg"
+ *         ...
+ * </pre>
+ * The fragments are resolved relative to the directory of the file which includes them, may include other fragments and may be
+ * in any of the formats (json and xml if their name ends with .json or .xml, the format of the including file otherwise).
+ * The children of the including node take precedence over the fragment children with the same name (and the first fragment over the
+ * following ones), so that a configuration can override part of a shared fragment.
+ *
+ * Each fragment is parsed once per process: the parsed fragments are cached in memory by the hash of their content. If the environment
+ * variable MARTe2_TOOLS_INCLUDE_CACHE is set to a directory, the parsed fragments are also stored there (named by their content hash),
+ * so that the following processes do not parse them again.
+ */
+namespace ConfigurationInclude {
+
+/**
+ * @brief Replaces the Include leaves of \a cdb by the fragments that they refer to.
+ * @param[in] configurationFilename the file from which \a cdb was parsed. The fragments are looked for relative to its directory
+ * (to the current directory if it is - or has no directory).
+ * @param[in] format the format of \a configurationFilename.
+ * @param[out] includedFilenames if not NULL, set to the canonical name of each fragment read (once, each followed by a '\0'), so
+ * that the tools can list (-MD) or watch (--watch) all the files of a composed configuration. Also set if the composition fails.
+ * @details If there are Include leaves \a cdb is replaced by a composed copy, i.e. the tree of \a cdb is never modified (so that it
+ * can be shared, e.g. with a ConfigurationCache). Include cycles are reported as errors. On return \a cdb points at its root.
+ */
+bool Resolve(ConfigurationDatabase &cdb, const char8 * const configurationFilename, const char8 * const format, StreamString * const includedFilenames = NULL_PTR(StreamString *));
+
+}
+
+}
+
+#endif /* CONFIGURATIONINCLUDE_H_ */
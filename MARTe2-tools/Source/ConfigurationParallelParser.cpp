@@ -0,0 +1,383 @@
+/**
+ * @file ConfigurationParallelParser.cpp
+ * @brief Source file for the ConfigurationParallelParser functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the ConfigurationParallelParser functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationCache.h"
+#include "ConfigurationParallelParser.h"
+#include "ParallelJobRunner.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Number of chunks per thread, so that a slow chunk does not leave the other threads idle.
+ */
+static const uint32 CHUNKS_PER_THREAD = 4u;
+
+/**
+ * @brief Cuts the content in chunks of at least targetSize bytes, at the candidate positions found by the pre-scan.
+ */
+class ChunkBalancer {
+public:
+    ChunkBalancer(uint32 * const chunkEndsIn, const uint32 maxNumberOfChunksIn, const uint32 size) {
+        chunkEnds = chunkEndsIn;
+        maxNumberOfChunks = maxNumberOfChunksIn;
+        numberOfChunks = 0u;
+        chunkStart = 0u;
+        targetSize = size / maxNumberOfChunks;
+    }
+
+    void Candidate(const uint32 position) {
+        if (((numberOfChunks + 1u) < maxNumberOfChunks) && ((position - chunkStart) >= targetSize)) {
+            chunkEnds[numberOfChunks] = position;
+            numberOfChunks++;
+            chunkStart = position;
+        }
+    }
+
+    uint32 Finish(const uint32 size) {
+        if ((numberOfChunks == 0u) || (chunkStart < size)) {
+            chunkEnds[numberOfChunks] = size;
+            numberOfChunks++;
+        }
+        return numberOfChunks;
+    }
+
+private:
+    uint32 *chunkEnds;
+    uint32 maxNumberOfChunks;
+    uint32 numberOfChunks;
+    uint32 chunkStart;
+    uint32 targetSize;
+};
+
+/**
+ * @brief Returns the position of the first occurrence of \a token at or after \a start, or \a size if not found.
+ */
+static uint32 FindToken(const char8 * const buffer, const uint32 size, const uint32 start, const char8 * const token) {
+    uint32 tokenSize = StringHelper::Length(token);
+    uint32 position = start;
+    bool found = false;
+    while (((position + tokenSize) <= size) && (!found)) {
+        found = (StringHelper::CompareN(&buffer[position], token, tokenSize) == 0);
+        if (!found) {
+            position++;
+        }
+    }
+    return found ? position : size;
+}
+
+/**
+ * @brief Returns true if the first non blank character of \a buffer is a {, i.e. if the json members are enclosed in a root object.
+ */
+static bool IsJsonObject(const char8 * const buffer, const uint32 size) {
+    uint32 i = 0u;
+    while ((i < size) && ((buffer[i] == ' ') || (buffer[i] == '\t') || (buffer[i] == '\r') || (buffer[i] == '\n'))) {
+        i++;
+    }
+    return (i < size) && (buffer[i] == '{');
+}
+
+/**
+ * @brief Pre-scans the cdb syntax: the candidates are after each } which closes a top-level block.
+ */
+static bool ScanCdb(const char8 * const buffer, const uint32 size, ChunkBalancer &balancer) {
+    uint32 depth = 0u;
+    bool ok = true;
+    uint32 i = 0u;
+    while ((i < size) && (ok)) {
+        char8 c = buffer[i];
+        char8 next = ((i + 1u) < size) ? buffer[i + 1u] : '\0';
+        if (c == '"') {
+            i = FindToken(buffer, size, i + 1u, "\"");
+            ok = (i < size);
+        }
+        else if ((c == '/') && (next == '/')) {
+            i = FindToken(buffer, size, i, "\n");
+        }
+        else if ((c == '/') && (next == '*')) {
+            i = FindToken(buffer, size, i + 2u, "*/");
+            ok = (i < size);
+            i++;
+        }
+        else if (c == '{') {
+            depth++;
+        }
+        else if (c == '}') {
+            ok = (depth > 0u);
+            if (ok) {
+                depth--;
+                if (depth == 0u) {
+                    balancer.Candidate(i + 1u);
+                }
+            }
+        }
+        else {
+            //Not structural
+        }
+        i++;
+    }
+    return (ok) && (depth == 0u);
+}
+
+/**
+ * @brief Pre-scans the json syntax: the candidates are after each comma which separates two top-level members.
+ */
+static bool ScanJson(const char8 * const buffer, const uint32 size, ChunkBalancer &balancer) {
+    const uint32 rootDepth = IsJsonObject(buffer, size) ? 1u : 0u;
+    uint32 depth = 0u;
+    bool ok = true;
+    uint32 i = 0u;
+    while ((i < size) && (ok)) {
+        char8 c = buffer[i];
+        if (c == '"') {
+            i++;
+            while ((i < size) && (buffer[i] != '"')) {
+                if (buffer[i] == '\\') {
+                    i++;
+                }
+                i++;
+            }
+            ok = (i < size);
+        }
+        else if ((c == '{') || (c == '[')) {
+            depth++;
+        }
+        else if ((c == '}') || (c == ']')) {
+            ok = (depth > 0u);
+            if (ok) {
+                depth--;
+            }
+        }
+        else if ((c == ',') && (depth == rootDepth)) {
+            balancer.Candidate(i + 1u);
+        }
+        else {
+            //Not structural
+        }
+        i++;
+    }
+    return (ok) && (depth == 0u);
+}
+
+/**
+ * @brief Pre-scans the xml syntax: the candidates are after each element which closes at the top-level.
+ */
+static bool ScanXml(const char8 * const buffer, const uint32 size, ChunkBalancer &balancer) {
+    uint32 depth = 0u;
+    bool ok = true;
+    uint32 i = 0u;
+    while ((i < size) && (ok)) {
+        if (buffer[i] == '<') {
+            char8 next = ((i + 1u) < size) ? buffer[i + 1u] : '\0';
+            if (FindToken(buffer, size, i, "<!--") == i) {
+                i = FindToken(buffer, size, i + 4u, "-->");
+                ok = (i < size);
+                i += 2u;
+            }
+            else if (FindToken(buffer, size, i, "<![CDATA[") == i) {
+                i = FindToken(buffer, size, i + 9u, "]]>");
+                ok = (i < size);
+                i += 2u;
+            }
+            else if ((next == '?') || (next == '!')) {
+                i = FindToken(buffer, size, i, ">");
+                ok = (i < size);
+            }
+            else {
+                bool closing = (next == '/');
+                //Find the end of the tag, skipping the quoted attribute values
+                char8 quote = '\0';
+                i++;
+                while ((i < size) && ((quote != '\0') || (buffer[i] != '>'))) {
+                    if (quote != '\0') {
+                        quote = (buffer[i] == quote) ? '\0' : quote;
+                    }
+                    else if ((buffer[i] == '"') || (buffer[i] == '\'')) {
+                        quote = buffer[i];
+                    }
+                    else {
+                        //Tag content
+                    }
+                    i++;
+                }
+                ok = (i < size);
+                if ((ok) && (closing)) {
+                    ok = (depth > 0u);
+                    if (ok) {
+                        depth--;
+                        if (depth == 0u) {
+                            balancer.Candidate(i + 1u);
+                        }
+                    }
+                }
+                else if ((ok) && (buffer[i - 1u] == '/')) {
+                    if (depth == 0u) {
+                        balancer.Candidate(i + 1u);
+                    }
+                }
+                else if (ok) {
+                    depth++;
+                }
+                else {
+                    //Unterminated tag
+                }
+            }
+        }
+        i++;
+    }
+    return (ok) && (depth == 0u);
+}
+
+/**
+ * One chunk to be parsed.
+ */
+struct ChunkJob {
+    StreamString text;
+    StreamString format;
+    ConfigurationDatabase cdb;
+    StreamString err;
+};
+
+/**
+ * @brief Parses the ChunkJob with index \a jobIndex (of the array \a context).
+ */
+static bool ParseChunkJob(void * const context, const uint32 jobIndex) {
+    ChunkJob *job = &(static_cast<ChunkJob *>(context)[jobIndex]);
+    return ConfigurationCache::Parse(job->text, job->format.Buffer(), job->cdb, job->err, 1u);
+}
+
+/**
+ * @brief Builds the text of a json chunk: the trailing comma is removed and, if the members are enclosed in a root object, the missing
+ * braces are added.
+ */
+static void BuildJsonChunk(const char8 * const buffer, const uint32 start, const uint32 end, const bool isObject, const bool isFirst, const bool isLast, StreamString &text) {
+    uint32 last = end;
+    while ((last > start) && ((buffer[last - 1u] == ' ') || (buffer[last - 1u] == '\t') || (buffer[last - 1u] == '\r') || (buffer[last - 1u] == '\n'))) {
+        last--;
+    }
+    if ((!isLast) && (last > start) && (buffer[last - 1u] == ',')) {
+        last--;
+    }
+    if ((isObject) && (!isFirst)) {
+        text += "{";
+    }
+    uint32 size = last - start;
+    (void) text.Write(&buffer[start], size);
+    if ((isObject) && (!isLast)) {
+        text += "}";
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace ConfigurationParallelParser {
+
+uint32 Split(const StreamString &content, const char8 * const format, const uint32 maxNumberOfChunks, uint32 * const chunkEnds) {
+    const char8 * const buffer = content.Buffer();
+    const uint32 size = static_cast<uint32>(content.Size());
+    uint32 numberOfChunks = 0u;
+    if (maxNumberOfChunks > 0u) {
+        ChunkBalancer balancer(chunkEnds, maxNumberOfChunks, size);
+        bool ok = false;
+        if (StringHelper::Compare(format, "cdb") == 0) {
+            ok = ScanCdb(buffer, size, balancer);
+        }
+        else if (StringHelper::Compare(format, "json") == 0) {
+            ok = ScanJson(buffer, size, balancer);
+        }
+        else if (StringHelper::Compare(format, "xml") == 0) {
+            ok = ScanXml(buffer, size, balancer);
+        }
+        else {
+            //Unknown format
+        }
+        if (ok) {
+            numberOfChunks = balancer.Finish(size);
+        }
+    }
+    return numberOfChunks;
+}
+
+bool Parse(StreamString &content, const char8 * const format, ConfigurationDatabase &cdb, StreamString &err, const uint32 numberOfThreads) {
+    ParallelJobRunner runner(numberOfThreads);
+    uint32 maxNumberOfChunks = runner.GetNumberOfThreads() * CHUNKS_PER_THREAD;
+    uint32 *chunkEnds = new uint32[maxNumberOfChunks];
+    uint32 numberOfChunks = 0u;
+    if (runner.GetNumberOfThreads() > 1u) {
+        numberOfChunks = Split(content, format, maxNumberOfChunks, chunkEnds);
+    }
+    bool ok = true;
+    bool parsed = false;
+    if (numberOfChunks > 1u) {
+        const char8 * const buffer = content.Buffer();
+        const bool isJson = (StringHelper::Compare(format, "json") == 0);
+        const bool isObject = (isJson) && (IsJsonObject(buffer, static_cast<uint32>(content.Size())));
+        ChunkJob *jobs = new ChunkJob[numberOfChunks];
+        uint32 start = 0u;
+        uint32 i;
+        for (i = 0u; i < numberOfChunks; i++) {
+            jobs[i].format = format;
+            if (isJson) {
+                BuildJsonChunk(buffer, start, chunkEnds[i], isObject, (i == 0u), ((i + 1u) == numberOfChunks), jobs[i].text);
+            }
+            else {
+                uint32 size = chunkEnds[i] - start;
+                (void) jobs[i].text.Write(&buffer[start], size);
+            }
+            start = chunkEnds[i];
+        }
+        parsed = runner.Run(&ParseChunkJob, jobs, numberOfChunks);
+        if (parsed) {
+            ok = cdb.MoveToRoot();
+            for (i = 0u; (i < numberOfChunks) && (ok); i++) {
+                ok = jobs[i].cdb.MoveToRoot();
+                if (ok) {
+                    ok = jobs[i].cdb.Copy(cdb);
+                }
+                if (ok) {
+                    ok = cdb.MoveToRoot();
+                }
+            }
+        }
+        delete [] jobs;
+    }
+    delete [] chunkEnds;
+    if (!parsed) {
+        ok = ConfigurationCache::Parse(content, format, cdb, err, 1u);
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,76 @@
+/**
+ * @file ConfigurationParallelParser.h
+ * @brief Header file for the ConfigurationParallelParser functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the ConfigurationParallelParser functions.
+ */
+
+#ifndef CONFIGURATIONPARALLELPARSER_H_
+#define CONFIGURATIONPARALLELPARSER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Parses the independent top-level subtrees of a configuration concurrently.
+ */
+namespace ConfigurationParallelParser {
+
+/**
+ * Contents smaller than this (in bytes) are not worth splitting.
+ */
+const uint32 MIN_PARALLEL_SIZE = 1048576u;
+
+/**
+ * @brief Splits \a content in (at most) \a maxNumberOfChunks chunks of similar size, each holding complete top-level subtrees.
+ * @details The pre-scan only tracks the nesting of blocks (cdb and json) or elements (xml), skipping quoted strings and comments. The
+ * chunks are cut after the end of a top-level node (cdb and xml) or after the comma which separates two top-level members (json).
+ * @param[in] content the configuration.
+ * @param[in] format one of cdb, json or xml.
+ * @param[in] maxNumberOfChunks the maximum number of chunks.
+ * @param[out] chunkEnds the (exclusive) end offset of each chunk. The first chunk starts at zero and each other chunk at the end of the previous.
+ * @return the number of chunks, or zero if the structure of \a content is not valid (e.g. unbalanced blocks or an unterminated string).
+ */
+uint32 Split(const StreamString &content, const char8 * const format, const uint32 maxNumberOfChunks, uint32 * const chunkEnds);
+
+/**
+ * @brief Parses \a content, in the given \a format, into \a cdb, parsing the chunks returned by Split concurrently.
+ * @details The chunks are merged into \a cdb in their original order. If \a content cannot be split, or if any chunk fails to parse,
+ * \a content is parsed serially, so that the errors refer to the original line numbers.
+ * @param[in] numberOfThreads the number of threads. If zero one per processor is used.
+ * @return true if \a content was successfully parsed.
+ */
+bool Parse(StreamString &content, const char8 * const format, ConfigurationDatabase &cdb, StreamString &err, const uint32 numberOfThreads = 0u);
+
+}
+
+}
+
+#endif /* CONFIGURATIONPARALLELPARSER_H_ */
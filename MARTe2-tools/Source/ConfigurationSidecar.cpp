@@ -0,0 +1,554 @@
+/**
+ * @file ConfigurationSidecar.cpp
+ * @brief Source file for the ConfigurationSidecar functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the ConfigurationSidecar functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationCanonicalForm.h"
+#include "ConfigurationSidecar.h"
+#include "Directory.h"
+#include "File.h"
+#include "Matrix.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+#include "TypeDescriptor.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The first bytes of a sidecar file.
+ */
+static const char8 * const SIDECAR_MAGIC = "MARTe2SC";
+
+/**
+ * Size of SIDECAR_MAGIC.
+ */
+static const uint32 SIDECAR_MAGIC_SIZE = 8u;
+
+/**
+ * Version of the sidecar file format.
+ */
+static const uint32 SIDECAR_VERSION = 1u;
+
+/**
+ * Size of the header (magic, version and a reserved word). The first array starts right after it.
+ */
+static const uint32 SIDECAR_HEADER_SIZE = 16u;
+
+/**
+ * Each array starts at a multiple of this number of bytes, so that it can be used in place from a memory mapped file.
+ */
+static const uint32 SIDECAR_ALIGNMENT = 8u;
+
+/**
+ * Size of the write buffer of the sidecar file.
+ */
+static const uint32 SIDECAR_BUFFER_SIZE = 65536u;
+
+/**
+ * The sidecar file being written by Extract.
+ */
+struct SidecarWriter {
+    File file;
+
+    /**
+     * The name written in the SidecarFile leaves (without directory).
+     */
+    StreamString name;
+
+    /**
+     * Number of bytes written so far.
+     */
+    uint64 position;
+
+    uint32 minimumNumberOfElements;
+};
+
+/**
+ * The sidecar file mapped by Load. Consecutive references to the same file share the mapping.
+ */
+struct SidecarMapping {
+    StreamString filename;
+    const char8 *data;
+    uint64 size;
+};
+
+/**
+ * @brief Returns true if \a td is an integer or floating point type which can be stored in a sidecar file.
+ */
+static bool IsNumericType(const TypeDescriptor &td) {
+    bool numeric = (!td.isStructuredData);
+    if (numeric) {
+        numeric = ((td.type == SignedInteger) || (td.type == UnsignedInteger) || (td.type == Float));
+    }
+    if (numeric) {
+        numeric = ((td.numberOfBits == 8u) || (td.numberOfBits == 16u) || (td.numberOfBits == 32u) || (td.numberOfBits == 64u));
+    }
+    return numeric;
+}
+
+/**
+ * @brief Writes \a size bytes of \a data into the sidecar file, at the next aligned position.
+ * @param[out] offset where the data was written.
+ */
+static bool WriteAligned(SidecarWriter &writer, const char8 * const data, const uint32 size, uint64 &offset) {
+    const char8 padding[SIDECAR_ALIGNMENT] = { '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0' };
+    uint32 paddingSize = static_cast<uint32>((SIDECAR_ALIGNMENT - (writer.position % SIDECAR_ALIGNMENT)) % SIDECAR_ALIGNMENT);
+    bool ok = true;
+    if (paddingSize > 0u) {
+        ok = writer.file.Write(&padding[0], paddingSize);
+        writer.position += paddingSize;
+    }
+    offset = writer.position;
+    if (ok) {
+        uint32 writeSize = size;
+        ok = writer.file.Write(data, writeSize);
+        writer.position += size;
+    }
+    return ok;
+}
+
+/**
+ * @brief Converts the text \a values into an array of numbers, only if the values can be converted exactly: into an uint64 array if all of
+ * them are non-negative decimal integers, into an int64 array if all of them are decimal integers and into a float64 array if none of
+ * them is an integer (mixing integers and non integers would turn the integers into floats).
+ * @param[out] data the converted array, with 8 bytes per element, to be deleted by the caller. NULL if the values cannot be converted
+ * exactly (the array is then left inline).
+ * @param[out] type UnsignedInteger64Bit, SignedInteger64Bit or Float64Bit.
+ */
+static void ConvertText(const StreamString * const values, const uint32 numberOfElements, char8 *&data, TypeDescriptor &type) {
+    bool allNumbers = true;
+    uint32 numberOfIntegers = 0u;
+    bool anyNegative = false;
+    uint32 e;
+    for (e = 0u; (e < numberOfElements) && (allNumbers); e++) {
+        bool isInteger = false;
+        allNumbers = ConfigurationCanonicalForm::IsDecimalNumber(values[e].Buffer(), isInteger);
+        if (isInteger) {
+            numberOfIntegers++;
+        }
+        if (values[e].Buffer()[0] == '-') {
+            anyNegative = true;
+        }
+    }
+    bool allIntegers = (numberOfIntegers == numberOfElements);
+    bool exact = (allNumbers) && ((allIntegers) || (numberOfIntegers == 0u));
+    data = NULL_PTR(char8 *);
+    if (exact) {
+        data = new char8[numberOfElements * 8u];
+    }
+    if ((exact) && (allIntegers)) {
+        errno = 0;
+        if (anyNegative) {
+            int64 *integers = reinterpret_cast<int64 *>(data);
+            type = SignedInteger64Bit;
+            for (e = 0u; e < numberOfElements; e++) {
+                integers[e] = static_cast<int64>(strtoll(values[e].Buffer(), NULL_PTR(char8 **), 10));
+            }
+        }
+        else {
+            uint64 *integers = reinterpret_cast<uint64 *>(data);
+            type = UnsignedInteger64Bit;
+            for (e = 0u; e < numberOfElements; e++) {
+                integers[e] = static_cast<uint64>(strtoull(values[e].Buffer(), NULL_PTR(char8 **), 10));
+            }
+        }
+        //At least one value does not fit in 64 bits
+        exact = (errno != ERANGE);
+    }
+    else if (exact) {
+        float64 *floats = reinterpret_cast<float64 *>(data);
+        type = Float64Bit;
+        for (e = 0u; e < numberOfElements; e++) {
+            floats[e] = strtod(values[e].Buffer(), NULL_PTR(char8 **));
+        }
+    }
+    else {
+        //Left inline
+    }
+    if ((!exact) && (data != NULL_PTR(char8 *))) {
+        delete [] data;
+        data = NULL_PTR(char8 *);
+    }
+}
+
+/**
+ * @brief Reads the array leaf \a name of the current node as a contiguous array of numbers.
+ * @param[out] data the array, to be deleted by the caller. NULL if the leaf is not numeric.
+ * @param[out] type the type of the elements of \a data.
+ */
+static bool ReadNumericArray(ConfigurationDatabase &cdb, const char8 * const name, const uint8 numberOfDimensions, const uint32 numberOfRows, const uint32 numberOfColumns,
+                             char8 *&data, TypeDescriptor &type) {
+    AnyType leaf = cdb.GetType(name);
+    TypeDescriptor td = leaf.GetTypeDescriptor();
+    uint32 numberOfElements = numberOfRows * numberOfColumns;
+    bool ok = true;
+    data = NULL_PTR(char8 *);
+    if (IsNumericType(td)) {
+        //Already typed (e.g. loaded from a sidecar file), no text conversion
+        type = td;
+        type.isConstant = false;
+        data = new char8[numberOfElements * (td.numberOfBits / 8u)];
+        AnyType destination(type, 0u, static_cast<void *>(data));
+        destination.SetNumberOfDimensions(numberOfDimensions);
+        destination.SetNumberOfElements(0u, numberOfColumns);
+        if (numberOfDimensions > 1u) {
+            destination.SetNumberOfElements(1u, numberOfRows);
+        }
+        ok = cdb.Read(name, destination);
+    }
+    else {
+        StreamString *values = new StreamString[numberOfElements];
+        if (numberOfDimensions == 1u) {
+            Vector<StreamString> vec(values, numberOfColumns);
+            ok = cdb.Read(name, vec);
+        }
+        else {
+            Matrix<StreamString> mat(values, numberOfRows, numberOfColumns);
+            ok = cdb.Read(name, mat);
+        }
+        if (ok) {
+            ConvertText(values, numberOfElements, data, type);
+        }
+        delete [] values;
+    }
+    if ((!ok) && (data != NULL_PTR(char8 *))) {
+        delete [] data;
+        data = NULL_PTR(char8 *);
+    }
+    return ok;
+}
+
+/**
+ * @brief Moves the leaf \a name of the current node into the sidecar file if it is a large enough numeric array.
+ */
+static bool ExtractLeaf(ConfigurationDatabase &cdb, SidecarWriter &writer, const StreamString &name) {
+    AnyType leaf = cdb.GetType(name.Buffer());
+    uint8 numberOfDimensions = leaf.GetNumberOfDimensions();
+    bool ok = true;
+    if ((numberOfDimensions == 1u) || (numberOfDimensions == 2u)) {
+        uint32 numberOfColumns = leaf.GetNumberOfElements(0u);
+        uint32 numberOfRows = (numberOfDimensions > 1u) ? leaf.GetNumberOfElements(1u) : 1u;
+        uint32 numberOfElements = numberOfColumns * numberOfRows;
+        char8 *data = NULL_PTR(char8 *);
+        TypeDescriptor type = InvalidType;
+        if (numberOfElements >= writer.minimumNumberOfElements) {
+            ok = ReadNumericArray(cdb, name.Buffer(), numberOfDimensions, numberOfRows, numberOfColumns, data, type);
+        }
+        uint64 offset = 0u;
+        if ((ok) && (data != NULL_PTR(char8 *))) {
+            ok = WriteAligned(writer, data, numberOfElements * (type.numberOfBits / 8u), offset);
+            if (ok) {
+                ok = cdb.Delete(name.Buffer());
+            }
+            if (ok) {
+                ok = cdb.CreateRelative(name.Buffer());
+            }
+            if (ok) {
+                ok = cdb.Write("SidecarFile", writer.name);
+            }
+            if (ok) {
+                ok = cdb.Write("SidecarType", TypeDescriptor::GetTypeNameFromTypeDescriptor(type));
+            }
+            if (ok) {
+                ok = cdb.Write("SidecarOffset", offset);
+            }
+            if (ok) {
+                uint32 dimensions[2] = { numberOfRows, numberOfColumns };
+                if (numberOfDimensions == 1u) {
+                    Vector<uint32> vec(&dimensions[1], 1u);
+                    ok = cdb.Write("SidecarDimensions", vec);
+                }
+                else {
+                    Vector<uint32> vec(&dimensions[0], 2u);
+                    ok = cdb.Write("SidecarDimensions", vec);
+                }
+            }
+            if (ok) {
+                ok = cdb.MoveToAncestor(1u);
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to move %s into the sidecar file", name.Buffer());
+            }
+        }
+        if (data != NULL_PTR(char8 *)) {
+            delete [] data;
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Extracts the arrays of the subtree of the current node.
+ */
+static bool ExtractNode(ConfigurationDatabase &cdb, SidecarWriter &writer) {
+    uint32 numberOfChildren = cdb.GetNumberOfChildren();
+    StreamString *leaves = new StreamString[numberOfChildren];
+    uint32 numberOfLeaves = 0u;
+    bool ok = true;
+    uint32 i;
+    //The child nodes first, as replacing the leaves changes the order of the children
+    for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+        if (cdb.MoveToChild(i)) {
+            ok = ExtractNode(cdb, writer);
+            if (!cdb.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+        else {
+            leaves[numberOfLeaves] = cdb.GetChildName(i);
+            numberOfLeaves++;
+        }
+    }
+    for (i = 0u; (i < numberOfLeaves) && (ok); i++) {
+        ok = ExtractLeaf(cdb, writer, leaves[i]);
+    }
+    delete [] leaves;
+    return ok;
+}
+
+/**
+ * @brief Maps the sidecar file \a filename into \a mapping (unless it is already mapped) and checks its header.
+ */
+static bool MapSidecar(SidecarMapping &mapping, const StreamString &filename) {
+    bool ok = true;
+    if ((mapping.data == NULL_PTR(const char8 *)) || (mapping.filename != filename)) {
+        if (mapping.data != NULL_PTR(const char8 *)) {
+            (void) munmap(const_cast<char8 *>(mapping.data), static_cast<size_t>(mapping.size));
+            mapping.data = NULL_PTR(const char8 *);
+        }
+        mapping.filename = filename;
+        int32 fd = open(filename.Buffer(), O_RDONLY);
+        ok = (fd >= 0);
+        struct stat fileStatus;
+        if (ok) {
+            ok = (fstat(fd, &fileStatus) == 0);
+        }
+        if (ok) {
+            mapping.size = static_cast<uint64>(fileStatus.st_size);
+            ok = (mapping.size >= SIDECAR_HEADER_SIZE);
+        }
+        if (ok) {
+            void *address = mmap(NULL_PTR(void *), static_cast<size_t>(mapping.size), PROT_READ, MAP_PRIVATE, fd, 0);
+            ok = (address != MAP_FAILED);
+            if (ok) {
+                mapping.data = static_cast<const char8 *>(address);
+            }
+        }
+        if (fd >= 0) {
+            (void) close(fd);
+        }
+        if (ok) {
+            uint32 version = 0u;
+            ok = (MemoryOperationsHelper::Compare(mapping.data, SIDECAR_MAGIC, SIDECAR_MAGIC_SIZE) == 0);
+            if (ok) {
+                (void) MemoryOperationsHelper::Copy(&version, &mapping.data[SIDECAR_MAGIC_SIZE], static_cast<uint32>(sizeof(uint32)));
+                ok = (version == SIDECAR_VERSION);
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to map the sidecar file %s", filename.Buffer());
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Replaces the reference node \a name of the current node by the array that it refers to.
+ */
+static bool LoadReference(ConfigurationDatabase &cdb, const StreamString &name, const StreamString &directory, SidecarMapping &mapping) {
+    StreamString file;
+    StreamString typeName;
+    uint64 offset = 0u;
+    uint32 dimensions[2] = { 1u, 1u };
+    uint32 numberOfDimensions = 0u;
+    bool ok = cdb.MoveRelative(name.Buffer());
+    if (ok) {
+        ok = cdb.Read("SidecarFile", file);
+        if (ok) {
+            ok = cdb.Read("SidecarType", typeName);
+        }
+        if (ok) {
+            ok = cdb.Read("SidecarOffset", offset);
+        }
+        if (ok) {
+            AnyType dimensionsLeaf = cdb.GetType("SidecarDimensions");
+            numberOfDimensions = (dimensionsLeaf.GetNumberOfDimensions() == 1u) ? dimensionsLeaf.GetNumberOfElements(0u) : 0u;
+            ok = ((numberOfDimensions == 1u) || (numberOfDimensions == 2u));
+        }
+        if (ok) {
+            //A vector only has the number of columns
+            Vector<uint32> vec(&dimensions[2u - numberOfDimensions], numberOfDimensions);
+            ok = cdb.Read("SidecarDimensions", vec);
+        }
+        if (!cdb.MoveToAncestor(1u)) {
+            ok = false;
+        }
+    }
+    TypeDescriptor type = InvalidType;
+    if (ok) {
+        type = TypeDescriptor::GetTypeDescriptorFromTypeName(typeName.Buffer());
+        ok = IsNumericType(type);
+    }
+    if (ok) {
+        StreamString filename;
+        if (file.Buffer()[0] == '/') {
+            filename = file;
+        }
+        else {
+            (void) filename.Printf("%s%s", directory.Buffer(), file.Buffer());
+        }
+        ok = MapSidecar(mapping, filename);
+    }
+    uint64 size = static_cast<uint64>(dimensions[0]) * static_cast<uint64>(dimensions[1]) * static_cast<uint64>(type.numberOfBits / 8u);
+    if (ok) {
+        ok = (offset >= SIDECAR_HEADER_SIZE) && ((offset % SIDECAR_ALIGNMENT) == 0u) && (size <= mapping.size) && (offset <= (mapping.size - size));
+    }
+    if (ok) {
+        //Copied straight from the mapped file
+        AnyType source(type, 0u, static_cast<const void *>(&mapping.data[offset]));
+        source.SetNumberOfDimensions(static_cast<uint8>(numberOfDimensions));
+        source.SetNumberOfElements(0u, dimensions[1]);
+        if (numberOfDimensions > 1u) {
+            source.SetNumberOfElements(1u, dimensions[0]);
+        }
+        ok = cdb.Delete(name.Buffer());
+        if (ok) {
+            ok = cdb.Write(name.Buffer(), source);
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid sidecar reference %s", name.Buffer());
+    }
+    return ok;
+}
+
+/**
+ * @brief Loads the references of the subtree of the current node.
+ */
+static bool LoadNode(ConfigurationDatabase &cdb, const StreamString &directory, SidecarMapping &mapping) {
+    uint32 numberOfChildren = cdb.GetNumberOfChildren();
+    StreamString *references = new StreamString[numberOfChildren];
+    uint32 numberOfReferences = 0u;
+    bool ok = true;
+    uint32 i;
+    for (i = 0u; (i < numberOfChildren) && (ok); i++) {
+        if (cdb.MoveToChild(i)) {
+            if (cdb.GetType("SidecarFile").IsVoid()) {
+                ok = LoadNode(cdb, directory, mapping);
+            }
+            else {
+                references[numberOfReferences] = cdb.GetName();
+                numberOfReferences++;
+            }
+            if (!cdb.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+    }
+    for (i = 0u; (i < numberOfReferences) && (ok); i++) {
+        ok = LoadReference(cdb, references[i], directory, mapping);
+    }
+    delete [] references;
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace ConfigurationSidecar {
+
+bool Extract(ConfigurationDatabase &cdb, const char8 * const sidecarFilename, const uint32 minimumNumberOfElements) {
+    SidecarWriter writer;
+    const char8 *baseName = StringHelper::SearchLastChar(sidecarFilename, '/');
+    writer.name = (baseName != NULL_PTR(const char8 *)) ? &baseName[1] : sidecarFilename;
+    writer.position = 0u;
+    //Empty arrays are never moved
+    writer.minimumNumberOfElements = (minimumNumberOfElements > 0u) ? minimumNumberOfElements : 1u;
+    Directory d(sidecarFilename);
+    d.Delete();
+    bool ok = writer.file.Open(sidecarFilename, BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT);
+    if (ok) {
+        ok = writer.file.SetBufferSize(0u, SIDECAR_BUFFER_SIZE);
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to open file %s\n", sidecarFilename);
+    }
+    if (ok) {
+        char8 header[SIDECAR_HEADER_SIZE];
+        uint32 version = SIDECAR_VERSION;
+        (void) MemoryOperationsHelper::Set(&header[0], '\0', SIDECAR_HEADER_SIZE);
+        (void) MemoryOperationsHelper::Copy(&header[0], SIDECAR_MAGIC, SIDECAR_MAGIC_SIZE);
+        (void) MemoryOperationsHelper::Copy(&header[SIDECAR_MAGIC_SIZE], &version, static_cast<uint32>(sizeof(uint32)));
+        uint32 writeSize = SIDECAR_HEADER_SIZE;
+        ok = writer.file.Write(&header[0], writeSize);
+        writer.position = SIDECAR_HEADER_SIZE;
+    }
+    if (ok) {
+        ok = ExtractNode(cdb, writer);
+    }
+    if (ok) {
+        ok = writer.file.Flush();
+    }
+    if (writer.file.IsOpen()) {
+        if (!writer.file.Close()) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+bool Load(ConfigurationDatabase &cdb, const char8 * const configurationFilename) {
+    StreamString directory;
+    const char8 *lastSeparator = StringHelper::SearchLastChar(configurationFilename, '/');
+    if (lastSeparator != NULL_PTR(const char8 *)) {
+        uint32 directorySize = static_cast<uint32>(lastSeparator - configurationFilename) + 1u;
+        (void) directory.Write(configurationFilename, directorySize);
+    }
+    SidecarMapping mapping;
+    mapping.data = NULL_PTR(const char8 *);
+    mapping.size = 0u;
+    bool ok = LoadNode(cdb, directory, mapping);
+    if (mapping.data != NULL_PTR(const char8 *)) {
+        (void) munmap(const_cast<char8 *>(mapping.data), static_cast<size_t>(mapping.size));
+    }
+    return ok;
+}
+
+}
+
+}
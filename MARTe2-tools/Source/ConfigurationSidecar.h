@@ -0,0 +1,80 @@
+/**
+ * @file ConfigurationSidecar.h
+ * @brief Header file for the ConfigurationSidecar functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the ConfigurationSidecar functions.
+ */
+
+#ifndef CONFIGURATIONSIDECAR_H_
+#define CONFIGURATIONSIDECAR_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Moves the large numeric arrays of a configuration into a binary sidecar file, and loads them back.
+ * @details The sidecar file starts with a 16 bytes header (the magic "MARTe2SC", the version and a reserved word). It is followed
+ * by the arrays, each one aligned to 8 bytes, with its elements in the native byte order and (for matrices) row after row, so that
+ * the file can be memory mapped and the arrays copied into the ConfigurationDatabase without any text conversion.
+ *
+ * Each extracted leaf is replaced by a reference node with the same name:
+ * <pre>
+ * Table = {
+ *     SidecarFile = "RTApp-1.bin"
+ *     SidecarType = "float64"
+ *     SidecarOffset = 16
+ *     SidecarDimensions = { 1000 }
+ * }
+ * </pre>
+ * SidecarDimensions has one element (the number of elements) for vectors and two (the number of rows and columns) for matrices.
+ * SidecarFile has no directory: it is looked for in the directory of the configuration which refers to it.
+ */
+namespace ConfigurationSidecar {
+
+/**
+ * @brief Moves all the numeric array leaves of \a cdb (from its current node) with at least \a minimumNumberOfElements into the sidecar
+ * file \a sidecarFilename (which is replaced), and replaces them by reference nodes.
+ * @details Typed leaves keep their type. Arrays written as text are stored as int64 if all their elements are decimal integers and as
+ * float64 otherwise. Arrays with any non-numeric element are not moved. On return \a cdb points at the same node.
+ */
+bool Extract(ConfigurationDatabase &cdb, const char8 * const sidecarFilename, const uint32 minimumNumberOfElements);
+
+/**
+ * @brief Replaces all the reference nodes of \a cdb (from its current node) by the arrays that they refer to.
+ * @param[in] configurationFilename the file from which \a cdb was parsed. The sidecar files are looked for in its directory
+ * (in the current directory if it is - or has no directory).
+ * @details On return \a cdb points at the same node.
+ */
+bool Load(ConfigurationDatabase &cdb, const char8 * const configurationFilename);
+
+}
+
+}
+
+#endif /* CONFIGURATIONSIDECAR_H_ */
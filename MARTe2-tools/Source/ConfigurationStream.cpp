@@ -0,0 +1,472 @@
+/**
+ * @file ConfigurationStream.cpp
+ * @brief Source file for class ConfigurationStream
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ConfigurationStream (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationStream.h"
+#include "Diagnostics.h"
+#include "Sleep.h"
+#include "StringHelper.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Maximum number of parsed documents waiting to be printed. Two are enough to keep the reader one document ahead of the printer.
+ */
+static const uint32 CONFIGURATION_STREAM_DEPTH = 2u;
+
+/**
+ * Size of the input buffer.
+ */
+static const uint32 CONFIGURATION_STREAM_BUFFER_SIZE = 65536u;
+
+/**
+ * Maximum size of a document framed by its length.
+ */
+static const uint64 CONFIGURATION_STREAM_MAX_DOCUMENT_SIZE = 1073741824u;
+
+/**
+ * @brief Returns true if \a line only contains blanks.
+ */
+static bool IsBlank(const StreamString &line) {
+    const char8 * const text = line.Buffer();
+    bool blank = true;
+    uint32 i;
+    for (i = 0u; (i < line.Size()) && (blank); i++) {
+        blank = ((text[i] == ' ') || (text[i] == '\t') || (text[i] == '\r'));
+    }
+    return blank;
+}
+
+/**
+ * @brief Returns the size of \a line without the trailing carriage return (if any).
+ */
+static uint32 LineSize(const StreamString &line) {
+    uint32 size = static_cast<uint32>(line.Size());
+    if ((size > 0u) && (line.Buffer()[size - 1u] == '\r')) {
+        size--;
+    }
+    return size;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+ConfigurationStream::ConfigurationStream(const int32 inputFdIn, const int32 outputFdIn, const char8 * const inputFormatIn, const char8 * const delimiterIn) {
+    inputFd = inputFdIn;
+    outputFd = outputFdIn;
+    inputFormat = inputFormatIn;
+    useDelimiter = (delimiterIn != NULL_PTR(const char8 *));
+    if (useDelimiter) {
+        delimiter = delimiterIn;
+    }
+    buffer = new char8[CONFIGURATION_STREAM_BUFFER_SIZE];
+    bufferSize = 0u;
+    bufferPosition = 0u;
+    documents = new Document*[CONFIGURATION_STREAM_DEPTH];
+    documentsFirst = 0u;
+    documentsSize = 0u;
+    readerDone = false;
+    framingOk = true;
+    (void) documentSem.Create();
+    (void) slotSem.Create();
+    (void) readerDoneSem.Create();
+}
+
+ConfigurationStream::~ConfigurationStream() {
+    delete [] buffer;
+    delete [] documents;
+    (void) documentSem.Close();
+    (void) slotSem.Close();
+    (void) readerDoneSem.Close();
+}
+
+int32 ConfigurationStream::OpenInput(const char8 * const filename) {
+    int32 fd = STDIN_FILENO;
+    if (StringHelper::Compare(filename, "-") != 0) {
+        fd = open(filename, O_RDONLY);
+    }
+    return fd;
+}
+
+int32 ConfigurationStream::OpenOutput(const char8 * const filename) {
+    int32 fd = STDOUT_FILENO;
+    if (StringHelper::Compare(filename, "-") != 0) {
+        fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    return fd;
+}
+
+bool ConfigurationStream::Close(const int32 fd) {
+    bool ok = true;
+    if (fd > STDERR_FILENO) {
+        ok = (close(fd) == 0);
+    }
+    return ok;
+}
+
+bool ConfigurationStream::ReadAll(const int32 fd, StreamString &content) {
+    char8 *readBuffer = new char8[CONFIGURATION_STREAM_BUFFER_SIZE];
+    bool ok = true;
+    bool done = false;
+    while ((ok) && (!done)) {
+        ssize_t n = read(fd, readBuffer, static_cast<size_t>(CONFIGURATION_STREAM_BUFFER_SIZE));
+        if (n > 0) {
+            uint32 writeSize = static_cast<uint32>(n);
+            ok = content.Write(readBuffer, writeSize);
+        }
+        else if (n == 0) {
+            done = true;
+        }
+        else if (errno == EINTR) {
+            //Retry
+        }
+        else {
+            ok = false;
+        }
+    }
+    delete [] readBuffer;
+    if (ok) {
+        ok = content.Seek(0LLU);
+    }
+    return ok;
+}
+
+bool ConfigurationStream::WriteAll(const int32 fd, const char8 * const buffer, const uint32 size) {
+    uint32 total = 0u;
+    bool ok = true;
+    while ((ok) && (total < size)) {
+        ssize_t n = write(fd, &buffer[total], static_cast<size_t>(size - total));
+        if (n > 0) {
+            total += static_cast<uint32>(n);
+        }
+        else if ((n < 0) && (errno == EINTR)) {
+            //Retry
+        }
+        else {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+bool ConfigurationStream::Fill() {
+    bool filled = false;
+    bool done = false;
+    while (!done) {
+        ssize_t n = read(inputFd, buffer, static_cast<size_t>(CONFIGURATION_STREAM_BUFFER_SIZE));
+        if (n > 0) {
+            bufferSize = static_cast<uint32>(n);
+            bufferPosition = 0u;
+            filled = true;
+            done = true;
+        }
+        else if ((n < 0) && (errno == EINTR)) {
+            //Retry
+        }
+        else {
+            if (n < 0) {
+                REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to read the input stream");
+            }
+            done = true;
+        }
+    }
+    return filled;
+}
+
+bool ConfigurationStream::ReadLine(StreamString &line) {
+    bool read = false;
+    bool done = false;
+    while (!done) {
+        if (bufferPosition == bufferSize) {
+            done = !Fill();
+        }
+        if (!done) {
+            uint32 start = bufferPosition;
+            while ((bufferPosition < bufferSize) && (buffer[bufferPosition] != '\n')) {
+                bufferPosition++;
+            }
+            uint32 size = bufferPosition - start;
+            if (size > 0u) {
+                (void) line.Write(&buffer[start], size);
+            }
+            read = true;
+            if (bufferPosition < bufferSize) {
+                //Skip the terminator
+                bufferPosition++;
+                done = true;
+            }
+        }
+    }
+    return read;
+}
+
+bool ConfigurationStream::ReadBytes(const uint32 size, StreamString &content) {
+    uint32 missing = size;
+    bool ok = true;
+    while ((ok) && (missing > 0u)) {
+        if (bufferPosition == bufferSize) {
+            ok = Fill();
+        }
+        if (ok) {
+            uint32 available = bufferSize - bufferPosition;
+            uint32 copySize = (available < missing) ? available : missing;
+            ok = content.Write(&buffer[bufferPosition], copySize);
+            bufferPosition += copySize;
+            missing -= copySize;
+        }
+    }
+    return ok;
+}
+
+bool ConfigurationStream::ReadDocument(StreamString &content, bool &end) {
+    bool ok = true;
+    if (useDelimiter) {
+        bool hasContent = false;
+        bool found = false;
+        bool more = true;
+        const uint32 delimiterSize = static_cast<uint32>(delimiter.Size());
+        while ((more) && (!found)) {
+            StreamString line;
+            more = ReadLine(line);
+            if (more) {
+                found = (LineSize(line) == delimiterSize) && (StringHelper::CompareN(line.Buffer(), delimiter.Buffer(), delimiterSize) == 0);
+                if (!found) {
+                    content += line;
+                    content += "\n";
+                    if (!IsBlank(line)) {
+                        hasContent = true;
+                    }
+                }
+            }
+        }
+        //A delimiter after the last document does not start a new one
+        end = (!found) && (!hasContent);
+    }
+    else {
+        StreamString line;
+        bool more = true;
+        bool blank = true;
+        while ((more) && (blank)) {
+            line = "";
+            more = ReadLine(line);
+            blank = (more) && (IsBlank(line));
+        }
+        end = !more;
+        if (more) {
+            const uint32 lineSize = LineSize(line);
+            uint64 size = 0u;
+            uint32 i;
+            for (i = 0u; (i < lineSize) && (ok); i++) {
+                char8 c = line.Buffer()[i];
+                ok = (c >= '0') && (c <= '9');
+                if (ok) {
+                    size = (size * 10u) + static_cast<uint64>(c - '0');
+                    ok = (size <= CONFIGURATION_STREAM_MAX_DOCUMENT_SIZE);
+                }
+            }
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid document length %s", line.Buffer());
+            }
+            if (ok) {
+                ok = ReadBytes(static_cast<uint32>(size), content);
+                if (!ok) {
+                    REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The input ended before the end of the document (%llu bytes)", size);
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+bool ConfigurationStream::WriteDocument(const StreamString &content) {
+    StreamString frame;
+    const uint32 size = static_cast<uint32>(content.Size());
+    bool ok = true;
+    if (!useDelimiter) {
+        ok = frame.Printf("%u\n", size);
+    }
+    if (ok) {
+        ok = WriteAll(outputFd, frame.Buffer(), static_cast<uint32>(frame.Size()));
+    }
+    if (ok) {
+        ok = WriteAll(outputFd, content.Buffer(), size);
+    }
+    if ((ok) && (useDelimiter)) {
+        frame = "";
+        if ((size > 0u) && (content.Buffer()[size - 1u] != '\n')) {
+            frame += "\n";
+        }
+        frame += delimiter;
+        frame += "\n";
+        ok = WriteAll(outputFd, frame.Buffer(), static_cast<uint32>(frame.Size()));
+    }
+    return ok;
+}
+
+void ConfigurationStream::PushDocument(Document * const document) {
+    bool done = false;
+    while (!done) {
+        (void) mux.FastLock();
+        if (documentsSize < CONFIGURATION_STREAM_DEPTH) {
+            documents[(documentsFirst + documentsSize) % CONFIGURATION_STREAM_DEPTH] = document;
+            documentsSize++;
+            (void) documentSem.Post();
+            done = true;
+        }
+        else {
+            //Reset while holding the lock, so that a Post after a pop cannot be lost
+            (void) slotSem.Reset();
+        }
+        mux.FastUnLock();
+        if (!done) {
+            (void) slotSem.Wait(TTInfiniteWait);
+        }
+    }
+}
+
+ConfigurationStream::Document *ConfigurationStream::PopDocument() {
+    Document *document = NULL_PTR(Document *);
+    bool done = false;
+    while (!done) {
+        (void) mux.FastLock();
+        if (documentsSize > 0u) {
+            document = documents[documentsFirst];
+            documentsFirst = (documentsFirst + 1u) % CONFIGURATION_STREAM_DEPTH;
+            documentsSize--;
+            (void) slotSem.Post();
+            done = true;
+        }
+        else if (readerDone) {
+            done = true;
+        }
+        else {
+            //Reset while holding the lock, so that a Post after a push cannot be lost
+            (void) documentSem.Reset();
+        }
+        mux.FastUnLock();
+        if (!done) {
+            (void) documentSem.Wait(TTInfiniteWait);
+        }
+    }
+    return document;
+}
+
+void ConfigurationStream::ReaderThread(const void * const parameters) {
+    ConfigurationStream *stream = static_cast<ConfigurationStream *>(const_cast<void *>(parameters));
+    bool reading = true;
+    bool framed = true;
+    while (reading) {
+        StreamString content;
+        bool end = false;
+        framed = stream->ReadDocument(content, end);
+        reading = (framed) && (!end);
+        if (reading) {
+            Document *document = new Document;
+            document->parsed = content.Seek(0LLU);
+            if (document->parsed) {
+                document->parsed = ConfigurationCache::Parse(content, stream->inputFormat.Buffer(), document->cdb, document->err);
+            }
+            stream->PushDocument(document);
+        }
+    }
+    Diagnostics::Release();
+    (void) stream->mux.FastLock();
+    stream->framingOk = framed;
+    stream->readerDone = true;
+    (void) stream->documentSem.Post();
+    stream->mux.FastUnLock();
+    (void) stream->readerDoneSem.Post();
+}
+
+bool ConfigurationStream::Convert(const ConfigurationStreamPrinter printer, void * const context) {
+    ThreadIdentifier tid = Threads::BeginThread(&ConfigurationStream::ReaderThread, this, THREADS_DEFAULT_STACKSIZE * 4u);
+    bool ok = (tid != InvalidThreadIdentifier);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to start the reader thread");
+    }
+    bool writing = ok;
+    uint32 index = 0u;
+    Document *document = ok ? PopDocument() : NULL_PTR(Document *);
+    while (document != NULL_PTR(Document *)) {
+        StreamString output;
+        bool converted = document->parsed;
+        if (!converted) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to parse document %u: %s", index, document->err.Buffer());
+        }
+        if (converted) {
+            converted = document->cdb.MoveToRoot();
+        }
+        if (converted) {
+            converted = printer(context, document->cdb, output);
+            if (!converted) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed to print document %u", index);
+            }
+        }
+        if (!converted) {
+            output = "";
+            ok = false;
+        }
+        delete document;
+        //After a write failure the remaining documents are still consumed, so that the reader thread can terminate
+        if (writing) {
+            writing = WriteDocument(output);
+            if (!writing) {
+                REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to write document %u", index);
+                ok = false;
+            }
+        }
+        index++;
+        document = PopDocument();
+    }
+    if (tid != InvalidThreadIdentifier) {
+        (void) readerDoneSem.Wait(TTInfiniteWait);
+        //Join the reader thread: it may still be inside Post, and the stream (and its semaphores) may be destroyed as soon as this returns
+        while (Threads::IsAlive(tid)) {
+            Sleep::MSec(1u);
+        }
+        (void) mux.FastLock();
+        if (!framingOk) {
+            ok = false;
+        }
+        mux.FastUnLock();
+    }
+    return ok;
+}
+
+}
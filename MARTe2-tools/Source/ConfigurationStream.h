@@ -0,0 +1,209 @@
+/**
+ * @file ConfigurationStream.h
+ * @brief Header file for class ConfigurationStream
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ConfigurationStream
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef CONFIGURATIONSTREAM_H_
+#define CONFIGURATIONSTREAM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Prints one parsed document of a ConfigurationStream.
+ * @param[in] context the opaque pointer given to ConfigurationStream::Convert.
+ * @param[in] cdb the parsed document, pointing at its root.
+ * @param[out] output the printed document.
+ * @return true if the document was successfully printed.
+ */
+typedef bool (*ConfigurationStreamPrinter)(void * const context, ConfigurationDatabase &cdb, StreamString &output);
+
+/**
+ * @brief Converts, one after another, the configurations of a multi-document stream (e.g. a pipe), in a single process.
+ * @details Two framings are supported:
+ *  - length: each document is preceded by a line with its size in bytes ("SIZE\n");
+ *  - delimiter: the documents are separated by a line which only contains the delimiter (e.g. "---").
+ *
+ * The output is framed in the same way as the input, so that the stages of a pipeline can be chained. A document which fails to be parsed
+ * or printed is written as an empty document, so that the output documents stay aligned with the input documents.
+ * A reader thread reads and parses the next documents while the calling thread prints the current one.
+ */
+class ConfigurationStream {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] inputFdIn the file descriptor from where the documents are read.
+     * @param[in] outputFdIn the file descriptor where the converted documents are written.
+     * @param[in] inputFormatIn the format of the input documents (json, xml or cdb).
+     * @param[in] delimiterIn the delimiter line. If NULL the documents are framed by their length.
+     */
+    ConfigurationStream(const int32 inputFdIn, const int32 outputFdIn, const char8 * const inputFormatIn, const char8 * const delimiterIn = NULL_PTR(const char8 *));
+
+    /**
+     * @brief Destructor.
+     */
+    ~ConfigurationStream();
+
+    /**
+     * @brief Converts all the documents until the end of the input.
+     * @param[in] printer the function which prints each parsed document.
+     * @param[in] context opaque pointer passed to every call of \a printer.
+     * @return true if all the documents were converted and the stream was correctly framed.
+     */
+    bool Convert(const ConfigurationStreamPrinter printer, void * const context);
+
+    /**
+     * @brief Opens \a filename for reading. The name - is the standard input.
+     * @return the file descriptor or -1 if the file could not be opened.
+     */
+    static int32 OpenInput(const char8 * const filename);
+
+    /**
+     * @brief Opens (and truncates) \a filename for writing. The name - is the standard output.
+     * @return the file descriptor or -1 if the file could not be opened.
+     */
+    static int32 OpenOutput(const char8 * const filename);
+
+    /**
+     * @brief Closes a file descriptor returned by OpenInput or OpenOutput. The standard streams are not closed.
+     */
+    static bool Close(const int32 fd);
+
+    /**
+     * @brief Reads \a fd until its end into \a content.
+     */
+    static bool ReadAll(const int32 fd, StreamString &content);
+
+    /**
+     * @brief Writes exactly \a size bytes to \a fd.
+     */
+    static bool WriteAll(const int32 fd, const char8 * const buffer, const uint32 size);
+
+private:
+    /**
+     * One document read (and parsed) by the reader thread.
+     */
+    struct Document {
+        ConfigurationDatabase cdb;
+        StreamString err;
+        bool parsed;
+    };
+
+    /**
+     * @brief Reader thread entry point.
+     */
+    static void ReaderThread(const void * const parameters);
+
+    /**
+     * @brief Reads the next framed document.
+     * @param[out] end true if the input ended before the document.
+     * @return false if the input is not correctly framed.
+     */
+    bool ReadDocument(StreamString &content, bool &end);
+
+    /**
+     * @brief Reads the next line (without the terminator) from the input buffer.
+     * @return false if the input ended before any character could be read.
+     */
+    bool ReadLine(StreamString &line);
+
+    /**
+     * @brief Reads exactly \a size bytes from the input buffer.
+     */
+    bool ReadBytes(const uint32 size, StreamString &content);
+
+    /**
+     * @brief Refills the input buffer. Returns false at the end of the input.
+     */
+    bool Fill();
+
+    /**
+     * @brief Writes \a content to the output, framed as the input.
+     */
+    bool WriteDocument(const StreamString &content);
+
+    /**
+     * @brief Adds a document to the queue, waiting for a free slot.
+     */
+    void PushDocument(Document * const document);
+
+    /**
+     * @brief Waits for the next document. Returns NULL when the reader is done and there are no more documents.
+     */
+    Document *PopDocument();
+
+    int32 inputFd;
+    int32 outputFd;
+    StreamString inputFormat;
+    StreamString delimiter;
+    bool useDelimiter;
+
+    /**
+     * Input buffer (only used by the reader thread).
+     */
+    char8 *buffer;
+    uint32 bufferSize;
+    uint32 bufferPosition;
+
+    /**
+     * Circular queue of the parsed documents waiting to be printed, protected by mux.
+     */
+    Document **documents;
+    uint32 documentsFirst;
+    uint32 documentsSize;
+    bool readerDone;
+    bool framingOk;
+    FastPollingMutexSem mux;
+
+    /**
+     * Posted when a document is queued (or when the reader is done).
+     */
+    EventSem documentSem;
+
+    /**
+     * Posted when a document is taken from the queue.
+     */
+    EventSem slotSem;
+
+    /**
+     * Posted when the reader thread terminates.
+     */
+    EventSem readerDoneSem;
+};
+
+}
+
+#endif /* CONFIGURATIONSTREAM_H_ */
@@ -0,0 +1,517 @@
+/**
+ * @file Diagnostics.cpp
+ * @brief Source file for the Diagnostics functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the Diagnostics functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "ConfigurationStream.h"
+#include "Diagnostics.h"
+#include "FastPollingMutexSem.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "Sleep.h"
+#include "StreamString.h"
+#include "StringHelper.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Maximum number of threads with their own buffer. The reports of any other thread are written straight away.
+ */
+static const uint32 DIAGNOSTICS_NUMBER_OF_BUFFERS = 128u;
+
+/**
+ * Size of each thread buffer, which is also the maximum size of a line (longer lines are truncated).
+ */
+static const uint32 DIAGNOSTICS_BUFFER_SIZE = 4096u;
+
+/**
+ * Number of source lines whose reports are counted.
+ */
+static const uint32 DIAGNOSTICS_NUMBER_OF_COUNTERS = 256u;
+
+/**
+ * Default maximum number of warnings (and information reports) written for each source line.
+ */
+static const uint32 DIAGNOSTICS_DEFAULT_MAX_REPEATS = 20u;
+
+/**
+ * Maximum time (in seconds) that a warning stays in a thread buffer before being written (by the reporting thread or by the flush thread).
+ */
+static const float64 DIAGNOSTICS_FLUSH_PERIOD = 0.2;
+
+/**
+ * Maximum size of the configuration file and of the node path set with SetContext (longer strings are truncated).
+ */
+static const uint32 DIAGNOSTICS_CONTEXT_SIZE = 1024u;
+
+/**
+ * The reports of one thread, waiting to be written.
+ */
+struct DiagnosticsBuffer {
+    /**
+     * Set (once) by the thread which owns the buffer.
+     */
+    volatile int32 claimed;
+    ThreadIdentifier owner;
+    /**
+     * Protects the content against the flush thread.
+     */
+    FastPollingMutexSem mux;
+    /**
+     * Copies of the strings set with SetContext (empty if not known).
+     */
+    char8 configurationFilename[DIAGNOSTICS_CONTEXT_SIZE];
+    char8 nodePath[DIAGNOSTICS_CONTEXT_SIZE];
+    uint64 lastFlush;
+    uint32 size;
+    char8 data[DIAGNOSTICS_BUFFER_SIZE];
+};
+
+/**
+ * The number of reports of one source line.
+ */
+struct DiagnosticsCounter {
+    volatile int32 claimed;
+    const char8 *sourceFilename;
+    uint32 lineNumber;
+    ErrorManagement::ErrorIntegerFormat errorType;
+    volatile int32 count;
+};
+
+/**
+ * A line being formatted, truncated to its capacity.
+ */
+struct DiagnosticsLine {
+    char8 *data;
+    uint32 size;
+    uint32 capacity;
+};
+
+static DiagnosticsBuffer diagnosticsBuffers[DIAGNOSTICS_NUMBER_OF_BUFFERS];
+
+/**
+ * Open addressing hash table, keyed by the source file and line. Two threads may claim two counters for the same source line,
+ * in which case the limit is applied to each of them: the rate limiting is approximate.
+ */
+static DiagnosticsCounter diagnosticsCounters[DIAGNOSTICS_NUMBER_OF_COUNTERS];
+
+static int32 diagnosticsOutputFd = STDOUT_FILENO;
+
+static bool diagnosticsJsonLines = false;
+
+static uint32 diagnosticsMaxRepeats = DIAGNOSTICS_DEFAULT_MAX_REPEATS;
+
+/**
+ * Set once the flush thread is started.
+ */
+static volatile int32 diagnosticsFlushThreadStarted = 0;
+
+/**
+ * @brief Appends \a text to \a line.
+ */
+static void AppendText(DiagnosticsLine &line, const char8 * const text) {
+    uint32 i;
+    for (i = 0u; (text[i] != '\0') && (line.size < line.capacity); i++) {
+        line.data[line.size] = text[i];
+        line.size++;
+    }
+}
+
+/**
+ * @brief Appends \a text to \a line as a quoted JSON string.
+ */
+static void AppendJsonString(DiagnosticsLine &line, const char8 * const text) {
+    AppendText(line, "\"");
+    uint32 i;
+    //Room for the longest escape sequence and the closing quote
+    for (i = 0u; (text[i] != '\0') && ((line.size + 7u) < line.capacity); i++) {
+        uint8 c = static_cast<uint8>(text[i]);
+        if ((c == static_cast<uint8>('"')) || (c == static_cast<uint8>('\\'))) {
+            line.data[line.size] = '\\';
+            line.data[line.size + 1u] = text[i];
+            line.size += 2u;
+        }
+        else if (c == static_cast<uint8>('\n')) {
+            AppendText(line, "\\n");
+        }
+        else if (c < 0x20u) {
+            char8 escaped[8];
+            (void) snprintf(&escaped[0], sizeof(escaped), "\\u%04x", static_cast<uint32>(c));
+            AppendText(line, &escaped[0]);
+        }
+        else {
+            line.data[line.size] = text[i];
+            line.size++;
+        }
+    }
+    AppendText(line, "\"");
+}
+
+/**
+ * @brief Appends the decimal \a value to \a line.
+ */
+static void AppendUInt32(DiagnosticsLine &line, const uint32 value) {
+    char8 number[16];
+    (void) snprintf(&number[0], sizeof(number), "%u", value);
+    AppendText(line, &number[0]);
+}
+
+/**
+ * @brief Appends the start of a report, up to (excluding) the message, to \a line.
+ */
+static void AppendHeader(DiagnosticsLine &line, const ErrorManagement::ErrorIntegerFormat errorType, const char8 * const sourceFilename, const uint32 lineNumber) {
+    StreamString errorTypeName;
+    ErrorManagement::ErrorCodeToStream(errorType, errorTypeName);
+    const char8 *source = (sourceFilename != NULL_PTR(const char8 *)) ? sourceFilename : "";
+    if (diagnosticsJsonLines) {
+        AppendText(line, "{\"type\":");
+        AppendJsonString(line, errorTypeName.Buffer());
+        AppendText(line, ",\"source\":\"");
+        AppendText(line, source);
+        AppendText(line, ":");
+        AppendUInt32(line, lineNumber);
+        AppendText(line, "\"");
+    }
+    else {
+        AppendText(line, "[");
+        AppendText(line, errorTypeName.Buffer());
+        AppendText(line, " - ");
+        AppendText(line, source);
+        AppendText(line, ":");
+        AppendUInt32(line, lineNumber);
+        AppendText(line, "]: ");
+    }
+}
+
+/**
+ * @brief Writes \a size bytes of \a data into the output.
+ */
+static void WriteOutput(const char8 * const data, const uint32 size) {
+    //Keeps the order with what the tools print with printf
+    if (diagnosticsOutputFd == STDOUT_FILENO) {
+        (void) fflush(stdout);
+    }
+    else if (diagnosticsOutputFd == STDERR_FILENO) {
+        (void) fflush(stderr);
+    }
+    else {
+        //Not a stdio stream
+    }
+    (void) ConfigurationStream::WriteAll(diagnosticsOutputFd, data, size);
+}
+
+/**
+ * @brief Writes the content of \a buffer into the output. Must be called with the buffer mux locked.
+ */
+static void FlushBuffer(DiagnosticsBuffer &buffer) {
+    if (buffer.size > 0u) {
+        WriteOutput(&buffer.data[0], buffer.size);
+        buffer.size = 0u;
+    }
+    buffer.lastFlush = HighResolutionTimer::Counter();
+}
+
+/**
+ * @brief Gets (claiming it if needed) the buffer of the calling thread.
+ * @return NULL if all the buffers are owned by other threads.
+ */
+static DiagnosticsBuffer *GetThreadBuffer() {
+    ThreadIdentifier tid = Threads::Id();
+    DiagnosticsBuffer *buffer = NULL_PTR(DiagnosticsBuffer *);
+    uint32 i;
+    for (i = 0u; (i < DIAGNOSTICS_NUMBER_OF_BUFFERS) && (buffer == NULL_PTR(DiagnosticsBuffer *)); i++) {
+        if ((diagnosticsBuffers[i].claimed != 0) && (diagnosticsBuffers[i].owner == tid)) {
+            buffer = &diagnosticsBuffers[i];
+        }
+    }
+    for (i = 0u; (i < DIAGNOSTICS_NUMBER_OF_BUFFERS) && (buffer == NULL_PTR(DiagnosticsBuffer *)); i++) {
+        if (diagnosticsBuffers[i].claimed == 0) {
+            if (Atomic::TestAndSet(&diagnosticsBuffers[i].claimed)) {
+                buffer = &diagnosticsBuffers[i];
+                (void) buffer->mux.FastLock();
+                buffer->configurationFilename[0] = '\0';
+                buffer->nodePath[0] = '\0';
+                buffer->size = 0u;
+                buffer->lastFlush = 0u;
+                buffer->owner = tid;
+                buffer->mux.FastUnLock();
+            }
+        }
+    }
+    return buffer;
+}
+
+/**
+ * @brief Copies \a source (truncated to DIAGNOSTICS_CONTEXT_SIZE) into \a destination, which is left empty if \a source is NULL.
+ */
+static void CopyContext(char8 * const destination, const char8 * const source) {
+    uint32 i = 0u;
+    if (source != NULL_PTR(const char8 *)) {
+        while ((i < (DIAGNOSTICS_CONTEXT_SIZE - 1u)) && (source[i] != '\0')) {
+            destination[i] = source[i];
+            i++;
+        }
+    }
+    destination[i] = '\0';
+}
+
+/**
+ * @brief Counts one more report of \a sourceFilename:lineNumber.
+ * @details Only the warnings and the information reports are limited.
+ * @return true if the report is to be written.
+ */
+static bool CountReport(const ErrorManagement::ErrorIntegerFormat errorType, const char8 * const sourceFilename, const uint32 lineNumber) {
+    bool write = true;
+    bool limited = (errorType == ErrorManagement::Warning) || (errorType == ErrorManagement::Information);
+    if ((limited) && (diagnosticsMaxRepeats > 0u)) {
+        //The source file names are string literals (__FILE__)
+        uint32 hash = (static_cast<uint32>(reinterpret_cast<uintp>(sourceFilename)) >> 3u) ^ (lineNumber * 2654435761u);
+        DiagnosticsCounter *counter = NULL_PTR(DiagnosticsCounter *);
+        uint32 n;
+        for (n = 0u; (n < DIAGNOSTICS_NUMBER_OF_COUNTERS) && (counter == NULL_PTR(DiagnosticsCounter *)); n++) {
+            DiagnosticsCounter *candidate = &diagnosticsCounters[(hash + n) % DIAGNOSTICS_NUMBER_OF_COUNTERS];
+            if (candidate->claimed != 0) {
+                if ((candidate->sourceFilename == sourceFilename) && (candidate->lineNumber == lineNumber)) {
+                    counter = candidate;
+                }
+            }
+            else if (Atomic::TestAndSet(&candidate->claimed)) {
+                candidate->lineNumber = lineNumber;
+                candidate->errorType = errorType;
+                candidate->sourceFilename = sourceFilename;
+                counter = candidate;
+            }
+            else {
+                //Claimed by another thread in the meantime
+            }
+        }
+        //If all the counters are in use the report is not limited
+        if (counter != NULL_PTR(DiagnosticsCounter *)) {
+            Atomic::Increment(&counter->count);
+            write = (static_cast<uint32>(counter->count) <= diagnosticsMaxRepeats);
+        }
+    }
+    return write;
+}
+
+/**
+ * @brief Writes, every DIAGNOSTICS_FLUSH_PERIOD, the warnings buffered by threads which did not report again (e.g. the long running
+ * watch and server modes).
+ */
+static void FlushThread(const void * const parameters) {
+    (void) parameters;
+    while (true) {
+        Sleep::Sec(static_cast<float32>(DIAGNOSTICS_FLUSH_PERIOD));
+        uint32 i;
+        for (i = 0u; i < DIAGNOSTICS_NUMBER_OF_BUFFERS; i++) {
+            if ((diagnosticsBuffers[i].claimed != 0) && (diagnosticsBuffers[i].size > 0u)) {
+                (void) diagnosticsBuffers[i].mux.FastLock();
+                FlushBuffer(diagnosticsBuffers[i]);
+                diagnosticsBuffers[i].mux.FastUnLock();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Flushes the buffers when the program exits.
+ */
+static void FlushAtExit() {
+    Diagnostics::Flush();
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace Diagnostics {
+
+void Install() {
+    const char8 *format = getenv("MARTe2_TOOLS_DIAGNOSTICS");
+    if (format != NULL_PTR(const char8 *)) {
+        diagnosticsJsonLines = (StringHelper::Compare(format, "json") == 0);
+    }
+    const char8 *maxRepeats = getenv("MARTe2_TOOLS_MAX_REPEATS");
+    if (maxRepeats != NULL_PTR(const char8 *)) {
+        diagnosticsMaxRepeats = static_cast<uint32>(strtoul(maxRepeats, NULL_PTR(char8 **), 10));
+    }
+    SetErrorProcessFunction(&ErrorProcessFunction);
+    if (Atomic::TestAndSet(&diagnosticsFlushThreadStarted)) {
+        (void) atexit(&FlushAtExit);
+        ThreadIdentifier tid = Threads::BeginThread(&FlushThread, NULL_PTR(const void *), THREADS_DEFAULT_STACKSIZE);
+        if (tid == InvalidThreadIdentifier) {
+            //Without the flush thread the warnings are not buffered
+            diagnosticsFlushThreadStarted = 0;
+        }
+    }
+}
+
+void SetOutput(const int32 fd) {
+    diagnosticsOutputFd = fd;
+}
+
+void SetContext(const char8 * const configurationFilename, const char8 * const nodePath) {
+    DiagnosticsBuffer *buffer = GetThreadBuffer();
+    if (buffer != NULL_PTR(DiagnosticsBuffer *)) {
+        (void) buffer->mux.FastLock();
+        CopyContext(&buffer->configurationFilename[0], configurationFilename);
+        CopyContext(&buffer->nodePath[0], nodePath);
+        buffer->mux.FastUnLock();
+    }
+}
+
+void Release() {
+    ThreadIdentifier tid = Threads::Id();
+    uint32 i;
+    for (i = 0u; i < DIAGNOSTICS_NUMBER_OF_BUFFERS; i++) {
+        if ((diagnosticsBuffers[i].claimed != 0) && (diagnosticsBuffers[i].owner == tid)) {
+            (void) diagnosticsBuffers[i].mux.FastLock();
+            FlushBuffer(diagnosticsBuffers[i]);
+            diagnosticsBuffers[i].configurationFilename[0] = '\0';
+            diagnosticsBuffers[i].nodePath[0] = '\0';
+            diagnosticsBuffers[i].owner = InvalidThreadIdentifier;
+            diagnosticsBuffers[i].mux.FastUnLock();
+            //Only now can it be claimed by another thread
+            (void) Atomic::Exchange(&diagnosticsBuffers[i].claimed, 0);
+        }
+    }
+}
+
+void Flush() {
+    uint32 i;
+    for (i = 0u; i < DIAGNOSTICS_NUMBER_OF_BUFFERS; i++) {
+        if (diagnosticsBuffers[i].claimed != 0) {
+            (void) diagnosticsBuffers[i].mux.FastLock();
+            FlushBuffer(diagnosticsBuffers[i]);
+            diagnosticsBuffers[i].mux.FastUnLock();
+        }
+    }
+    for (i = 0u; i < DIAGNOSTICS_NUMBER_OF_COUNTERS; i++) {
+        DiagnosticsCounter *counter = &diagnosticsCounters[i];
+        if ((counter->claimed != 0) && (diagnosticsMaxRepeats > 0u) && (static_cast<uint32>(counter->count) > diagnosticsMaxRepeats)) {
+            char8 data[DIAGNOSTICS_BUFFER_SIZE];
+            DiagnosticsLine line = { &data[0], 0u, DIAGNOSTICS_BUFFER_SIZE - 2u };
+            uint32 suppressed = static_cast<uint32>(counter->count) - diagnosticsMaxRepeats;
+            AppendHeader(line, counter->errorType, counter->sourceFilename, counter->lineNumber);
+            if (diagnosticsJsonLines) {
+                AppendText(line, ",\"suppressed\":");
+                AppendUInt32(line, suppressed);
+                AppendText(line, "}");
+            }
+            else {
+                AppendUInt32(line, suppressed);
+                AppendText(line, " more reports suppressed");
+            }
+            line.data[line.size] = '\n';
+            line.size++;
+            WriteOutput(line.data, line.size);
+            //Only reported once
+            (void) Atomic::Exchange(&counter->count, static_cast<int32>(diagnosticsMaxRepeats));
+        }
+    }
+}
+
+void ErrorProcessFunction(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const errorDescription) {
+    ErrorManagement::ErrorIntegerFormat errorType = static_cast<ErrorManagement::ErrorIntegerFormat>(errorInfo.header.errorType);
+    uint32 lineNumber = static_cast<uint32>(errorInfo.header.lineNumber);
+    if (CountReport(errorType, errorInfo.fileName, lineNumber)) {
+        DiagnosticsBuffer *buffer = GetThreadBuffer();
+        const char8 *configurationFilename = NULL_PTR(const char8 *);
+        const char8 *nodePath = NULL_PTR(const char8 *);
+        if (buffer != NULL_PTR(DiagnosticsBuffer *)) {
+            if (buffer->configurationFilename[0] != '\0') {
+                configurationFilename = &buffer->configurationFilename[0];
+            }
+            if (buffer->nodePath[0] != '\0') {
+                nodePath = &buffer->nodePath[0];
+            }
+        }
+        char8 data[DIAGNOSTICS_BUFFER_SIZE];
+        //Room for the closing brace and the new line
+        DiagnosticsLine line = { &data[0], 0u, DIAGNOSTICS_BUFFER_SIZE - 2u };
+        AppendHeader(line, errorType, errorInfo.fileName, lineNumber);
+        if (diagnosticsJsonLines) {
+            if (configurationFilename != NULL_PTR(const char8 *)) {
+                AppendText(line, ",\"file\":");
+                AppendJsonString(line, configurationFilename);
+            }
+            if (nodePath != NULL_PTR(const char8 *)) {
+                AppendText(line, ",\"node\":");
+                AppendJsonString(line, nodePath);
+            }
+            AppendText(line, ",\"message\":");
+            AppendJsonString(line, errorDescription);
+            AppendText(line, "}");
+        }
+        else {
+            if (configurationFilename != NULL_PTR(const char8 *)) {
+                AppendText(line, configurationFilename);
+                AppendText(line, ": ");
+            }
+            if (nodePath != NULL_PTR(const char8 *)) {
+                AppendText(line, nodePath);
+                AppendText(line, ": ");
+            }
+            AppendText(line, errorDescription);
+            //The descriptions often end with a new line already
+            while ((line.size > 0u) && (line.data[line.size - 1u] == '\n')) {
+                line.size--;
+            }
+        }
+        line.data[line.size] = '\n';
+        line.size++;
+        if (buffer == NULL_PTR(DiagnosticsBuffer *)) {
+            WriteOutput(line.data, line.size);
+        }
+        else {
+            (void) buffer->mux.FastLock();
+            if ((buffer->size + line.size) > DIAGNOSTICS_BUFFER_SIZE) {
+                FlushBuffer(*buffer);
+            }
+            (void) MemoryOperationsHelper::Copy(&buffer->data[buffer->size], line.data, line.size);
+            buffer->size += line.size;
+            float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - buffer->lastFlush) * HighResolutionTimer::Period();
+            //Without the flush thread nothing would write a buffered warning of a thread that does not report again
+            bool buffered = (errorType == ErrorManagement::Warning) && (diagnosticsFlushThreadStarted != 0);
+            if ((!buffered) || (elapsed > DIAGNOSTICS_FLUSH_PERIOD)) {
+                FlushBuffer(*buffer);
+            }
+            buffer->mux.FastUnLock();
+        }
+    }
+}
+
+}
+
+}
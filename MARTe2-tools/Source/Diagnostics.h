@@ -0,0 +1,97 @@
+/**
+ * @file Diagnostics.h
+ * @brief Header file for the Diagnostics functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the Diagnostics functions.
+ */
+
+#ifndef DIAGNOSTICS_H_
+#define DIAGNOSTICS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief The sink of the errors reported (with REPORT_ERROR_STATIC) by the tools.
+ * @details Each thread formats its reports into its own buffer and the buffer is written into the output with a single write, so
+ * that the lines of concurrent threads are never interleaved. Warnings are buffered (until the buffer is full or for at most
+ * DIAGNOSTICS_FLUSH_PERIOD, after which a flush thread writes them), all the other reports are written straight away. The buffers
+ * are flushed when the program exits. Threads which report shall call Release before ending.
+ *
+ * The output is not a single ordered stream: each buffer is protected by its own (FastPollingMutexSem) lock and the lines are
+ * ordered only within a thread. As warnings may wait up to DIAGNOSTICS_FLUSH_PERIOD, they may be written after errors reported
+ * later by other threads. Each line is always written whole.
+ *
+ * Each line is either text ("[Type - Source.cpp:LINE]: FILE: NODE: DESCRIPTION") or, if the environment variable MARTe2_TOOLS_DIAGNOSTICS
+ * is json, a JSON object ({"type":..., "source":..., "file":..., "node":..., "message":...}), where file and node are the configuration
+ * file and node being processed by the reporting thread (see SetContext), if known.
+ *
+ * Only the first MARTe2_TOOLS_MAX_REPEATS (default 20, 0 for no limit) warnings and information reports of each source line are
+ * written. All the other reports (e.g. the errors) are always written. The number of suppressed reports is written when the program exits.
+ */
+namespace Diagnostics {
+
+/**
+ * @brief Installs the sink as the error process function and reads the environment variables.
+ */
+void Install();
+
+/**
+ * @brief Writes the reports into \a fd (the standard output by default).
+ */
+void SetOutput(const int32 fd);
+
+/**
+ * @brief Sets the configuration file and node being processed by the calling thread, until it is called again.
+ * @details Both strings are copied (and truncated to 1023 characters), so they may be released straight away. NULL if not known.
+ */
+void SetContext(const char8 * const configurationFilename, const char8 * const nodePath = NULL_PTR(const char8 *));
+
+/**
+ * @brief Writes the buffer of the calling thread and releases it, so that it can be used by other threads.
+ * @details Shall be called by the threads which may have reported before they end (a new thread may get the same identifier).
+ */
+void Release();
+
+/**
+ * @brief Writes the buffers of all the threads and the number of suppressed reports.
+ * @details Shall only be called when no other thread is reporting (it is called when the program exits).
+ */
+void Flush();
+
+/**
+ * @brief The MARTe2 ErrorProcessFunctionType.
+ */
+void ErrorProcessFunction(const ErrorManagement::ErrorInformation &errorInfo, const char8 * const errorDescription);
+
+}
+
+}
+
+#endif /* DIAGNOSTICS_H_ */
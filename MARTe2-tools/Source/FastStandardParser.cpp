@@ -0,0 +1,706 @@
+/**
+ * @file FastStandardParser.cpp
+ * @brief Source file for the FastStandardParser functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the FastStandardParser functions.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FAST_STANDARD_PARSER_X86
+#include <immintrin.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationHash.h"
+#include "FastPollingMutexSem.h"
+#include "FastStandardParser.h"
+#include "Matrix.h"
+#include "StandardParser.h"
+#include "StringHelper.h"
+#include "Vector.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A set of (at most 16) characters, both as a lookup table (scalar lexer) and as a list (SIMD lexers).
+ */
+struct CharacterSet {
+    bool member[256];
+    char8 characters[16];
+    uint32 numberOfCharacters;
+};
+
+static void InitialiseCharacterSet(CharacterSet &set, const char8 * const characters) {
+    uint32 i;
+    for (i = 0u; i < 256u; i++) {
+        set.member[i] = false;
+    }
+    set.numberOfCharacters = 0u;
+    for (i = 0u; (characters[i] != '\0') && (i < 16u); i++) {
+        set.member[static_cast<uint8>(characters[i])] = true;
+        set.characters[i] = characters[i];
+        set.numberOfCharacters++;
+    }
+}
+
+/**
+ * @brief Returns the first position in [position, end[ whose character is (FindFirstOf) or is not (FindFirstNotOf) in the set, or end.
+ */
+typedef const char8 *(*ScanFunction)(const char8 *position, const char8 * const end, const CharacterSet &set);
+
+static const char8 *FindFirstOfScalar(const char8 *position, const char8 * const end, const CharacterSet &set) {
+    while ((position < end) && (!set.member[static_cast<uint8>(*position)])) {
+        position++;
+    }
+    return position;
+}
+
+static const char8 *FindFirstNotOfScalar(const char8 *position, const char8 * const end, const CharacterSet &set) {
+    while ((position < end) && (set.member[static_cast<uint8>(*position)])) {
+        position++;
+    }
+    return position;
+}
+
+#ifdef FAST_STANDARD_PARSER_X86
+/**
+ * @brief Gets the mask of the characters of \a block which are in the set.
+ */
+__attribute__((target("sse2")))
+static uint32 MatchSSE2(const __m128i block, const CharacterSet &set) {
+    __m128i match = _mm_setzero_si128();
+    uint32 i;
+    for (i = 0u; i < set.numberOfCharacters; i++) {
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(block, _mm_set1_epi8(set.characters[i])));
+    }
+    return static_cast<uint32>(_mm_movemask_epi8(match));
+}
+
+__attribute__((target("sse2")))
+static const char8 *FindFirstOfSSE2(const char8 *position, const char8 * const end, const CharacterSet &set) {
+    bool found = false;
+    while (((end - position) >= 16) && (!found)) {
+        uint32 mask = MatchSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(position)), set);
+        found = (mask != 0u);
+        position += found ? __builtin_ctz(mask) : 16;
+    }
+    return found ? position : FindFirstOfScalar(position, end, set);
+}
+
+__attribute__((target("sse2")))
+static const char8 *FindFirstNotOfSSE2(const char8 *position, const char8 * const end, const CharacterSet &set) {
+    bool found = false;
+    while (((end - position) >= 16) && (!found)) {
+        uint32 mask = (~MatchSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(position)), set)) & 0xFFFFu;
+        found = (mask != 0u);
+        position += found ? __builtin_ctz(mask) : 16;
+    }
+    return found ? position : FindFirstNotOfScalar(position, end, set);
+}
+
+__attribute__((target("avx2")))
+static uint32 MatchAVX2(const __m256i block, const CharacterSet &set) {
+    __m256i match = _mm256_setzero_si256();
+    uint32 i;
+    for (i = 0u; i < set.numberOfCharacters; i++) {
+        match = _mm256_or_si256(match, _mm256_cmpeq_epi8(block, _mm256_set1_epi8(set.characters[i])));
+    }
+    return static_cast<uint32>(_mm256_movemask_epi8(match));
+}
+
+__attribute__((target("avx2")))
+static const char8 *FindFirstOfAVX2(const char8 *position, const char8 * const end, const CharacterSet &set) {
+    bool found = false;
+    while (((end - position) >= 32) && (!found)) {
+        uint32 mask = MatchAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(position)), set);
+        found = (mask != 0u);
+        position += found ? __builtin_ctz(mask) : 32;
+    }
+    return found ? position : FindFirstOfScalar(position, end, set);
+}
+
+__attribute__((target("avx2")))
+static const char8 *FindFirstNotOfAVX2(const char8 *position, const char8 * const end, const CharacterSet &set) {
+    bool found = false;
+    while (((end - position) >= 32) && (!found)) {
+        uint32 mask = ~MatchAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(position)), set);
+        found = (mask != 0u);
+        position += found ? __builtin_ctz(mask) : 32;
+    }
+    return found ? position : FindFirstNotOfScalar(position, end, set);
+}
+#endif
+
+/**
+ * @brief Returns true if the processor supports the lexer \a mode.
+ */
+static bool IsLexerSupported(const FastStandardParser::LexerMode mode) {
+    bool supported = (mode != FastStandardParser::LexerSSE2) && (mode != FastStandardParser::LexerAVX2);
+#ifdef FAST_STANDARD_PARSER_X86
+    if (mode == FastStandardParser::LexerSSE2) {
+        supported = (__builtin_cpu_supports("sse2") != 0);
+    }
+    else if (mode == FastStandardParser::LexerAVX2) {
+        supported = (__builtin_cpu_supports("avx2") != 0);
+    }
+    else {
+        //Always supported
+    }
+#endif
+    return supported;
+}
+
+static FastStandardParser::LexerMode GetBestLexerMode() {
+    FastStandardParser::LexerMode mode = FastStandardParser::LexerScalar;
+    if (IsLexerSupported(FastStandardParser::LexerAVX2)) {
+        mode = FastStandardParser::LexerAVX2;
+    }
+    else if (IsLexerSupported(FastStandardParser::LexerSSE2)) {
+        mode = FastStandardParser::LexerSSE2;
+    }
+    else {
+        //Scalar
+    }
+    return mode;
+}
+
+/**
+ * The current lexer mode. Negative until the first GetLexerMode or SetLexerMode.
+ */
+static int32 currentLexerMode = -1;
+
+/**
+ * Protects currentLexerMode, which is read by the concurrent parsing jobs.
+ */
+static FastPollingMutexSem lexerModeMux;
+
+/**
+ * @brief Gets the lexer mode with \a name (marte, scalar, sse2, avx2, auto or check).
+ * @return false if \a name is not valid.
+ */
+static bool GetLexerModeByName(const char8 * const name, FastStandardParser::LexerMode &mode) {
+    bool ok = true;
+    if (StringHelper::Compare(name, "marte") == 0) {
+        mode = FastStandardParser::LexerMARTe;
+    }
+    else if (StringHelper::Compare(name, "scalar") == 0) {
+        mode = FastStandardParser::LexerScalar;
+    }
+    else if (StringHelper::Compare(name, "sse2") == 0) {
+        mode = FastStandardParser::LexerSSE2;
+    }
+    else if (StringHelper::Compare(name, "avx2") == 0) {
+        mode = FastStandardParser::LexerAVX2;
+    }
+    else if (StringHelper::Compare(name, "auto") == 0) {
+        mode = GetBestLexerMode();
+    }
+    else if (StringHelper::Compare(name, "check") == 0) {
+        mode = FastStandardParser::LexerCheck;
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets \a mode if supported by the processor or the best supported one otherwise.
+ */
+static FastStandardParser::LexerMode GetSupportedLexerMode(const FastStandardParser::LexerMode mode) {
+    FastStandardParser::LexerMode supportedMode = mode;
+    if (!IsLexerSupported(mode)) {
+        supportedMode = GetBestLexerMode();
+    }
+    return supportedMode;
+}
+
+/**
+ * Tokens of the cdb syntax.
+ */
+enum CdbToken {
+    CdbTokenEnd,
+    CdbTokenName,
+    CdbTokenString,
+    CdbTokenAssignment,
+    CdbTokenOpen,
+    CdbTokenClose,
+    CdbTokenUnsupported
+};
+
+/**
+ * @brief Splits a cdb content in tokens, skipping the separators and the comments with the scan functions of the selected lexer.
+ */
+class CdbLexer {
+public:
+    CdbLexer(const char8 * const buffer, const uint32 size, const FastStandardParser::LexerMode mode) {
+        position = buffer;
+        end = &buffer[size];
+        findFirstOf = &FindFirstOfScalar;
+        findFirstNotOf = &FindFirstNotOfScalar;
+#ifdef FAST_STANDARD_PARSER_X86
+        if (mode == FastStandardParser::LexerSSE2) {
+            findFirstOf = &FindFirstOfSSE2;
+            findFirstNotOf = &FindFirstNotOfSSE2;
+        }
+        else if (mode == FastStandardParser::LexerAVX2) {
+            findFirstOf = &FindFirstOfAVX2;
+            findFirstNotOf = &FindFirstNotOfAVX2;
+        }
+        else {
+            //Scalar
+        }
+#endif
+        InitialiseCharacterSet(separators, " \t\r\n,");
+        InitialiseCharacterSet(delimiters, " \t\r\n,={}()\"'/");
+        InitialiseCharacterSet(quoted, "\"\\");
+        InitialiseCharacterSet(newLine, "\n");
+        InitialiseCharacterSet(star, "*");
+    }
+
+    /**
+     * @brief Gets the next token. For names and strings \a tokenStart and \a tokenSize delimit the (unquoted) value.
+     */
+    CdbToken Next(const char8 *&tokenStart, uint32 &tokenSize) {
+        CdbToken token = CdbTokenEnd;
+        bool done = false;
+        while (!done) {
+            done = true;
+            position = findFirstNotOf(position, end, separators);
+            if (position < end) {
+                char8 c = *position;
+                char8 next = ((position + 1) < end) ? position[1] : '\0';
+                if ((c == '/') && (next == '/')) {
+                    position = findFirstOf(position, end, newLine);
+                    done = false;
+                }
+                else if ((c == '/') && (next == '*')) {
+                    const char8 *search = &position[2];
+                    bool closed = false;
+                    while ((search < end) && (!closed)) {
+                        search = findFirstOf(search, end, star);
+                        closed = ((search + 1) < end) && (search[1] == '/');
+                        if (!closed) {
+                            search++;
+                        }
+                    }
+                    if (closed) {
+                        position = &search[2];
+                        done = false;
+                    }
+                    else {
+                        token = CdbTokenUnsupported;
+                    }
+                }
+                else if (c == '=') {
+                    token = CdbTokenAssignment;
+                    position++;
+                }
+                else if (c == '{') {
+                    token = CdbTokenOpen;
+                    position++;
+                }
+                else if (c == '}') {
+                    token = CdbTokenClose;
+                    position++;
+                }
+                else if (c == '"') {
+                    const char8 *close = findFirstOf(&position[1], end, quoted);
+                    if ((close < end) && (*close == '"')) {
+                        token = CdbTokenString;
+                        tokenStart = &position[1];
+                        tokenSize = static_cast<uint32>(close - tokenStart);
+                        position = &close[1];
+                    }
+                    else {
+                        token = CdbTokenUnsupported;
+                    }
+                }
+                else if ((c == '(') || (c == ')') || (c == '\'')) {
+                    token = CdbTokenUnsupported;
+                }
+                else {
+                    const char8 *tokenEnd = findFirstOf(position, end, delimiters);
+                    //A / only ends the name if it starts a comment
+                    while ((tokenEnd < end) && (*tokenEnd == '/') && (((tokenEnd + 1) >= end) || ((tokenEnd[1] != '/') && (tokenEnd[1] != '*')))) {
+                        tokenEnd = findFirstOf(&tokenEnd[1], end, delimiters);
+                    }
+                    if ((tokenEnd < end) && ((*tokenEnd == '"') || (*tokenEnd == '\''))) {
+                        token = CdbTokenUnsupported;
+                    }
+                    else {
+                        token = CdbTokenName;
+                        tokenStart = position;
+                        tokenSize = static_cast<uint32>(tokenEnd - position);
+                        position = tokenEnd;
+                    }
+                }
+            }
+        }
+        return token;
+    }
+
+private:
+    const char8 *position;
+    const char8 *end;
+    ScanFunction findFirstOf;
+    ScanFunction findFirstNotOf;
+    CharacterSet separators;
+    CharacterSet delimiters;
+    CharacterSet quoted;
+    CharacterSet newLine;
+    CharacterSet star;
+};
+
+/**
+ * @brief Growable array of the values of a vector or matrix.
+ */
+class CdbValues {
+public:
+    CdbValues() {
+        size = 0u;
+        capacity = 8u;
+        values = new StreamString[capacity];
+    }
+
+    ~CdbValues() {
+        delete [] values;
+    }
+
+    void Add(const char8 * const start, const uint32 length) {
+        if (size == capacity) {
+            StreamString *newValues = new StreamString[capacity * 2u];
+            uint32 i;
+            for (i = 0u; i < size; i++) {
+                newValues[i] = values[i];
+            }
+            delete [] values;
+            values = newValues;
+            capacity *= 2u;
+        }
+        uint32 writeSize = length;
+        (void) values[size].Write(start, writeSize);
+        size++;
+    }
+
+    StreamString *values;
+    uint32 size;
+
+private:
+    uint32 capacity;
+};
+
+/**
+ * @brief Recursive descent parser of the cdb syntax, writing directly into a StructuredDataI.
+ */
+class CdbParser {
+public:
+    CdbParser(CdbLexer &lexerIn, StructuredDataI &cdbIn) :
+            lexer(lexerIn),
+            cdb(cdbIn) {
+        tokenStart = NULL_PTR(const char8 *);
+        tokenSize = 0u;
+    }
+
+    /**
+     * @brief Parses all the assignments until the end of the content (\a isRoot) or the } which closes the current block.
+     */
+    bool ParseBlock(const bool isRoot) {
+        bool ok = true;
+        bool done = false;
+        while ((ok) && (!done)) {
+            CdbToken token = Next();
+            if (token == CdbTokenEnd) {
+                ok = isRoot;
+                done = true;
+            }
+            else if (token == CdbTokenClose) {
+                ok = !isRoot;
+                done = true;
+            }
+            else if (token == CdbTokenName) {
+                StreamString name;
+                GetToken(name);
+                ok = (Next() == CdbTokenAssignment);
+                if (ok) {
+                    ok = ParseValue(name.Buffer());
+                }
+            }
+            else {
+                ok = false;
+            }
+        }
+        return ok;
+    }
+
+private:
+    CdbToken Next() {
+        return lexer.Next(tokenStart, tokenSize);
+    }
+
+    void GetToken(StreamString &str) const {
+        uint32 writeSize = tokenSize;
+        (void) str.Write(tokenStart, writeSize);
+    }
+
+    /**
+     * @brief Returns true if the current node has no leaf or node called \a name.
+     */
+    bool IsNew(const char8 * const name) {
+        bool exists = !cdb.GetType(name).IsVoid();
+        if (!exists) {
+            exists = cdb.MoveRelative(name);
+            if (exists) {
+                (void) cdb.MoveToAncestor(1u);
+            }
+        }
+        return !exists;
+    }
+
+    /**
+     * @brief Parses the value assigned to \a name (the = was already consumed).
+     */
+    bool ParseValue(const char8 * const name) {
+        bool ok = IsNew(name);
+        CdbToken token = CdbTokenEnd;
+        if (ok) {
+            token = Next();
+        }
+        if ((ok) && ((token == CdbTokenName) || (token == CdbTokenString))) {
+            StreamString value;
+            GetToken(value);
+            ok = cdb.Write(name, value.Buffer());
+        }
+        else if ((ok) && (token == CdbTokenOpen)) {
+            ok = ParseBraces(name);
+        }
+        else {
+            ok = false;
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Parses what follows the { of the value of \a name: a node, a vector or a matrix.
+     */
+    bool ParseBraces(const char8 * const name) {
+        bool ok = true;
+        CdbToken token = Next();
+        if (token == CdbTokenClose) {
+            ok = cdb.CreateRelative(name);
+            if (ok) {
+                ok = cdb.MoveToAncestor(1u);
+            }
+        }
+        else if ((token == CdbTokenName) || (token == CdbTokenString)) {
+            StreamString first;
+            GetToken(first);
+            CdbToken second = Next();
+            if ((token == CdbTokenName) && (second == CdbTokenAssignment)) {
+                ok = cdb.CreateRelative(name);
+                if (ok) {
+                    ok = ParseValue(first.Buffer());
+                }
+                if (ok) {
+                    ok = ParseBlock(false);
+                }
+                if (ok) {
+                    ok = cdb.MoveToAncestor(1u);
+                }
+            }
+            else {
+                CdbValues vector;
+                vector.Add(first.Buffer(), static_cast<uint32>(first.Size()));
+                while ((second == CdbTokenName) || (second == CdbTokenString)) {
+                    vector.Add(tokenStart, tokenSize);
+                    second = Next();
+                }
+                ok = (second == CdbTokenClose);
+                if (ok) {
+                    Vector<StreamString> values(vector.values, vector.size);
+                    ok = cdb.Write(name, values);
+                }
+            }
+        }
+        else if (token == CdbTokenOpen) {
+            CdbValues matrix;
+            uint32 numberOfRows = 0u;
+            uint32 numberOfColumns = 0u;
+            while ((ok) && (token == CdbTokenOpen)) {
+                uint32 rowStart = matrix.size;
+                token = Next();
+                while ((token == CdbTokenName) || (token == CdbTokenString)) {
+                    matrix.Add(tokenStart, tokenSize);
+                    token = Next();
+                }
+                uint32 rowSize = matrix.size - rowStart;
+                ok = (token == CdbTokenClose) && (rowSize > 0u) && ((numberOfRows == 0u) || (rowSize == numberOfColumns));
+                numberOfColumns = rowSize;
+                numberOfRows++;
+                if (ok) {
+                    token = Next();
+                }
+            }
+            if (ok) {
+                ok = (token == CdbTokenClose);
+            }
+            if (ok) {
+                Matrix<StreamString> values(matrix.values, numberOfRows, numberOfColumns);
+                ok = cdb.Write(name, values);
+            }
+        }
+        else {
+            ok = false;
+        }
+        return ok;
+    }
+
+    CdbLexer &lexer;
+    StructuredDataI &cdb;
+    const char8 *tokenStart;
+    uint32 tokenSize;
+};
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace FastStandardParser {
+
+LexerMode GetLexerMode() {
+    const char8 *unknownName = NULL_PTR(const char8 *);
+    (void) lexerModeMux.FastLock();
+    //Initialised once, by the first caller, even if several parsing jobs start at the same time
+    if (currentLexerMode < 0) {
+        LexerMode mode = GetBestLexerMode();
+        const char8 * const name = getenv("MARTE2_TOOLS_CDB_LEXER");
+        if (name != NULL_PTR(const char8 *)) {
+            if (!GetLexerModeByName(name, mode)) {
+                unknownName = name;
+                mode = GetBestLexerMode();
+            }
+        }
+        currentLexerMode = static_cast<int32>(GetSupportedLexerMode(mode));
+    }
+    LexerMode mode = static_cast<LexerMode>(currentLexerMode);
+    lexerModeMux.FastUnLock();
+    if (unknownName != NULL_PTR(const char8 *)) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "Unknown MARTE2_TOOLS_CDB_LEXER %s. Using the default lexer", unknownName);
+    }
+    return mode;
+}
+
+void SetLexerMode(const LexerMode mode) {
+    (void) lexerModeMux.FastLock();
+    currentLexerMode = static_cast<int32>(GetSupportedLexerMode(mode));
+    lexerModeMux.FastUnLock();
+}
+
+bool SetLexerMode(const char8 * const name) {
+    LexerMode mode = LexerMARTe;
+    bool ok = GetLexerModeByName(name, mode);
+    if (ok) {
+        SetLexerMode(mode);
+    }
+    return ok;
+}
+
+bool ParseBuffer(const char8 * const buffer, const uint32 size, StructuredDataI &cdb, const LexerMode mode) {
+    CdbLexer lexer(buffer, size, mode);
+    CdbParser parser(lexer, cdb);
+    bool ok = cdb.MoveToRoot();
+    if (ok) {
+        ok = parser.ParseBlock(true);
+    }
+    return ok;
+}
+
+bool Parse(StreamI &stream, ConfigurationDatabase &cdb, StreamString &err) {
+    const LexerMode mode = GetLexerMode();
+    bool ok = true;
+    bool parsed = false;
+    if (mode != LexerMARTe) {
+        //Avoid copying contents which are already in memory
+        StreamString content;
+        StreamString *inMemory = dynamic_cast<StreamString *>(&stream);
+        if (inMemory == NULL_PTR(StreamString *)) {
+            ok = stream.Seek(0LLU);
+            if (ok) {
+                ok = ConfigurationCache::ReadStream(stream, content);
+            }
+            inMemory = &content;
+        }
+        if (ok) {
+            parsed = ParseBuffer(inMemory->Buffer(), static_cast<uint32>(inMemory->Size()), cdb, (mode == LexerCheck) ? GetBestLexerMode() : mode);
+        }
+        if ((parsed) && (mode == LexerCheck)) {
+            ConfigurationDatabase reference;
+            ok = stream.Seek(0LLU);
+            if (ok) {
+                StandardParser parser(stream, reference, &err);
+                ok = parser.Parse();
+            }
+            uint64 hash = 0u;
+            uint64 referenceHash = 0u;
+            if (ok) {
+                ok = cdb.MoveToRoot();
+            }
+            if (ok) {
+                ok = ConfigurationHash::Compute(cdb, hash);
+            }
+            if (ok) {
+                ok = reference.MoveToRoot();
+            }
+            if (ok) {
+                ok = ConfigurationHash::Compute(reference, referenceHash);
+            }
+            if ((ok) && (hash != referenceHash)) {
+                (void) err.Printf("The fast cdb parser result differs from the StandardParser one (%016llx != %016llx)", hash, referenceHash);
+                ok = false;
+            }
+        }
+        if ((ok) && (!parsed)) {
+            cdb.Purge();
+        }
+    }
+    if ((ok) && (!parsed)) {
+        ok = stream.Seek(0LLU);
+        if (ok) {
+            StandardParser parser(stream, cdb, &err);
+            ok = parser.Parse();
+        }
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    return ok;
+}
+
+}
+
+}
@@ -0,0 +1,111 @@
+/**
+ * @file FastStandardParser.h
+ * @brief Header file for the FastStandardParser functions
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the FastStandardParser functions.
+ */
+
+#ifndef FASTSTANDARDPARSER_H_
+#define FASTSTANDARDPARSER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationDatabase.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Parser of the cdb (StandardParser) syntax with a lexer which classifies 16 (SSE2) or 32 (AVX2) characters at a time.
+ * @details The parser covers the syntax used by nearly all the configuration files: nodes, scalars, vectors and matrices of quoted or
+ * unquoted values and the // and slash-star comments. As with the StandardParser (without type casts) all the values are stored as strings.
+ * Anything else (type casts, single quotes, backslashes in quoted strings, repeated names, syntax errors) makes the parser give up and the
+ * content is then parsed by the StandardParser, so that the result (and the error messages) are always the ones of the StandardParser.
+ */
+namespace FastStandardParser {
+
+/**
+ * Lexer implementations.
+ */
+enum LexerMode {
+    /**
+     * Always use the StandardParser.
+     */
+    LexerMARTe,
+    /**
+     * One character at a time.
+     */
+    LexerScalar,
+    /**
+     * 16 characters at a time.
+     */
+    LexerSSE2,
+    /**
+     * 32 characters at a time.
+     */
+    LexerAVX2,
+    /**
+     * Parse with the best available lexer and with the StandardParser and report any difference.
+     */
+    LexerCheck
+};
+
+/**
+ * @brief Gets the lexer mode. The default is the best one supported by the processor and can be changed with the
+ * MARTE2_TOOLS_CDB_LEXER environment variable (marte, scalar, sse2, avx2, auto or check).
+ * @details Thread safe: the mode is initialised once, by the first caller.
+ */
+LexerMode GetLexerMode();
+
+/**
+ * @brief Sets the lexer mode. Modes which are not supported by the processor are replaced by the best supported one.
+ */
+void SetLexerMode(const LexerMode mode);
+
+/**
+ * @brief Sets the lexer mode by name (marte, scalar, sse2, avx2, auto or check).
+ * @return false if \a name is not valid.
+ */
+bool SetLexerMode(const char8 * const name);
+
+/**
+ * @brief Parses the \a size bytes of \a buffer (cdb syntax) into the root of \a cdb with the given \a mode (which must be one of
+ * LexerScalar, LexerSSE2 or LexerAVX2).
+ * @return false if the content is not covered by this parser (\a cdb may then be partially written).
+ */
+bool ParseBuffer(const char8 * const buffer, const uint32 size, StructuredDataI &cdb, const LexerMode mode);
+
+/**
+ * @brief Parses \a stream (cdb syntax) into \a cdb with the current lexer mode, falling back to the StandardParser when needed.
+ * @return true if \a stream was successfully parsed.
+ */
+bool Parse(StreamI &stream, ConfigurationDatabase &cdb, StreamString &err);
+
+}
+
+}
+
+#endif /* FASTSTANDARDPARSER_H_ */
@@ -0,0 +1,91 @@
+/**
+ * @file HashFunction.h
+ * @brief Header file for the HashFunction helpers
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the HashFunction helpers,
+ * which are all defined inline.
+ */
+
+#ifndef HASHFUNCTION_H_
+#define HASHFUNCTION_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Non-cryptographic 64 bit hashes used to identify configuration contents (files and subtrees).
+ */
+namespace HashFunction {
+
+/**
+ * The FNV-1a 64 bit offset basis, i.e. the hash of an empty buffer.
+ */
+static const uint64 FNV1A_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+/**
+ * @brief Computes the FNV-1a 64 bit hash of \a size bytes of \a data.
+ * @param[in] seed the hash to continue from (allows hashing several buffers as if they were one).
+ */
+inline uint64 Fnv1a(const void * const data, const uint32 size, const uint64 seed = FNV1A_OFFSET_BASIS);
+
+/**
+ * @brief Combines two hashes in an order dependent way.
+ */
+inline uint64 Combine(const uint64 hash, const uint64 value);
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+namespace HashFunction {
+
+uint64 Fnv1a(const void * const data, const uint32 size, const uint64 seed) {
+    const uint8 *bytes = static_cast<const uint8 *>(data);
+    uint64 hash = seed;
+    uint32 i;
+    for (i = 0u; i < size; i++) {
+        hash ^= static_cast<uint64>(bytes[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+uint64 Combine(const uint64 hash, const uint64 value) {
+    return Fnv1a(&value, static_cast<uint32>(sizeof(uint64)), hash);
+}
+
+}
+
+}
+
+#endif /* HASHFUNCTION_H_ */
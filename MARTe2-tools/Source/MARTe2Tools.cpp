@@ -0,0 +1,178 @@
+/**
+ * @file MARTe2Tools.cpp
+ * @brief Source file for the MARTe2Tools C API
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of the C API of the libMARTe2Tools shared library.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationConverter.h"
+#include "ConfigurationDatabase.h"
+#include "ConfigurationGraphs.h"
+#include "MARTe2Tools.h"
+#include "MemoryOperationsHelper.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+using namespace MARTe;
+
+/**
+ * A parsed configuration. Each function works on its own copy of the ConfigurationDatabase, which shares the (read-only) tree.
+ */
+struct MARTe2ToolsConfiguration {
+    ConfigurationDatabase cdb;
+};
+
+/**
+ * The configurations parsed by all the callers.
+ */
+static ConfigurationCache parseCache;
+
+/**
+ * @brief Copies \a text, and its terminator, into \a output.
+ * @return MARTE2TOOLS_OK or MARTE2TOOLS_BUFFER_TOO_SMALL.
+ */
+static int CopyOutput(const StreamString &text, char *output, size_t outputSize, size_t *requiredSize) {
+    size_t textSize = static_cast<size_t>(text.Size()) + 1u;
+    if (requiredSize != NULL_PTR(size_t *)) {
+        *requiredSize = textSize;
+    }
+    int ret = MARTE2TOOLS_BUFFER_TOO_SMALL;
+    if ((output != NULL_PTR(char *)) && (outputSize >= textSize)) {
+        (void) MemoryOperationsHelper::Copy(output, text.Buffer(), static_cast<uint32>(textSize));
+        ret = MARTE2TOOLS_OK;
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+extern "C" {
+
+MARTe2ToolsConfiguration *MARTe2Tools_Parse(const char *buffer, size_t size, const char *format, char *error, size_t errorSize) {
+    bool ok = (buffer != NULL_PTR(const char *)) && (format != NULL_PTR(const char *));
+    if (ok) {
+        //The streams are limited to 32 bits
+        ok = (size < 0xFFFFFFFFu);
+    }
+    StreamString content;
+    if (ok) {
+        uint32 writeSize = static_cast<uint32>(size);
+        ok = content.Write(buffer, writeSize);
+    }
+    MARTe2ToolsConfiguration *configuration = NULL_PTR(MARTe2ToolsConfiguration *);
+    StreamString parserError;
+    if (ok) {
+        configuration = new MARTe2ToolsConfiguration();
+        ok = parseCache.GetContent(content, format, configuration->cdb, parserError);
+    }
+    else {
+        (void) parserError.Printf("%s", "Invalid buffer or format");
+    }
+    if (!ok) {
+        delete configuration;
+        configuration = NULL_PTR(MARTe2ToolsConfiguration *);
+        if ((error != NULL_PTR(char *)) && (errorSize > 0u)) {
+            size_t errorLength = static_cast<size_t>(parserError.Size());
+            if (errorLength >= errorSize) {
+                errorLength = errorSize - 1u;
+            }
+            (void) MemoryOperationsHelper::Copy(error, parserError.Buffer(), static_cast<uint32>(errorLength));
+            error[errorLength] = '\0';
+        }
+    }
+    return configuration;
+}
+
+void MARTe2Tools_Free(MARTe2ToolsConfiguration *configuration) {
+    delete configuration;
+}
+
+int MARTe2Tools_Convert(MARTe2ToolsConfiguration *configuration, const char *format, int canonical, char *output, size_t outputSize, size_t *requiredSize) {
+    int ret = MARTE2TOOLS_ERROR;
+    if ((configuration != NULL_PTR(MARTe2ToolsConfiguration *)) && (format != NULL_PTR(const char *))) {
+        ConfigurationDatabase cdb = configuration->cdb;
+        StreamString text;
+        bool ok = cdb.MoveToRoot();
+        if (ok) {
+            ok = ConfigurationConverter::Print(cdb, text, format, (canonical != 0));
+        }
+        if (ok) {
+            ret = CopyOutput(text, output, outputSize, requiredSize);
+        }
+    }
+    return ret;
+}
+
+int MARTe2Tools_ConvertToCString(MARTe2ToolsConfiguration *configuration, const char *variableName, char *output, size_t outputSize, size_t *requiredSize) {
+    int ret = MARTE2TOOLS_ERROR;
+    if ((configuration != NULL_PTR(MARTe2ToolsConfiguration *)) && (variableName != NULL_PTR(const char *))) {
+        ConfigurationDatabase cdb = configuration->cdb;
+        StreamString text;
+        bool ok = cdb.MoveToRoot();
+        if (ok) {
+            ok = ConfigurationConverter::PrintCString(cdb, variableName, text);
+        }
+        if (ok) {
+            ret = CopyOutput(text, output, outputSize, requiredSize);
+        }
+    }
+    return ret;
+}
+
+int MARTe2Tools_ExportGraphs(MARTe2ToolsConfiguration *configuration, const char *prefix, unsigned int maxDepth, unsigned int collapse, unsigned int group, MARTe2ToolsGraphCallback callback, void *context) {
+    bool ok = (configuration != NULL_PTR(MARTe2ToolsConfiguration *)) && (callback != NULL_PTR(MARTe2ToolsGraphCallback)) && (group != 1u);
+    GraphMemoryOutput output;
+    if (ok) {
+        ObjectsLevelOfDetail objectsLevelOfDetail;
+        objectsLevelOfDetail.maxDepth = maxDepth;
+        objectsLevelOfDetail.collapseThreshold = collapse;
+        objectsLevelOfDetail.groupThreshold = group;
+        ok = ConfigurationGraphs::Export(configuration->cdb, (prefix != NULL_PTR(const char *)) ? prefix : "", objectsLevelOfDetail, output);
+    }
+    //The graphs are exported in parallel but the callback is always called from this thread
+    uint32 i;
+    for (i = 0u; (i < output.GetNumberOfGraphs()) && (ok); i++) {
+        const StreamString &graph = output.GetGraph(i);
+        ok = (callback(context, output.GetName(i), graph.Buffer(), static_cast<size_t>(graph.Size())) == MARTE2TOOLS_OK);
+    }
+    return ok ? MARTE2TOOLS_OK : MARTE2TOOLS_ERROR;
+}
+
+int MARTe2Tools_Analyse(MARTe2ToolsConfiguration *configuration, char *output, size_t outputSize, size_t *requiredSize) {
+    int ret = MARTE2TOOLS_ERROR;
+    if (configuration != NULL_PTR(MARTe2ToolsConfiguration *)) {
+        StreamString text;
+        if (ConfigurationGraphs::Analyse(configuration->cdb, text)) {
+            ret = CopyOutput(text, output, outputSize, requiredSize);
+        }
+    }
+    return ret;
+}
+
+}
@@ -0,0 +1,128 @@
+/**
+ * @file MARTe2Tools.h
+ * @brief Header file for the MARTe2Tools C API
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the C API of the libMARTe2Tools shared library.
+ */
+
+#ifndef MARTE2TOOLS_H_
+#define MARTE2TOOLS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <stddef.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief C API to parse, convert and export MARTe2 configurations in-process (i.e. what CfgToCfg, CfgToString and CfgToDot do, without
+ * starting a process nor using temporary files).
+ * @details All the functions are thread safe and a parsed configuration may be used by several threads at the same time. The graphs
+ * are exported with the default styles, which are shared by all the exports and are only changed (by CfgToDot -style) when no export
+ * is running.
+ * Errors are reported with the MARTe2 REPORT_ERROR mechanism (see SetErrorProcessFunction) and with the return codes below.
+ * The output buffers are always terminated with a '\0', which is counted in the required sizes.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The function was successful.
+ */
+#define MARTE2TOOLS_OK 0
+
+/**
+ * The function failed (e.g. invalid format or configuration).
+ */
+#define MARTE2TOOLS_ERROR -1
+
+/**
+ * The output buffer is too small. The required size is returned and the function may be called again with a larger buffer.
+ */
+#define MARTE2TOOLS_BUFFER_TOO_SMALL -2
+
+/**
+ * Opaque handle of a parsed configuration.
+ */
+typedef struct MARTe2ToolsConfiguration MARTe2ToolsConfiguration;
+
+/**
+ * @brief Receives each exported Graphviz graph.
+ * @param[in] context the context given to MARTe2Tools_ExportGraphs.
+ * @param[in] name the name of the graph (e.g. PrefixRTApp.gv), i.e. the name of the file that CfgToDot would write.
+ * @param[in] graph the graph in dot syntax ('\0' terminated). Only valid during the call.
+ * @param[in] graphSize the size of the graph, without the '\0'.
+ * @return MARTE2TOOLS_OK to continue. Any other value stops the export.
+ */
+typedef int (*MARTe2ToolsGraphCallback)(void *context, const char *name, const char *graph, size_t graphSize);
+
+/**
+ * @brief Parses the \a size bytes of \a buffer in the given \a format (cdb, json or xml).
+ * @details Identical buffers share the same parsed configuration (see ConfigurationCache), so that parsing the same content again is cheap.
+ * @param[out] error if not NULL, receives the parser error message (truncated to \a errorSize).
+ * @return the parsed configuration (to be released with MARTe2Tools_Free) or NULL if it could not be parsed.
+ */
+MARTe2ToolsConfiguration *MARTe2Tools_Parse(const char *buffer, size_t size, const char *format, char *error, size_t errorSize);
+
+/**
+ * @brief Releases a configuration returned by MARTe2Tools_Parse. NULL is ignored.
+ */
+void MARTe2Tools_Free(MARTe2ToolsConfiguration *configuration);
+
+/**
+ * @brief Prints the \a configuration in the given \a format (cdb, json or xml) into \a output (as CfgToCfg).
+ * @param[in] canonical if non-zero the configuration is printed in its canonical form.
+ * @param[out] requiredSize if not NULL, receives the size required to print the configuration.
+ * @return MARTE2TOOLS_OK, MARTE2TOOLS_BUFFER_TOO_SMALL or MARTE2TOOLS_ERROR.
+ */
+int MARTe2Tools_Convert(MARTe2ToolsConfiguration *configuration, const char *format, int canonical, char *output, size_t outputSize, size_t *requiredSize);
+
+/**
+ * @brief Prints the \a configuration as the C string variable \a variableName into \a output (as CfgToString).
+ * @param[out] requiredSize see MARTe2Tools_Convert.
+ * @return MARTE2TOOLS_OK, MARTE2TOOLS_BUFFER_TOO_SMALL or MARTE2TOOLS_ERROR.
+ */
+int MARTe2Tools_ConvertToCString(MARTe2ToolsConfiguration *configuration, const char *variableName, char *output, size_t outputSize, size_t *requiredSize);
+
+/**
+ * @brief Exports all the Graphviz graphs of the \a configuration (as CfgToDot) and gives each one to the \a callback, in the calling thread.
+ * @param[in] prefix the prefix of the graph names (the -o argument of CfgToDot).
+ * @param[in] maxDepth, collapse, group the -maxdepth, -collapse and -group arguments of CfgToDot (zero disables each option, group cannot be one).
+ * @return MARTE2TOOLS_OK or MARTE2TOOLS_ERROR (also if the callback stopped the export).
+ */
+int MARTe2Tools_ExportGraphs(MARTe2ToolsConfiguration *configuration, const char *prefix, unsigned int maxDepth, unsigned int collapse, unsigned int group, MARTe2ToolsGraphCallback callback, void *context);
+
+/**
+ * @brief Writes into \a output the states, threads, functions and data sources of each RealTimeApplication of the \a configuration
+ * (the response to the CfgToDot server Analysis command).
+ * @param[out] requiredSize see MARTe2Tools_Convert.
+ * @return MARTE2TOOLS_OK, MARTE2TOOLS_BUFFER_TOO_SMALL or MARTE2TOOLS_ERROR.
+ */
+int MARTe2Tools_Analyse(MARTe2ToolsConfiguration *configuration, char *output, size_t outputSize, size_t *requiredSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MARTE2TOOLS_H_ */
@@ -0,0 +1,171 @@
+/**
+ * @file ParallelJobRunner.cpp
+ * @brief Source file for class ParallelJobRunner
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ParallelJobRunner (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Diagnostics.h"
+#include "ParallelJobRunner.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+ParallelJobRunner::ParallelJobRunner(const uint32 numberOfThreadsIn) {
+    numberOfThreads = numberOfThreadsIn;
+    if (numberOfThreads == 0u) {
+        numberOfThreads = GetDefaultNumberOfThreads();
+    }
+    currentFunction = NULL_PTR(ParallelJobFunction);
+    currentContext = NULL_PTR(void *);
+    totalJobs = 0u;
+    nextJob = 0u;
+    activeWorkers = 0u;
+    allOk = true;
+    (void) doneSem.Create();
+}
+
+ParallelJobRunner::~ParallelJobRunner() {
+    (void) doneSem.Close();
+    currentContext = NULL_PTR(void *);
+}
+
+uint32 ParallelJobRunner::GetNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+uint32 ParallelJobRunner::GetDefaultNumberOfThreads() {
+    long nCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32 ret = 1u;
+    if (nCpus > 1) {
+        ret = static_cast<uint32>(nCpus);
+    }
+    return ret;
+}
+
+bool ParallelJobRunner::NextJob(uint32 &jobIndex) {
+    (void) mux.FastLock();
+    bool ok = (nextJob < totalJobs);
+    if (ok) {
+        jobIndex = nextJob;
+        nextJob++;
+    }
+    mux.FastUnLock();
+    return ok;
+}
+
+void ParallelJobRunner::WorkerThread(const void * const parameters) {
+    ParallelJobRunner *runner = static_cast<ParallelJobRunner *>(const_cast<void *>(parameters));
+    uint32 jobIndex;
+    bool ok = true;
+    while (runner->NextJob(jobIndex)) {
+        if (!runner->currentFunction(runner->currentContext, jobIndex)) {
+            ok = false;
+        }
+    }
+    Diagnostics::Release();
+    (void) runner->mux.FastLock();
+    if (!ok) {
+        runner->allOk = false;
+    }
+    runner->activeWorkers--;
+    //Post while holding the lock: Run only returns after taking the lock again, so that
+    //no worker can touch the runner once Run has returned
+    if (runner->activeWorkers == 0u) {
+        (void) runner->doneSem.Post();
+    }
+    runner->mux.FastUnLock();
+}
+
+bool ParallelJobRunner::Run(const ParallelJobFunction function, void * const context, const uint32 numberOfJobs) {
+    bool ok = true;
+    uint32 j;
+    uint32 numberOfWorkers = (numberOfJobs < numberOfThreads) ? numberOfJobs : numberOfThreads;
+    if (numberOfWorkers <= 1u) {
+        //Nothing to gain from threads
+        for (j = 0u; j < numberOfJobs; j++) {
+            if (!function(context, j)) {
+                ok = false;
+            }
+        }
+    }
+    else {
+        currentFunction = function;
+        currentContext = context;
+        totalJobs = numberOfJobs;
+        nextJob = 0u;
+        allOk = true;
+        //The calling thread also counts as a worker, so that the counter only reaches zero once
+        //all the workers that did start have finished
+        activeWorkers = numberOfWorkers + 1u;
+        (void) doneSem.Reset();
+        uint32 w;
+        for (w = 0u; w < numberOfWorkers; w++) {
+            ThreadIdentifier tid = Threads::BeginThread(&ParallelJobRunner::WorkerThread, this, THREADS_DEFAULT_STACKSIZE * 4u);
+            if (tid == InvalidThreadIdentifier) {
+                REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to start worker thread %d", w);
+                ok = false;
+                //The jobs are still picked by the workers that did start (or by this thread below)
+                (void) mux.FastLock();
+                activeWorkers--;
+                mux.FastUnLock();
+            }
+        }
+        //Help with the remaining jobs while waiting
+        uint32 jobIndex;
+        while (NextJob(jobIndex)) {
+            if (!function(context, jobIndex)) {
+                ok = false;
+            }
+        }
+        (void) mux.FastLock();
+        activeWorkers--;
+        bool mustWait = (activeWorkers > 0u);
+        mux.FastUnLock();
+        if (mustWait) {
+            ErrorManagement::ErrorType err = doneSem.Wait(TTInfiniteWait);
+            ok = (err.ErrorsCleared()) && (ok);
+            //Wait for the last worker to release the lock after posting
+            (void) mux.FastLock();
+            mux.FastUnLock();
+        }
+        ok = (allOk) && (ok);
+        currentFunction = NULL_PTR(ParallelJobFunction);
+        currentContext = NULL_PTR(void *);
+    }
+    return ok;
+}
+
+}
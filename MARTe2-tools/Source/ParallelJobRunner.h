@@ -0,0 +1,125 @@
+/**
+ * @file ParallelJobRunner.h
+ * @brief Header file for class ParallelJobRunner
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ParallelJobRunner
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef PARALLELJOBRUNNER_H_
+#define PARALLELJOBRUNNER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Function executed for each job. Returns false if the job failed.
+ */
+typedef bool (*ParallelJobFunction)(void * const context, const uint32 jobIndex);
+
+/**
+ * @brief Runs a set of independent jobs on a fixed number of worker threads.
+ * @details Each job is identified by its index in [0, numberOfJobs[. The jobs are taken
+ * by the workers in order and Run only returns after all the jobs have been executed.
+ * With one thread (or one job) the jobs are executed in the calling thread.
+ */
+class ParallelJobRunner {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] numberOfThreadsIn maximum number of worker threads. If zero GetDefaultNumberOfThreads() is used.
+     */
+    ParallelJobRunner(const uint32 numberOfThreadsIn = 0u);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ParallelJobRunner();
+
+    /**
+     * @brief Executes \a function for each job index and waits for all of them to complete.
+     * @param[in] function the function to execute.
+     * @param[in] context opaque pointer passed to every call of \a function.
+     * @param[in] numberOfJobs the number of jobs to execute.
+     * @return true if all the jobs returned true and all the workers could be started.
+     */
+    bool Run(const ParallelJobFunction function, void * const context, const uint32 numberOfJobs);
+
+    /**
+     * @brief Gets the number of worker threads that will be used.
+     */
+    uint32 GetNumberOfThreads() const;
+
+    /**
+     * @brief Gets the number of online processors (at least one).
+     */
+    static uint32 GetDefaultNumberOfThreads();
+
+private:
+    /**
+     * @brief Worker thread entry point.
+     */
+    static void WorkerThread(const void * const parameters);
+
+    /**
+     * @brief Takes the next job index. Returns false when there are no more jobs.
+     */
+    bool NextJob(uint32 &jobIndex);
+
+    /**
+     * Maximum number of worker threads.
+     */
+    uint32 numberOfThreads;
+
+    /**
+     * The function and context of the current Run.
+     */
+    ParallelJobFunction currentFunction;
+    void *currentContext;
+
+    /**
+     * Job bookkeeping, protected by mux.
+     */
+    uint32 totalJobs;
+    uint32 nextJob;
+    uint32 activeWorkers;
+    bool allOk;
+    FastPollingMutexSem mux;
+
+    /**
+     * Posted by the last worker to finish.
+     */
+    EventSem doneSem;
+};
+
+}
+
+#endif /* PARALLELJOBRUNNER_H_ */
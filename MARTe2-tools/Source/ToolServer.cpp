@@ -0,0 +1,467 @@
+/**
+ * @file ToolServer.cpp
+ * @brief Source file for class ToolServer
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class ToolServer (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "Diagnostics.h"
+#include "ParallelJobRunner.h"
+#include "StandardParser.h"
+#include "StringHelper.h"
+#include "Threads.h"
+#include "ToolServer.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * Maximum size of a request header and of a request body.
+ */
+static const uint32 TOOL_SERVER_MAX_HEADER_SIZE = 1048576u;
+static const uint32 TOOL_SERVER_MAX_BODY_SIZE = 1073741824u;
+
+/**
+ * Maximum number of digits of each number of a frame line, so that the numbers cannot overflow an int64.
+ */
+static const uint32 TOOL_SERVER_MAX_FRAME_DIGITS = 18u;
+
+/**
+ * Maximum number of accepted connections waiting for a worker.
+ */
+static const uint32 TOOL_SERVER_MAX_PENDING = 256u;
+
+/**
+ * @brief Reads exactly \a size bytes from \a fd.
+ */
+static bool ReadFully(const int32 fd, char8 * const buffer, const uint32 size) {
+    uint32 total = 0u;
+    bool ok = true;
+    while ((ok) && (total < size)) {
+        ssize_t n = recv(fd, &buffer[total], static_cast<size_t>(size - total), 0);
+        if (n > 0) {
+            total += static_cast<uint32>(n);
+        }
+        else if ((n < 0) && (errno == EINTR)) {
+            //Retry
+        }
+        else {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Writes exactly \a size bytes to \a fd.
+ */
+static bool WriteFully(const int32 fd, const char8 * const buffer, const uint32 size) {
+    uint32 total = 0u;
+    bool ok = true;
+    while ((ok) && (total < size)) {
+        ssize_t n = send(fd, &buffer[total], static_cast<size_t>(size - total), MSG_NOSIGNAL);
+        if (n > 0) {
+            total += static_cast<uint32>(n);
+        }
+        else if ((n < 0) && (errno == EINTR)) {
+            //Retry
+        }
+        else {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Reads a request/response frame line with two numbers ("A B\n").
+ * @return false if the connection was closed or the line is not valid.
+ */
+static bool ReadFrameLine(const int32 fd, int64 &first, uint32 &second) {
+    char8 line[64];
+    uint32 n = 0u;
+    bool ok = true;
+    bool done = false;
+    while ((ok) && (!done)) {
+        ok = (n < (sizeof(line) - 1u));
+        if (ok) {
+            ok = ReadFully(fd, &line[n], 1u);
+        }
+        if (ok) {
+            done = (line[n] == '\n');
+            n++;
+        }
+    }
+    if (ok) {
+        line[n - 1u] = '\0';
+        //Parse the two numbers
+        int64 values[2] = { 0, 0 };
+        bool negative = false;
+        uint32 v = 0u;
+        bool hasDigits = false;
+        uint32 numberOfDigits = 0u;
+        uint32 i;
+        for (i = 0u; (i < n) && (ok); i++) {
+            char8 c = line[i];
+            if ((c >= '0') && (c <= '9')) {
+                //A third number is not valid and more than 18 digits could overflow
+                numberOfDigits++;
+                ok = (v < 2u) && (numberOfDigits <= TOOL_SERVER_MAX_FRAME_DIGITS);
+                if (ok) {
+                    values[v] = (values[v] * 10) + static_cast<int64>(c - '0');
+                    hasDigits = true;
+                }
+            }
+            else if ((c == '-') && (!hasDigits)) {
+                negative = true;
+            }
+            else if ((c == ' ') || (c == '\0')) {
+                if (hasDigits) {
+                    if (negative) {
+                        values[v] = -values[v];
+                    }
+                    v++;
+                    hasDigits = false;
+                    negative = false;
+                    numberOfDigits = 0u;
+                }
+            }
+            else {
+                ok = false;
+            }
+        }
+        if (ok) {
+            ok = (v == 2u) && (values[1] >= 0);
+        }
+        if (ok) {
+            first = values[0];
+            ok = (values[1] <= static_cast<int64>(TOOL_SERVER_MAX_BODY_SIZE));
+            second = static_cast<uint32>(values[1]);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Reads \a size bytes from \a fd into \a content.
+ */
+static bool ReadContent(const int32 fd, const uint32 size, StreamString &content) {
+    bool ok = true;
+    if (size > 0u) {
+        char8 *buffer = new char8[size];
+        ok = ReadFully(fd, buffer, size);
+        if (ok) {
+            uint32 writeSize = size;
+            ok = content.Write(buffer, writeSize);
+        }
+        delete [] buffer;
+    }
+    if (ok) {
+        ok = content.Seek(0LLU);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+ToolServer::ToolServer(const ToolRequestHandler handlerIn, const uint32 numberOfThreadsIn, const uint32 cacheCapacity) :
+        cache(cacheCapacity) {
+    handler = handlerIn;
+    numberOfThreads = numberOfThreadsIn;
+    if (numberOfThreads == 0u) {
+        numberOfThreads = ParallelJobRunner::GetDefaultNumberOfThreads();
+    }
+    listenFd = -1;
+    pendingCapacity = TOOL_SERVER_MAX_PENDING;
+    pendingConnections = new int32[pendingCapacity];
+    pendingFirst = 0u;
+    pendingSize = 0u;
+    stopping = false;
+    activeWorkers = 0u;
+    servedConnections = new int32[numberOfThreads];
+    uint32 i;
+    for (i = 0u; i < numberOfThreads; i++) {
+        servedConnections[i] = -1;
+    }
+    (void) pendingSem.Create();
+    (void) workersDoneSem.Create();
+}
+
+ToolServer::~ToolServer() {
+    delete [] pendingConnections;
+    delete [] servedConnections;
+    (void) pendingSem.Close();
+    (void) workersDoneSem.Close();
+}
+
+bool ToolServer::PushConnection(const int32 connectionFd) {
+    (void) mux.FastLock();
+    bool ok = (pendingSize < pendingCapacity) && (!stopping);
+    if (ok) {
+        pendingConnections[(pendingFirst + pendingSize) % pendingCapacity] = connectionFd;
+        pendingSize++;
+        (void) pendingSem.Post();
+    }
+    mux.FastUnLock();
+    return ok;
+}
+
+int32 ToolServer::PopConnection() {
+    int32 connectionFd = -1;
+    bool done = false;
+    while (!done) {
+        (void) mux.FastLock();
+        if (pendingSize > 0u) {
+            connectionFd = pendingConnections[pendingFirst];
+            pendingFirst = (pendingFirst + 1u) % pendingCapacity;
+            pendingSize--;
+            done = true;
+            uint32 i;
+            bool registered = false;
+            for (i = 0u; (i < numberOfThreads) && (!registered); i++) {
+                registered = (servedConnections[i] < 0);
+                if (registered) {
+                    servedConnections[i] = connectionFd;
+                }
+            }
+            if (stopping) {
+                //The requests already sent are still served
+                (void) shutdown(connectionFd, SHUT_RD);
+            }
+        }
+        else if (stopping) {
+            done = true;
+        }
+        else {
+            //Reset while holding the lock, so that a Post after a push cannot be lost
+            (void) pendingSem.Reset();
+        }
+        mux.FastUnLock();
+        if (!done) {
+            (void) pendingSem.Wait(TTInfiniteWait);
+        }
+    }
+    return connectionFd;
+}
+
+void ToolServer::CloseConnection(const int32 connectionFd) {
+    (void) mux.FastLock();
+    uint32 i;
+    bool found = false;
+    for (i = 0u; (i < numberOfThreads) && (!found); i++) {
+        found = (servedConnections[i] == connectionFd);
+        if (found) {
+            servedConnections[i] = -1;
+        }
+    }
+    //Closed while holding the lock, so that Stop never shuts down a reused descriptor
+    (void) close(connectionFd);
+    mux.FastUnLock();
+}
+
+void ToolServer::Stop() {
+    (void) mux.FastLock();
+    stopping = true;
+    (void) pendingSem.Post();
+    //Once the requests already received are served the workers read the end of the connection, even if the client keeps it open
+    uint32 i;
+    for (i = 0u; i < numberOfThreads; i++) {
+        if (servedConnections[i] >= 0) {
+            (void) shutdown(servedConnections[i], SHUT_RD);
+        }
+    }
+    mux.FastUnLock();
+    //Unblocks the accept
+    (void) shutdown(listenFd, SHUT_RDWR);
+}
+
+void ToolServer::WorkerThread(const void * const parameters) {
+    ToolServer *server = static_cast<ToolServer *>(const_cast<void *>(parameters));
+    int32 connectionFd = server->PopConnection();
+    while (connectionFd >= 0) {
+        server->ServeConnection(connectionFd);
+        server->CloseConnection(connectionFd);
+        connectionFd = server->PopConnection();
+    }
+    Diagnostics::Release();
+    (void) server->mux.FastLock();
+    server->activeWorkers--;
+    bool lastWorker = (server->activeWorkers == 0u);
+    server->mux.FastUnLock();
+    if (lastWorker) {
+        (void) server->workersDoneSem.Post();
+    }
+}
+
+void ToolServer::ServeConnection(const int32 connectionFd) {
+    bool connected = true;
+    while (connected) {
+        int64 headerSize = 0;
+        uint32 bodySize = 0u;
+        connected = ReadFrameLine(connectionFd, headerSize, bodySize);
+        if (connected) {
+            connected = (headerSize >= 0) && (headerSize <= static_cast<int64>(TOOL_SERVER_MAX_HEADER_SIZE));
+        }
+        StreamString header;
+        StreamString body;
+        if (connected) {
+            connected = ReadContent(connectionFd, static_cast<uint32>(headerSize), header);
+        }
+        if (connected) {
+            connected = ReadContent(connectionFd, bodySize, body);
+        }
+        if (connected) {
+            StreamString response;
+            ConfigurationDatabase request;
+            StreamString err;
+            StandardParser parser(header, request, &err);
+            bool ok = parser.Parse();
+            StreamString command;
+            if (ok) {
+                ok = request.MoveToRoot();
+            }
+            if (ok) {
+                ok = request.Read("Command", command);
+                if (!ok) {
+                    (void) response.Printf("%s", "Command not specified");
+                }
+            }
+            else {
+                (void) response.Printf("Invalid request: %s", err.Buffer());
+            }
+            if (ok) {
+                if (command == "Stop") {
+                    Stop();
+                }
+                else if (command == "Statistics") {
+                    uint64 hits = 0u;
+                    uint64 misses = 0u;
+                    cache.GetStatistics(hits, misses);
+                    ok = response.Printf("CacheHits = %llu\nCacheMisses = %llu\n", hits, misses);
+                }
+                else {
+                    ok = handler(request, body, cache, response);
+                }
+            }
+            StreamString frame;
+            int32 status = ok ? 0 : -1;
+            (void) frame.Printf("%d %u\n", status, static_cast<uint32>(response.Size()));
+            connected = WriteFully(connectionFd, frame.Buffer(), static_cast<uint32>(frame.Size()));
+            if ((connected) && (response.Size() > 0u)) {
+                connected = WriteFully(connectionFd, response.Buffer(), static_cast<uint32>(response.Size()));
+            }
+        }
+    }
+}
+
+bool ToolServer::Start(const char8 * const socketPath) {
+    struct sockaddr_un address;
+    bool ok = (StringHelper::Length(socketPath) < sizeof(address.sun_path));
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Socket path %s is too long", socketPath);
+    }
+    if (ok) {
+        (void) unlink(socketPath);
+        listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+        ok = (listenFd >= 0);
+    }
+    if (ok) {
+        (void) MemoryOperationsHelper::Set(&address, '\0', static_cast<uint32>(sizeof(address)));
+        address.sun_family = AF_UNIX;
+        (void) StringHelper::Copy(&address.sun_path[0], socketPath);
+        ok = (bind(listenFd, reinterpret_cast<struct sockaddr *>(&address), static_cast<socklen_t>(sizeof(address))) == 0);
+    }
+    if (ok) {
+        ok = (listen(listenFd, static_cast<int>(TOOL_SERVER_MAX_PENDING)) == 0);
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to listen on %s", socketPath);
+    }
+    uint32 w;
+    for (w = 0u; (w < numberOfThreads) && (ok); w++) {
+        (void) mux.FastLock();
+        activeWorkers++;
+        mux.FastUnLock();
+        ThreadIdentifier tid = Threads::BeginThread(&ToolServer::WorkerThread, this, THREADS_DEFAULT_STACKSIZE * 4u);
+        if (tid == InvalidThreadIdentifier) {
+            (void) mux.FastLock();
+            activeWorkers--;
+            mux.FastUnLock();
+            ok = (w > 0u);
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to start worker thread %d", w);
+        }
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Listening on %s with %d worker threads", socketPath, numberOfThreads);
+    }
+    bool serving = ok;
+    while (serving) {
+        int32 connectionFd = accept(listenFd, NULL_PTR(struct sockaddr *), NULL_PTR(socklen_t *));
+        (void) mux.FastLock();
+        serving = !stopping;
+        mux.FastUnLock();
+        if (connectionFd >= 0) {
+            if (!PushConnection(connectionFd)) {
+                (void) close(connectionFd);
+            }
+        }
+        else if (errno == EINTR) {
+            //Retry
+        }
+        else if (serving) {
+            REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to accept connection on %s", socketPath);
+            ok = false;
+            serving = false;
+        }
+        else {
+            //Stopping
+        }
+    }
+    Stop();
+    (void) mux.FastLock();
+    bool mustWait = (activeWorkers > 0u);
+    mux.FastUnLock();
+    if (mustWait) {
+        (void) workersDoneSem.Wait(TTInfiniteWait);
+    }
+    if (listenFd >= 0) {
+        (void) close(listenFd);
+        (void) unlink(socketPath);
+        listenFd = -1;
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,156 @@
+/**
+ * @file ToolServer.h
+ * @brief Header file for class ToolServer
+ * @date 19/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class ToolServer
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TOOLSERVER_H_
+#define TOOLSERVER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "ConfigurationCache.h"
+#include "ConfigurationDatabase.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Handles one request received by the ToolServer.
+ * @param[in] request the request header, pointing at its root. The Command leaf is always present.
+ * @param[in] body the (optional) inline content sent after the request header.
+ * @param[in] cache the cache of parsed configurations shared by all the requests.
+ * @param[out] response the content to send back to the client.
+ * @return true if the request was successfully handled.
+ */
+typedef bool (*ToolRequestHandler)(ConfigurationDatabase &request, StreamString &body, ConfigurationCache &cache, StreamString &response);
+
+/**
+ * @brief Serves the requests of a tool over a local Unix domain socket, so that the tool is only started once.
+ * @details Each request is framed as:
+ *  - a line with two decimal numbers "HEADER_SIZE BODY_SIZE\n";
+ *  - HEADER_SIZE bytes with the request header, in cdb syntax, which must contain a Command leaf;
+ *  - BODY_SIZE bytes with an optional inline content (e.g. a configuration to convert).
+ *
+ * Each response is framed as a line "STATUS BODY_SIZE\n" (STATUS is 0 on success and -1 on failure) followed by BODY_SIZE bytes.
+ * A connection may carry any number of requests. The connections are served concurrently by a fixed pool of worker threads.
+ * The Command Stop makes Start return once the requests already sent on all the pending connections were served: the reading side of
+ * each connection is shut down, so that a client which keeps its connection open cannot block the server. The Command Statistics returns
+ * the cache statistics. All the other commands are given to the ToolRequestHandler.
+ */
+class ToolServer {
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] handlerIn the tool request handler.
+     * @param[in] numberOfThreadsIn the number of worker threads. If zero one per processor is used.
+     * @param[in] cacheCapacity the maximum number of parsed configurations to keep in memory.
+     */
+    ToolServer(const ToolRequestHandler handlerIn, const uint32 numberOfThreadsIn = 0u, const uint32 cacheCapacity = 32u);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ToolServer();
+
+    /**
+     * @brief Listens on \a socketPath (any existent socket file is removed) and serves requests until a Stop command is received.
+     * @return true if the server could be started and was stopped without errors.
+     */
+    bool Start(const char8 * const socketPath);
+
+private:
+    /**
+     * @brief Worker thread entry point.
+     */
+    static void WorkerThread(const void * const parameters);
+
+    /**
+     * @brief Serves all the requests of a connection, until the client closes it.
+     */
+    void ServeConnection(const int32 connectionFd);
+
+    /**
+     * @brief Adds a connection to the pending queue.
+     */
+    bool PushConnection(const int32 connectionFd);
+
+    /**
+     * @brief Waits for a pending connection, which is registered as being served. Returns -1 when the server is stopping and there are
+     * no more connections.
+     */
+    int32 PopConnection();
+
+    /**
+     * @brief Unregisters and closes a connection returned by PopConnection.
+     */
+    void CloseConnection(const int32 connectionFd);
+
+    /**
+     * @brief Requests the server to stop.
+     */
+    void Stop();
+
+    ToolRequestHandler handler;
+    ConfigurationCache cache;
+    uint32 numberOfThreads;
+    int32 listenFd;
+
+    /**
+     * Circular queue of accepted connections, protected by mux.
+     */
+    int32 *pendingConnections;
+    uint32 pendingCapacity;
+    uint32 pendingFirst;
+    uint32 pendingSize;
+    bool stopping;
+    uint32 activeWorkers;
+
+    /**
+     * Connections being served by the workers (-1 if the slot is free), protected by mux. One slot per worker thread.
+     */
+    int32 *servedConnections;
+    FastPollingMutexSem mux;
+
+    /**
+     * Posted when a connection is queued (or when stopping).
+     */
+    EventSem pendingSem;
+
+    /**
+     * Posted when the last worker terminates.
+     */
+    EventSem workersDoneSem;
+};
+
+}
+
+#endif /* TOOLSERVER_H_ */
@@ -0,0 +1,55 @@
+#!/usr/bin/env bash
+#
+# Compares the cdb lexers (see MARTE2_TOOLS_CDB_LEXER) over a corpus of cdb files:
+# - each file is parsed in check mode, which fails if the fast parser and the StandardParser results differ;
+# - the CfgToCfg output of each lexer must be byte identical to the one of the StandardParser (marte);
+# - the time taken by each lexer to convert the whole corpus REPEATS times is printed.
+# The start-up of CfgToCfg is included in the times, so use large files (or many repeats) to compare the lexers.
+#
+# Usage: cfgparsebench.sh [CORPUS_DIR] [REPEATS]
+export M2TOOLS_DIR=${M2TOOLS_DIR:-$(dirname $0)/../MARTe2-tools/Build/x86-linux/Source/}
+CFGTOCFG=$(realpath $M2TOOLS_DIR/CfgToCfg.ex)
+CORPUS_DIR=${1:-$(dirname $0)/../examples}
+REPEATS=${2:-5}
+LEXERS="marte scalar sse2 avx2"
+
+TMP_DIR=$(mktemp -d)
+trap "rm -rf $TMP_DIR" EXIT
+
+find $CORPUS_DIR -name "*.cfg" > $TMP_DIR/corpus.txt
+echo "$(wc -l < $TMP_DIR/corpus.txt) files in $CORPUS_DIR"
+
+failed=0
+while read cfg
+do
+  if ! MARTE2_TOOLS_CDB_LEXER=check $CFGTOCFG -i $cfg -if cdb -o /dev/null -of cdb < /dev/null > /dev/null 2>&1
+  then
+    echo "check failed: $cfg"
+    failed=1
+  fi
+  for lexer in $LEXERS
+  do
+    MARTE2_TOOLS_CDB_LEXER=$lexer $CFGTOCFG -i $cfg -if cdb -o $TMP_DIR/$lexer.cfg -of cdb < /dev/null > /dev/null 2>&1
+    if ! cmp -s $TMP_DIR/marte.cfg $TMP_DIR/$lexer.cfg
+    then
+      echo "$lexer output differs from marte: $cfg"
+      failed=1
+    fi
+  done
+done < $TMP_DIR/corpus.txt
+
+for lexer in $LEXERS
+do
+  start=$(date +%s%N)
+  for r in $(seq $REPEATS)
+  do
+    while read cfg
+    do
+      MARTE2_TOOLS_CDB_LEXER=$lexer $CFGTOCFG -i $cfg -if cdb -o /dev/null -of cdb < /dev/null > /dev/null 2>&1
+    done < $TMP_DIR/corpus.txt
+  done
+  end=$(date +%s%N)
+  echo "$lexer: $(( (end - start) / 1000000 )) ms"
+done
+
+exit $failed